@@ -26,8 +26,30 @@
 #define DIO_CFG_AR_RELEASE_MINOR_VERSION     (0U)
 #define DIO_CFG_AR_RELEASE_PATCH_VERSION     (3U)
 
-/* Pre-compile option for Development Error Detect */
+/* Pre-compile option for Development Error Detect ... STD_OFF removes all the checks below, override it on the command line */
+#ifndef DIO_DEV_ERROR_DETECT
 #define DIO_DEV_ERROR_DETECT                (STD_ON)
+#endif
+
+/*
+ * Pre-compile option for the APIs which check their development errors:
+ * DIO_DEV_ERROR_PROFILE_ALL    - every API
+ * DIO_DEV_ERROR_PROFILE_CONFIG - Dio_Init and Dio_GetVersionInfo only, the Read/Write/Flip paths run unchecked
+ * DIO_DEV_ERROR_PROFILE_CUSTOM - the APIs selected by the DIO_DEV_ERROR_CUSTOM_xxx options
+ */
+#define DIO_DEV_ERROR_PROFILE               (DIO_DEV_ERROR_PROFILE_ALL)
+
+/* Pre-compile options for the APIs checked by DIO_DEV_ERROR_PROFILE_CUSTOM */
+#define DIO_DEV_ERROR_CUSTOM_INIT           (STD_ON)
+#define DIO_DEV_ERROR_CUSTOM_READ_CHANNEL   (STD_OFF)
+#define DIO_DEV_ERROR_CUSTOM_WRITE_CHANNEL  (STD_OFF)
+#define DIO_DEV_ERROR_CUSTOM_FLIP_CHANNEL   (STD_OFF)
+#define DIO_DEV_ERROR_CUSTOM_VERSION_INFO   (STD_ON)
+
+/* Pre-compile options for the classes of errors checked by the selected APIs */
+#define DIO_DEV_ERROR_UNINIT_CHECK          (STD_ON)   /* DIO_E_UNINIT */
+#define DIO_DEV_ERROR_RANGE_CHECK           (STD_ON)   /* DIO_E_PARAM_INVALID_CHANNEL_ID */
+#define DIO_DEV_ERROR_POINTER_CHECK         (STD_ON)   /* DIO_E_PARAM_CONFIG, DIO_E_PARAM_POINTER */
 
 /* Pre-compile option for Version Info API */
 #define DIO_VERSION_INFO_API                (STD_OFF)
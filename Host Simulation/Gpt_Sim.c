@@ -0,0 +1,251 @@
+ /******************************************************************************
+ *
+ * Module: Host Simulation
+ *
+ * File Name: Gpt_Sim.c
+ *
+ * Description: Virtual time of the host simulation. SysTick_SimTick elapses the
+ *              System clock cycles up to the next SysTick interrupt on the registers
+ *              of RegSim.c, where Gpt.c started SysTick, and runs the SysTick_Handler
+ *              of Gpt.c. The GPTM timers count on the same registers, every time-out
+ *              with its interrupt enabled runs the Timer ISR of Gpt.c when it occurs.
+ *              The timestamp counter read by Gpt_Timestamp.h advances with the
+ *              time, its overflow runs the WideTimer5A_Handler of Gpt.c.
+ *              With CPU_SIM_CYCLE_COUNTER the cycle counter of Cpu.h counts the
+ *              virtual time in ns. With CPU_SIM_INTERRUPTS the critical sections
+ *              of Cpu.h hold off an ISR raised while they disable the interrupts.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "Gpt_Sim.h"
+#include "RegSim.h"
+#include "Mcu.h"
+
+#include "Gpt_Regs.h"
+
+/* ISRs of Gpt.c in the vector table of the target */
+void SysTick_Handler(void);
+void Timer0A_Handler(void);
+void Timer1A_Handler(void);
+void Timer2A_Handler(void);
+void Timer3A_Handler(void);
+void Timer4A_Handler(void);
+void Timer5A_Handler(void);
+void WideTimer0A_Handler(void);
+void WideTimer1A_Handler(void);
+void WideTimer2A_Handler(void);
+void WideTimer3A_Handler(void);
+void WideTimer4A_Handler(void);
+void WideTimer5A_Handler(void);
+
+/* Description: Timer ISR and its interrupt number */
+typedef struct
+{
+    void (*handler)(void);
+    uint8 irq;
+}Gpt_SimIsrType;
+
+/* Timer A ISRs ... the one of WideTimer5 is the timestamp overflow when the timestamp is enabled */
+static const Gpt_SimIsrType Gpt_SimTimerIsr[] =
+{
+    {Timer0A_Handler,     GPT_TIMER0A_IRQ_NUM},
+    {Timer1A_Handler,     GPT_TIMER1A_IRQ_NUM},
+    {Timer2A_Handler,     GPT_TIMER2A_IRQ_NUM},
+    {Timer3A_Handler,     GPT_TIMER3A_IRQ_NUM},
+    {Timer4A_Handler,     GPT_TIMER4A_IRQ_NUM},
+    {Timer5A_Handler,     GPT_TIMER5A_IRQ_NUM},
+    {WideTimer0A_Handler, GPT_WIDE_TIMER0A_IRQ_NUM},
+    {WideTimer1A_Handler, GPT_WIDE_TIMER1A_IRQ_NUM},
+    {WideTimer2A_Handler, GPT_WIDE_TIMER2A_IRQ_NUM},
+    {WideTimer3A_Handler, GPT_WIDE_TIMER3A_IRQ_NUM},
+    {WideTimer4A_Handler, GPT_WIDE_TIMER4A_IRQ_NUM},
+#if (GPT_TIMESTAMP_API == STD_OFF)
+    {WideTimer5A_Handler, GPT_WIDE_TIMER5A_IRQ_NUM},
+#endif
+};
+
+#define GPT_SIM_TIMER_ISRS_NUM  (sizeof(Gpt_SimTimerIsr) / sizeof(Gpt_SimTimerIsr[0]))
+
+/* Global variable store the virtual time in System clock cycles */
+static uint64 g_Gpt_Sim_Time = 0;
+
+/* Cycles counted by the timestamp timer, its low 32 bits are the counter register */
+static uint64 g_Gpt_Sim_Cycles = 0;
+
+/* Cycles elapsed by every read of a timestamp register */
+static uint32 g_Gpt_Sim_Access_Cycles = 0;
+
+/* Raw time-out status and interrupt enable of the timestamp timer */
+static boolean g_Gpt_Sim_Overflow = FALSE;
+static boolean g_Gpt_Sim_Isr_Enabled = TRUE;
+
+#if (CPU_SIM_INTERRUPTS == STD_ON)
+/* Simulated PRIMASK, the ISR raised in the next critical section and the ISR held off by the current one */
+static uint32 g_Cpu_Sim_Masked = 0;
+static void (*g_Cpu_Sim_Raised_Isr)(void) = NULL_PTR;
+static void (*g_Cpu_Sim_Pending_Isr)(void) = NULL_PTR;
+#endif
+
+/*********************************************************************************************/
+void Gpt_SimElapse(uint32 Cycles)
+{
+    uint32 step;
+    uint8 index;
+
+    while(Cycles != 0)
+    {
+        /* Stop at every interrupt ... a timer shorter than the SysTick period expires many times in one tick */
+        step = RegSim_GetEventCycles();
+        if((step == 0) || (step > Cycles))
+        {
+            step = Cycles;
+        }
+        Cycles -= step;
+
+        g_Gpt_Sim_Time += step;
+        RegSim_Elapse(step);
+        Gpt_SimTimestampAdvance(step);
+
+        /* The timers have a higher priority than SysTick */
+        for(index = 0; index < GPT_SIM_TIMER_ISRS_NUM; index++)
+        {
+            if(RegSim_IsIrqPending(Gpt_SimTimerIsr[index].irq))
+            {
+                Gpt_SimTimerIsr[index].handler();
+            }
+        }
+        if(RegSim_TakeSysTickInterrupt())
+        {
+            SysTick_Handler();
+        }
+    }
+}
+
+/*********************************************************************************************/
+boolean SysTick_SimTick(void)
+{
+    uint32 cycles = RegSim_GetSysTickCycles();
+
+    if(cycles == 0)
+    {
+        return FALSE;
+    }
+    Gpt_SimElapse(cycles);
+    return TRUE;
+}
+
+/*********************************************************************************************/
+uint64 SysTick_SimGetTime(void)
+{
+    return g_Gpt_Sim_Time / (Mcu_GetSysClockFrequency() / 1000U);
+}
+
+#if (CPU_SIM_CYCLE_COUNTER == STD_ON)
+/*********************************************************************************************/
+uint32 Cpu_SimGetCycleCount(void)
+{
+    uint32 frequency = Mcu_GetSysClockFrequency();
+
+    /* Whole seconds apart so the product fits in 64 bits for any virtual time */
+    return (uint32)(((g_Gpt_Sim_Time / frequency) * 1000000000U) + (((g_Gpt_Sim_Time % frequency) * 1000000000U) / frequency));
+}
+#endif
+
+/*********************************************************************************************/
+uint32 Gpt_SimTimestampReadCounter(void)
+{
+    uint32 counter;
+
+    /* The ISR can run right before and right after the read */
+    Gpt_SimTimestampAdvance(g_Gpt_Sim_Access_Cycles);
+    counter = (uint32)g_Gpt_Sim_Cycles;
+    Gpt_SimTimestampAdvance(g_Gpt_Sim_Access_Cycles);
+    return counter;
+}
+
+/*********************************************************************************************/
+uint32 Gpt_SimTimestampReadOverflow(void)
+{
+    uint32 overflow;
+
+    Gpt_SimTimestampAdvance(g_Gpt_Sim_Access_Cycles);
+    overflow = g_Gpt_Sim_Overflow ? GPT_TIMESTAMP_OVERFLOW_MASK : 0;
+    Gpt_SimTimestampAdvance(g_Gpt_Sim_Access_Cycles);
+    return overflow;
+}
+
+/*********************************************************************************************/
+void Gpt_SimTimestampSet(uint64 Cycles, uint32 AccessCycles)
+{
+    g_Gpt_Sim_Cycles        = Cycles;
+    g_Gpt_Sim_Access_Cycles = AccessCycles;
+    g_Gpt_Sim_Overflow      = FALSE;
+    g_Gpt_Timestamp_High    = (uint32)(Cycles >> 32);
+}
+
+/*********************************************************************************************/
+void Gpt_SimTimestampAdvance(uint64 Cycles)
+{
+    uint64 previous = g_Gpt_Sim_Cycles;
+
+    g_Gpt_Sim_Cycles += Cycles;
+    if((previous >> 32) != (g_Gpt_Sim_Cycles >> 32))
+    {
+        g_Gpt_Sim_Overflow = TRUE;
+    }
+    if(g_Gpt_Sim_Overflow && g_Gpt_Sim_Isr_Enabled)
+    {
+        /* The ISR clears the flag by its write to GPTMICR */
+        g_Gpt_Sim_Overflow = FALSE;
+        WideTimer5A_Handler();
+    }
+}
+
+/*********************************************************************************************/
+void Gpt_SimTimestampEnableIsr(boolean Enable)
+{
+    g_Gpt_Sim_Isr_Enabled = Enable;
+    Gpt_SimTimestampAdvance(0);
+}
+
+/*********************************************************************************************/
+uint64 Gpt_SimTimestampGetCycles(void)
+{
+    return g_Gpt_Sim_Cycles;
+}
+
+#if (CPU_SIM_INTERRUPTS == STD_ON)
+/*********************************************************************************************/
+uint32 Cpu_SimEnterCritical(void)
+{
+    uint32 state = g_Cpu_Sim_Masked;
+
+    g_Cpu_Sim_Masked = 1U;
+    if(g_Cpu_Sim_Raised_Isr != NULL_PTR)
+    {
+        g_Cpu_Sim_Pending_Isr = g_Cpu_Sim_Raised_Isr;
+        g_Cpu_Sim_Raised_Isr  = NULL_PTR;
+    }
+    return state;
+}
+
+/*********************************************************************************************/
+void Cpu_SimExitCritical(uint32 State)
+{
+    void (*isr)(void) = g_Cpu_Sim_Pending_Isr;
+
+    g_Cpu_Sim_Masked = State;
+    if((g_Cpu_Sim_Masked == 0U) && (isr != NULL_PTR))
+    {
+        g_Cpu_Sim_Pending_Isr = NULL_PTR;
+        isr();
+    }
+}
+
+/*********************************************************************************************/
+void Cpu_SimRaiseIsr(void (*Isr)(void))
+{
+    g_Cpu_Sim_Raised_Isr = Isr;
+}
+#endif
@@ -0,0 +1,51 @@
+ /******************************************************************************
+ *
+ * Module: Host Simulation
+ *
+ * File Name: Gpt_Sim.h
+ *
+ * Description: Header file for the host simulation of the time of the Gpt Driver
+ *              and of the Gpt Timestamp Service.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef GPT_SIM_H
+#define GPT_SIM_H
+
+#include "Gpt.h"
+#include "Gpt_Timestamp.h"
+#include "Cpu.h"
+
+/* Description: Advance the virtual time by one SysTick period and call the SysTick ISR.
+ *              Return FALSE if the SysTick Timer is stopped */
+boolean SysTick_SimTick(void);
+
+/* Description: Advance the virtual time by Cycles System clock cycles on the simulated timers,
+ *              the ISRs of the SysTick and of the timers run at their time-outs */
+void Gpt_SimElapse(uint32 Cycles);
+
+/* Description: Return the virtual time in ms since the simulation started */
+uint64 SysTick_SimGetTime(void);
+
+/* Description: Set the timestamp counter to Cycles with the wraps before it counted, no wrap pending.
+ *              Every read of the counter or of the overflow flag then advances it by AccessCycles before
+ *              and after it samples the register, the overflow ISR can run at both points */
+void Gpt_SimTimestampSet(uint64 Cycles, uint32 AccessCycles);
+
+/* Description: Advance the timestamp counter, the overflow ISR runs on a wrap unless it is disabled */
+void Gpt_SimTimestampAdvance(uint64 Cycles);
+
+/* Description: Enable or disable the overflow ISR, a pending wrap is counted when it is enabled */
+void Gpt_SimTimestampEnableIsr(boolean Enable);
+
+/* Description: Return the exact number of cycles counted by the simulated timestamp timer */
+uint64 Gpt_SimTimestampGetCycles(void);
+
+#if (CPU_SIM_INTERRUPTS == STD_ON)
+/* Description: Raise the ISR Isr right after the next Cpu_EnterCritical disables the interrupts,
+ *              it runs once Cpu_ExitCritical enables them again */
+void Cpu_SimRaiseIsr(void (*Isr)(void));
+#endif
+
+#endif /* GPT_SIM_H */
@@ -0,0 +1,20 @@
+ /******************************************************************************
+ *
+ * Module: Host Simulation
+ *
+ * File Name: Mcu_Sim.c
+ *
+ * Description: Host simulation of the clock services of the Mcu Driver used by
+ *              the other drivers. The System clock is the one main sets on the
+ *              target before the Os starts.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "Mcu.h"
+
+/*********************************************************************************************/
+uint32 Mcu_GetSysClockFrequency(void)
+{
+    return McuConf_CORE_CLOCK_FREQUENCY;
+}
@@ -0,0 +1,1116 @@
+ /******************************************************************************
+ *
+ * Module: Host Simulation
+ *
+ * File Name: Os_Sim.c
+ *
+ * Description: Accelerated-time host simulation of the Os Scheduler and the
+ *              application tasks. Every time the scheduler is idle the virtual
+ *              time jumps to the next SysTick, so days of scheduling run in seconds.
+ *              SysTick and its subscribers run from Gpt.c on the simulated registers.
+ *              The button is pressed and released periodically and every
+ *              press shall toggle the LED exactly once. Every second press is held
+ *              APP_LONG_PRESS_TIME longer, and the protothread of Press_Task shall
+ *              wake up by the press event, after its delay and by the release
+ *              mailbox in the ticks its task is activated.
+ *              The 64-bit timestamp is read at every cycle around its wraps
+ *              with the overflow ISR running, interleaved and held off.
+ *              The conversions to ns stay exact for centuries of ticks.
+ *              The busy-waits are timed on the same counter across a wrap.
+ *              The Gpt channels count down on the simulated GPTM timers in one-shot
+ *              and continuous modes, the heartbeat started by the Init Task counts
+ *              every second of the run.
+ *              The Icu measures the pulses driven on its CCP pin to the cycle, and a
+ *              pulse shorter than the capture ISR latency is counted lost.
+ *              The Det log keeps the last errors in order across a warm reset
+ *              and the Det counters count every error the drivers report. An error
+ *              reported by an ISR while the counters are reset counts from 1.
+ *              The Port and Dio Drivers run unmodified on the simulated registers
+ *              of RegSim.c without a faulting access.
+ *              The Init Task runs for a few SysTick periods, elapsed by its register
+ *              accesses, and the first task activations follow one period after it.
+ *              The cycle counter counts the virtual time and Button_Task takes a known
+ *              execution time, changing every hyperperiod, so the CPU load monitor shall
+ *              measure the exact load, sliding average and peak tick of every hyperperiod.
+ *
+ *              Build: gcc -O2 -DHOST_BUILD -DCPU_SIM_CYCLE_COUNTER=STD_ON -DCPU_SIM_INTERRUPTS=STD_ON
+ *                         -I. -I"../IAR Workspace" Os_Sim.c Gpt_Sim.c Mcu_Sim.c RegSim.c
+ *                         RegAccess_Report.c "../IAR Workspace/Gpt.c" "../IAR Workspace/Gpt_PBcfg.c"
+ *                         "../IAR Workspace/Os.c" "../IAR Workspace/Os_PBcfg.c" "../IAR Workspace/Os_Trace.c"
+ *                         "../IAR Workspace/Os_Timer.c" "../IAR Workspace/Os_Mailbox.c"
+ *                         "../IAR Workspace/App.c" "../IAR Workspace/Button.c" "../IAR Workspace/Led.c"
+ *                         "../IAR Workspace/Port.c" "../IAR Workspace/Port_PBcfg.c"
+ *                         "../IAR Workspace/Dio.c" "../IAR Workspace/Dio_PBcfg.c"
+ *                         "../IAR Workspace/Icu.c" "../IAR Workspace/Icu_PBcfg.c"
+ *                         "../IAR Workspace/Det.c" "../IAR Workspace/Reg_Access.c" -o Os_Sim
+ *              Add -DREG_ACCESS_STATS=STD_ON to print the register accesses of every service.
+ *              Usage: Os_Sim [hyperperiods] [press ms] [release ms] [init ticks]
+ *              Exit status is 0 when the LED toggled once per button press and every check passed.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "Os.h"
+#include "Gpt_Sim.h"
+#include "RegSim.h"
+#include "RegAccess_Report.h"
+#include "Dio.h"
+#include "Button.h"
+#include "Cpu.h"
+#include "Os_Trace.h"
+#include "Det.h"
+#include "App.h"
+#include "Mcu.h"
+#include "Icu.h"
+#include "Port.h"
+
+#if (CPU_SIM_CYCLE_COUNTER == STD_OFF)
+  #error "Os_Sim times the tasks in virtual time, build it with -DCPU_SIM_CYCLE_COUNTER=STD_ON"
+#endif
+
+#if (CPU_SIM_INTERRUPTS == STD_OFF)
+  #error "Os_Sim raises ISRs in the critical sections, build it with -DCPU_SIM_INTERRUPTS=STD_ON"
+#endif
+
+/* Default simulation parameters */
+#define SIM_DEFAULT_HYPERPERIODS    (100000U)
+#define SIM_DEFAULT_PRESS_TIME      (200U)
+#define SIM_DEFAULT_RELEASE_TIME    (200U)
+#define SIM_DEFAULT_INIT_TICKS      (3U)
+
+/* Samples of Button_Task before it reports a new button level */
+#define SIM_BUTTON_DEBOUNCE_TICKS   (3U)
+
+/* Ticks of the Press_Task period and of its long press delay */
+#define SIM_PRESS_TASK_TICKS        (OsConf_PRESS_TASK_PERIOD / OS_BASE_TIME)
+#define SIM_LONG_PRESS_TICKS        ((APP_LONG_PRESS_TIME + OS_BASE_TIME - 1U) / OS_BASE_TIME)
+
+/* Ticks of one hyperperiod */
+#define SIM_HYPERPERIOD_TICKS       (OS_HYPERPERIOD / OS_BASE_TIME)
+
+/* Execution time in us of Button_Task in the hyperperiod h: SIM_TASK_COST_US * (1 + h % SIM_TASK_COST_STEPS),
+ * up to its budget. The other tasks take no virtual time */
+#define SIM_TASK_COST_US            (20U)
+#define SIM_TASK_COST_STEPS         (5U)
+
+/* Register accesses of the Init Task elapsing one SysTick period */
+#define SIM_INIT_ACCESSES_PER_TICK  (32U)
+
+/* Divisor and phase of the SysTick subscriber checked by the simulation */
+#define SIM_SUBSCRIBER_DIVISOR      (7U)
+#define SIM_SUBSCRIBER_PHASE        (3U)
+
+/* Reads of the timestamp checked before and after each wrap */
+#define SIM_TIMESTAMP_WRAP_READS    (48U)
+
+/* Time from the wrap the overflow ISR is held off in the pending wrap check */
+#define SIM_TIMESTAMP_PENDING_TIME  (0x7FFFFF00U)
+
+/* Years of timestamp ticks converted in the conversion check, beyond the 7 years of a 64-bit product */
+#define SIM_CONVERSION_YEARS        (500U)
+
+/* Delay checked across a wrap and cycles elapsed by every simulated read of the counter */
+#define SIM_DELAY_US                (100U)
+#define SIM_DELAY_ACCESS_CYCLES     (7U)
+
+/* Start value of the Gpt channel checks and the ticks elapsed before their first reads */
+#define SIM_GPT_START_VALUE         (1000U)
+#define SIM_GPT_FIRST_TICKS         (400U)
+
+/* Whole periods of the continuous channel check */
+#define SIM_GPT_PERIODS             (3U)
+
+/* Pulses driven on the Icu channel in ms ... the edges fall on SysTick periods */
+#define SIM_ICU_PERIOD              (100U)
+#define SIM_ICU_ACTIVE              (40U)
+
+/* Complete periods measured after the short pulse of the lost edge check */
+#define SIM_ICU_PERIODS             (3U)
+
+/* Errors reported in the Det log check, enough to wrap the ring buffer */
+#define SIM_DET_ERRORS              (DET_LOG_SIZE + 3U)
+
+/* Description: Error a driver can report, counted by its own Det counter */
+typedef struct
+{
+    uint16 module_id;
+    uint8 api_id;
+    uint8 error_id;
+}Sim_DetErrorType;
+
+/* Every service and error reported by the drivers, the keys of DET_REPORTED_ERRORS counters */
+static const Sim_DetErrorType Sim_DetErrors[] =
+{
+    {PORT_MODULE_ID, PORT_INIT_SID,                    PORT_E_PARAM_CONFIG},
+    {PORT_MODULE_ID, PORT_SET_PIN_DIRECTION_SID,       PORT_E_UNINIT},
+    {PORT_MODULE_ID, PORT_SET_PIN_DIRECTION_SID,       PORT_E_PARAM_PIN},
+    {PORT_MODULE_ID, PORT_SET_PIN_DIRECTION_SID,       PORT_E_DIRECTION_UNCHANGEABLE},
+    {PORT_MODULE_ID, PORT_REFRESH_PORT_DIRECTION_SID,  PORT_E_UNINIT},
+    {PORT_MODULE_ID, PORT_GET_VERSION_INFO_SID,        PORT_E_PARAM_POINTER},
+    {PORT_MODULE_ID, PORT_SET_PIN_MODE_SID,            PORT_E_UNINIT},
+    {PORT_MODULE_ID, PORT_SET_PIN_MODE_SID,            PORT_E_PARAM_PIN},
+    {PORT_MODULE_ID, PORT_SET_PIN_MODE_SID,            PORT_E_MODE_UNCHANGEABLE},
+    {DIO_MODULE_ID,  DIO_INIT_SID,                     DIO_E_PARAM_CONFIG},
+    {DIO_MODULE_ID,  DIO_READ_CHANNEL_SID,             DIO_E_UNINIT},
+    {DIO_MODULE_ID,  DIO_READ_CHANNEL_SID,             DIO_E_PARAM_INVALID_CHANNEL_ID},
+    {DIO_MODULE_ID,  DIO_WRITE_CHANNEL_SID,            DIO_E_UNINIT},
+    {DIO_MODULE_ID,  DIO_WRITE_CHANNEL_SID,            DIO_E_PARAM_INVALID_CHANNEL_ID},
+    {DIO_MODULE_ID,  DIO_FLIP_CHANNEL_SID,             DIO_E_UNINIT},
+    {DIO_MODULE_ID,  DIO_FLIP_CHANNEL_SID,             DIO_E_PARAM_INVALID_CHANNEL_ID},
+    {DIO_MODULE_ID,  DIO_GET_VERSION_INFO_SID,         DIO_E_PARAM_POINTER},
+    {GPT_MODULE_ID,  GPT_GET_VERSION_INFO_SID,         GPT_E_PARAM_POINTER},
+    {GPT_MODULE_ID,  GPT_INIT_SID,                     GPT_E_ALREADY_INITIALIZED},
+    {GPT_MODULE_ID,  GPT_INIT_SID,                     GPT_E_PARAM_CONFIG},
+    {GPT_MODULE_ID,  GPT_DEINIT_SID,                   GPT_E_UNINIT},
+    {GPT_MODULE_ID,  GPT_DEINIT_SID,                   GPT_E_BUSY},
+    {GPT_MODULE_ID,  GPT_GET_TIME_ELAPSED_SID,         GPT_E_UNINIT},
+    {GPT_MODULE_ID,  GPT_GET_TIME_ELAPSED_SID,         GPT_E_PARAM_CHANNEL},
+    {GPT_MODULE_ID,  GPT_GET_TIME_REMAINING_SID,       GPT_E_UNINIT},
+    {GPT_MODULE_ID,  GPT_GET_TIME_REMAINING_SID,       GPT_E_PARAM_CHANNEL},
+    {GPT_MODULE_ID,  GPT_START_TIMER_SID,              GPT_E_UNINIT},
+    {GPT_MODULE_ID,  GPT_START_TIMER_SID,              GPT_E_PARAM_CHANNEL},
+    {GPT_MODULE_ID,  GPT_START_TIMER_SID,              GPT_E_PARAM_VALUE},
+    {GPT_MODULE_ID,  GPT_START_TIMER_SID,              GPT_E_BUSY},
+    {GPT_MODULE_ID,  GPT_STOP_TIMER_SID,               GPT_E_UNINIT},
+    {GPT_MODULE_ID,  GPT_STOP_TIMER_SID,               GPT_E_PARAM_CHANNEL},
+    {GPT_MODULE_ID,  GPT_ENABLE_NOTIFICATION_SID,      GPT_E_UNINIT},
+    {GPT_MODULE_ID,  GPT_ENABLE_NOTIFICATION_SID,      GPT_E_PARAM_CHANNEL},
+    {GPT_MODULE_ID,  GPT_DISABLE_NOTIFICATION_SID,     GPT_E_UNINIT},
+    {GPT_MODULE_ID,  GPT_DISABLE_NOTIFICATION_SID,     GPT_E_PARAM_CHANNEL},
+    {ICU_MODULE_ID,  ICU_INIT_SID,                     ICU_E_ALREADY_INITIALIZED},
+    {ICU_MODULE_ID,  ICU_INIT_SID,                     ICU_E_PARAM_CONFIG},
+    {ICU_MODULE_ID,  ICU_GET_DUTY_CYCLE_VALUES_SID,    ICU_E_UNINIT},
+    {ICU_MODULE_ID,  ICU_GET_DUTY_CYCLE_VALUES_SID,    ICU_E_PARAM_CHANNEL},
+    {ICU_MODULE_ID,  ICU_GET_DUTY_CYCLE_VALUES_SID,    ICU_E_PARAM_BUFFER_PTR},
+    {ICU_MODULE_ID,  ICU_GET_VERSION_INFO_SID,         ICU_E_PARAM_VINFO},
+    {ICU_MODULE_ID,  ICU_START_SIGNAL_MEASUREMENT_SID, ICU_E_UNINIT},
+    {ICU_MODULE_ID,  ICU_START_SIGNAL_MEASUREMENT_SID, ICU_E_PARAM_CHANNEL},
+    {ICU_MODULE_ID,  ICU_STOP_SIGNAL_MEASUREMENT_SID,  ICU_E_UNINIT},
+    {ICU_MODULE_ID,  ICU_STOP_SIGNAL_MEASUREMENT_SID,  ICU_E_PARAM_CHANNEL},
+    {ICU_MODULE_ID,  ICU_STOP_SIGNAL_MEASUREMENT_SID,  ICU_E_NOT_STARTED},
+    {ICU_MODULE_ID,  ICU_GET_STATISTICS_SID,           ICU_E_UNINIT},
+    {ICU_MODULE_ID,  ICU_GET_STATISTICS_SID,           ICU_E_PARAM_CHANNEL},
+    {ICU_MODULE_ID,  ICU_GET_STATISTICS_SID,           ICU_E_PARAM_BUFFER_PTR},
+    {MCU_MODULE_ID,  MCU_INIT_SID,                     MCU_E_PARAM_CONFIG},
+    {MCU_MODULE_ID,  MCU_INIT_CLOCK_SID,               MCU_E_UNINIT},
+    {MCU_MODULE_ID,  MCU_INIT_CLOCK_SID,               MCU_E_PARAM_CLOCK},
+    {MCU_MODULE_ID,  MCU_INIT_CLOCK_SID,               MCU_E_CLOCK_FAILURE},
+    {MCU_MODULE_ID,  MCU_DISTRIBUTE_PLL_CLOCK_SID,     MCU_E_UNINIT},
+    {MCU_MODULE_ID,  MCU_DISTRIBUTE_PLL_CLOCK_SID,     MCU_E_PLL_NOT_LOCKED},
+    {MCU_MODULE_ID,  MCU_GET_PLL_STATUS_SID,           MCU_E_UNINIT},
+    {MCU_MODULE_ID,  MCU_GET_VERSION_INFO_SID,         MCU_E_PARAM_POINTER}
+};
+
+#define SIM_DET_ERRORS_NUM          (sizeof(Sim_DetErrors) / sizeof(Sim_DetErrors[0]))
+
+/* Errors reported beyond the counters of the hash table in the Det counter check */
+#define SIM_DET_OVERFLOW_ERRORS     (2U * DET_COUNTER_TABLE_SIZE)
+
+/* Time without stimulus at the end of the run to let the last press reach the LED */
+#define SIM_SETTLE_TIME             (10U * OS_HYPERPERIOD)
+
+/* Simulation parameters in ms */
+static uint64 g_Sim_End_Time;
+static uint32 g_Sim_Press_Time;
+static uint32 g_Sim_Release_Time;
+
+/* SysTick periods elapsed by the Init Task, those left and those counted by the Os once it completed */
+static uint32 g_Sim_Init_Ticks;
+static uint32 g_Sim_Init_Ticks_Left;
+static Os_TickType g_Sim_Init_Ticks_Counted = 0;
+static uint32 g_Sim_Init_Accesses = 0;
+static boolean g_Sim_Init_Done = FALSE;
+
+/* Number of the button presses applied by the simulation */
+static uint32 g_Sim_Presses = 0;
+
+/* Ticks Button_Task reports the last press and release, the long presses expected and the wrong wake-ups */
+static Os_TickType g_Sim_Press_Report_Tick = 0;
+static Os_TickType g_Sim_Release_Report_Tick = 0;
+static uint32 g_Sim_Long_Presses = 0;
+static uint32 g_Sim_Timed_Presses = 0;
+static uint32 g_Sim_Press_Wakeups_Wrong = 0;
+
+/* The wake-ups are checked when the thread timed every press before the next one is reported */
+static boolean g_Sim_Press_Thread_Checked;
+
+/* Button press to LED toggle latency in ms */
+static uint64 g_Sim_Press_Start = 0;
+static uint32 g_Sim_Led_Toggles = 0;
+static uint64 g_Sim_Latency_Sum = 0;
+static uint64 g_Sim_Latency_Max = 0;
+
+/* SysTick subscriber calls and the ticks they happened in */
+static uint32 g_Sim_Subscriber_Calls = 0;
+static uint32 g_Sim_Subscriber_Misplaced = 0;
+
+/* Pulses driven on the Icu channel and the measured periods, the lost and the wrong ones */
+static uint32 g_Sim_Icu_Pulses = 0;
+static uint32 g_Sim_Icu_Samples = 0;
+static uint32 g_Sim_Icu_Lost = 0;
+static uint32 g_Sim_Icu_Wrong = 0;
+
+/* Hyperperiods of the CPU load monitor checked, the expected loads of the sliding window and the wrong figures */
+static uint32 g_Sim_Load_Checked = 0;
+static uint16 g_Sim_Load_History[OS_CPU_LOAD_WINDOW];
+static uint32 g_Sim_Load_Sum = 0;
+static uint16 g_Sim_Load_Peak_Max = 0;
+static uint32 g_Sim_Load_Wrong = 0;
+
+/* Last timestamp read by the idle hook and the reads going backwards */
+static Gpt_TimestampType g_Sim_Timestamp_Last = 0;
+static uint32 g_Sim_Timestamp_Backwards = 0;
+
+/*********************************************************************************************/
+static void Sim_ApplyStimulus(uint64 Time)
+{
+    Dio_LevelType level = BUTTON_RELEASED;
+    uint32 short_cycle = g_Sim_Release_Time + g_Sim_Press_Time;
+    uint64 phase = Time % ((2U * short_cycle) + APP_LONG_PRESS_TIME);
+
+    /* A short press followed by a long one, held APP_LONG_PRESS_TIME longer */
+    if(Time < (g_Sim_End_Time - SIM_SETTLE_TIME))
+    {
+        if(((phase >= g_Sim_Release_Time) && (phase < short_cycle)) || (phase >= (short_cycle + g_Sim_Release_Time)))
+        {
+            level = BUTTON_PRESSED;
+        }
+    }
+
+    if(level != RegSim_GetPinLevel(BUTTON_PORT, BUTTON_PIN_NUM))
+    {
+        if(level == BUTTON_PRESSED)
+        {
+            g_Sim_Presses++;
+            g_Sim_Press_Start = Time;
+            g_Sim_Press_Report_Tick = Os_GetTickCount() + SIM_BUTTON_DEBOUNCE_TICKS;
+        }
+        else
+        {
+            g_Sim_Release_Report_Tick = Os_GetTickCount() + SIM_BUTTON_DEBOUNCE_TICKS;
+        }
+        RegSim_SetPinLevel(BUTTON_PORT, BUTTON_PIN_NUM, level);
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Return the first periodic activation of Press_Task at or after Tick,
+ *              the first one follows one period after the Init Task */
+static Os_TickType Sim_NextPressActivation(Os_TickType Tick)
+{
+    Os_TickType offset = (Tick - g_Sim_Init_Ticks_Counted) % SIM_PRESS_TASK_TICKS;
+
+    return (offset == 0) ? Tick : (Tick + SIM_PRESS_TASK_TICKS - offset);
+}
+
+/*********************************************************************************************/
+/* Description: Check the wake-ups of the Press_Task protothread once it timed a press */
+static void Sim_CheckPressThread(void)
+{
+    App_PressStatsType stats;
+    Os_TickType delay_tick;
+    Os_TickType release_tick;
+
+    App_GetPressStats(&stats);
+    if(stats.presses == g_Sim_Timed_Presses)
+    {
+        return;
+    }
+    g_Sim_Timed_Presses = stats.presses;
+
+    /* The press event activates the task in the tick Button_Task reports the press,
+     * the delay and the mailbox wait continue on its periodic activations */
+    delay_tick   = Sim_NextPressActivation(g_Sim_Press_Report_Tick + SIM_LONG_PRESS_TICKS);
+    release_tick = Sim_NextPressActivation((g_Sim_Release_Report_Tick > delay_tick) ? g_Sim_Release_Report_Tick : delay_tick);
+    if(g_Sim_Release_Report_Tick > delay_tick)
+    {
+        g_Sim_Long_Presses++;
+    }
+
+    if((stats.press_tick != g_Sim_Press_Report_Tick) || (stats.delay_tick != delay_tick) ||
+       (stats.release_tick != release_tick) || (stats.long_presses != g_Sim_Long_Presses))
+    {
+        g_Sim_Press_Wakeups_Wrong++;
+    }
+}
+
+/*********************************************************************************************/
+static void Sim_SetIcuInput(Dio_LevelType Level)
+{
+    const Icu_ConfigChannel * channel = &Icu_Configuration.Channels[IcuConf_PULSE_IN_CHANNEL_ID];
+
+    RegSim_SetPinLevel(channel->port_num, (uint8)channel->pin_num, Level);
+}
+
+/*********************************************************************************************/
+static void Sim_ApplyPulses(void)
+{
+    const Icu_ConfigChannel * channel = &Icu_Configuration.Channels[IcuConf_PULSE_IN_CHANNEL_ID];
+    uint64 time = SysTick_SimGetTime();
+    Dio_LevelType level = ((time % SIM_ICU_PERIOD) < SIM_ICU_ACTIVE) ? STD_HIGH : STD_LOW;
+
+    /* Called from the SysTick ISR ... the edges fall right on the ticks whatever time the tasks take */
+    if(level != RegSim_GetPinLevel(channel->port_num, (uint8)channel->pin_num))
+    {
+        /* A pulse starts only at the start of its period, not in the middle of the one the Init Task ended in */
+        if((level == STD_HIGH) && ((time % SIM_ICU_PERIOD) != 0))
+        {
+            return;
+        }
+        if(level == STD_HIGH)
+        {
+            g_Sim_Icu_Pulses++;
+        }
+        Sim_SetIcuInput(level);
+    }
+}
+
+/*********************************************************************************************/
+static void Sim_MeasurePulses(void)
+{
+    uint32 period = (uint32)(((uint64)Mcu_GetSysClockFrequency() * SIM_ICU_PERIOD) / 1000U);
+    uint32 active = (uint32)(((uint64)Mcu_GetSysClockFrequency() * SIM_ICU_ACTIVE) / 1000U);
+    Icu_StatisticsType statistics;
+
+    /* Every period is the same ... a batch shall not hold another one */
+    if(E_OK == Icu_GetStatistics(IcuConf_PULSE_IN_CHANNEL_ID, &statistics))
+    {
+        if((statistics.period_min != period) || (statistics.period_max != period) || (statistics.active_mean != active))
+        {
+            g_Sim_Icu_Wrong++;
+        }
+    }
+    g_Sim_Icu_Samples += statistics.samples;
+    g_Sim_Icu_Lost    += statistics.lost;
+}
+
+/*********************************************************************************************/
+static void Sim_MeasureLatency(uint64 Time)
+{
+    uint32 toggles = RegSim_GetEdgeCount(DioConf_LED1_PORT_NUM, DioConf_LED1_CHANNEL_NUM);
+    uint64 latency;
+
+    if(toggles != g_Sim_Led_Toggles)
+    {
+        latency = Time - g_Sim_Press_Start;
+        g_Sim_Latency_Sum += latency;
+        if(latency > g_Sim_Latency_Max)
+        {
+            g_Sim_Latency_Max = latency;
+        }
+        g_Sim_Led_Toggles = toggles;
+    }
+}
+
+/*********************************************************************************************/
+static void Sim_SysTickSubscriber(void)
+{
+    /* Called from the SysTick ISR after the Os counted the tick ... the first call is in tick PHASE + 1 */
+    g_Sim_Subscriber_Calls++;
+    if((Os_GetTickCount() % SIM_SUBSCRIBER_DIVISOR) != ((SIM_SUBSCRIBER_PHASE + 1U) % SIM_SUBSCRIBER_DIVISOR))
+    {
+        g_Sim_Subscriber_Misplaced++;
+    }
+}
+
+/*********************************************************************************************/
+static void Sim_InitAccessHook(uint32 Address)
+{
+    (void)Address;
+
+    /* Every SIM_INIT_ACCESSES_PER_TICK register accesses of the Init Task take one SysTick period */
+    if((g_Sim_Init_Ticks_Left > 0) && ((++g_Sim_Init_Accesses % SIM_INIT_ACCESSES_PER_TICK) == 0))
+    {
+        g_Sim_Init_Ticks_Left--;
+        (void)SysTick_SimTick();
+    }
+}
+
+/*********************************************************************************************/
+static uint32 Sim_CheckTimestampRead(void)
+{
+    uint64 before = Gpt_SimTimestampGetCycles();
+    Gpt_TimestampType timestamp = Gpt_GetTicks();
+
+    /* The counter is sampled during the read ... the timestamp is between the cycles before and after it */
+    return ((timestamp < before) || (timestamp >= Gpt_SimTimestampGetCycles())) ? 1U : 0U;
+}
+
+/*********************************************************************************************/
+static uint32 Sim_CheckTimestampWrap(void)
+{
+    static const uint32 access_cycles[] = {1, 2, 3, 5};
+    uint32 errors = 0;
+    uint32 wrap, isr, access, read;
+    uint64 start;
+
+    for(wrap = 1; wrap <= 3; wrap++)
+    {
+        for(isr = 0; isr < 2; isr++)
+        {
+            Gpt_SimTimestampEnableIsr((boolean)isr);
+            for(access = 0; access < (sizeof(access_cycles) / sizeof(access_cycles[0])); access++)
+            {
+                /* Start every read one cycle later so the wrap falls between every pair of register reads */
+                for(read = 0; read < SIM_TIMESTAMP_WRAP_READS; read++)
+                {
+                    start = ((uint64)wrap << 32) - (SIM_TIMESTAMP_WRAP_READS / 2U) + read;
+                    Gpt_SimTimestampSet(start, access_cycles[access]);
+                    errors += Sim_CheckTimestampRead();
+                }
+            }
+        }
+        /* Overflow ISR held off for almost half a wrap ... the pending flag completes the read */
+        Gpt_SimTimestampEnableIsr(FALSE);
+        Gpt_SimTimestampSet(((uint64)wrap << 32) - 1U, 1);
+        Gpt_SimTimestampAdvance(SIM_TIMESTAMP_PENDING_TIME);
+        errors += Sim_CheckTimestampRead();
+        Gpt_SimTimestampEnableIsr(TRUE);
+        errors += Sim_CheckTimestampRead();
+    }
+    return errors;
+}
+
+/*********************************************************************************************/
+static uint32 Sim_CheckConversions(void)
+{
+    uint32 errors = 0;
+    uint32 rest;
+    Gpt_TimestampType ticks;
+
+    /* The conversions of every tick in a us, once from 0 and once centuries later */
+    for(rest = 0; rest < (2U * GPT_TIMESTAMP_TICKS_PER_US); rest++)
+    {
+        ticks = (rest < GPT_TIMESTAMP_TICKS_PER_US) ? rest :
+                (((uint64)SIM_CONVERSION_YEARS * 365U * 24U * 3600U * GPT_TIMESTAMP_FREQUENCY) + rest);
+        if((Gpt_TicksToNs(ticks) != (uint64)(((unsigned __int128)ticks * 1000U) / GPT_TIMESTAMP_TICKS_PER_US)) ||
+           (Gpt_TicksToUs(ticks) != (ticks / GPT_TIMESTAMP_TICKS_PER_US)) ||
+           (Gpt_NsToTicks(Gpt_TicksToNs(ticks)) != ticks))
+        {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+/*********************************************************************************************/
+static uint32 Sim_CheckDelay(void)
+{
+    uint32 errors = 0;
+    uint32 deadline;
+    uint32 edge;
+    uint64 start;
+    uint64 elapsed;
+
+    /* Gpt_DelayUs returns after the time and before two more reads of the counter */
+    Gpt_SimTimestampSet((1ULL << 32) - (GPT_US_TO_TICKS(SIM_DELAY_US) / 2U), SIM_DELAY_ACCESS_CYCLES);
+    start = Gpt_SimTimestampGetCycles();
+    Gpt_DelayUs(SIM_DELAY_US);
+    elapsed = Gpt_SimTimestampGetCycles() - start;
+    if((elapsed < GPT_US_TO_TICKS(SIM_DELAY_US)) || (elapsed > (GPT_US_TO_TICKS(SIM_DELAY_US) + (4U * SIM_DELAY_ACCESS_CYCLES))))
+    {
+        errors++;
+    }
+
+    /* Edges on a deadline grid do not drift with the read cost */
+    deadline = Gpt_GetTicks32();
+    start    = Gpt_SimTimestampGetCycles();
+    for(edge = 1; edge <= 16; edge++)
+    {
+        deadline += GPT_NS_TO_TICKS(2500);
+        Gpt_WaitUntil(deadline);
+        elapsed = Gpt_SimTimestampGetCycles() - start;
+        if((elapsed < ((uint64)edge * GPT_NS_TO_TICKS(2500))) ||
+           (elapsed > (((uint64)edge * GPT_NS_TO_TICKS(2500)) + (4U * SIM_DELAY_ACCESS_CYCLES))))
+        {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+/*********************************************************************************************/
+static uint32 Sim_CheckGpt(void)
+{
+    uint32 errors = 0;
+    uint32 det_errors = Det_GetErrorCount();
+    uint32 heartbeats;
+
+    /* The channel counts on the simulated GPTM registers ... its ticks are System clock cycles */
+    Gpt_Init(&Gpt_Configuration);
+    Gpt_StartTimer(GptConf_IO_TIMER_CHANNEL_ID, SIM_GPT_START_VALUE);
+    if((Gpt_GetTimeElapsed(GptConf_IO_TIMER_CHANNEL_ID) != 0) ||
+       (Gpt_GetTimeRemaining(GptConf_IO_TIMER_CHANNEL_ID) != SIM_GPT_START_VALUE))
+    {
+        errors++;
+    }
+
+    Gpt_SimElapse(SIM_GPT_FIRST_TICKS);
+    if((Gpt_GetTimeElapsed(GptConf_IO_TIMER_CHANNEL_ID) != SIM_GPT_FIRST_TICKS) ||
+       (Gpt_GetTimeRemaining(GptConf_IO_TIMER_CHANNEL_ID) != (SIM_GPT_START_VALUE - SIM_GPT_FIRST_TICKS)))
+    {
+        errors++;
+    }
+
+    /* The one-shot channel expires at its start value and keeps it as the elapsed time */
+    Gpt_SimElapse(SIM_GPT_START_VALUE - SIM_GPT_FIRST_TICKS);
+    if((Gpt_GetTimeElapsed(GptConf_IO_TIMER_CHANNEL_ID) != SIM_GPT_START_VALUE) ||
+       (Gpt_GetTimeRemaining(GptConf_IO_TIMER_CHANNEL_ID) != 0))
+    {
+        errors++;
+    }
+
+    /* The continuous channel restarts at every expiry and notifies each one */
+    heartbeats = App_GetHeartbeats();
+    Gpt_EnableNotification(GptConf_HEARTBEAT_CHANNEL_ID);
+    Gpt_StartTimer(GptConf_HEARTBEAT_CHANNEL_ID, SIM_GPT_START_VALUE);
+    Gpt_SimElapse((SIM_GPT_PERIODS * SIM_GPT_START_VALUE) + SIM_GPT_FIRST_TICKS);
+    if((Gpt_GetTimeElapsed(GptConf_HEARTBEAT_CHANNEL_ID) != SIM_GPT_FIRST_TICKS) ||
+       (Gpt_GetTimeRemaining(GptConf_HEARTBEAT_CHANNEL_ID) != (SIM_GPT_START_VALUE - SIM_GPT_FIRST_TICKS)) ||
+       ((App_GetHeartbeats() - heartbeats) != SIM_GPT_PERIODS))
+    {
+        errors++;
+    }
+
+    /* Right at the reload the elapsed time starts again from 0 */
+    Gpt_SimElapse(SIM_GPT_START_VALUE - SIM_GPT_FIRST_TICKS);
+    if((Gpt_GetTimeElapsed(GptConf_HEARTBEAT_CHANNEL_ID) != 0) ||
+       (Gpt_GetTimeRemaining(GptConf_HEARTBEAT_CHANNEL_ID) != SIM_GPT_START_VALUE) ||
+       ((App_GetHeartbeats() - heartbeats) != (SIM_GPT_PERIODS + 1U)))
+    {
+        errors++;
+    }
+
+    /* A stopped channel keeps its time, a disabled notification is not called */
+    Gpt_SimElapse(SIM_GPT_FIRST_TICKS);
+    Gpt_StopTimer(GptConf_HEARTBEAT_CHANNEL_ID);
+    Gpt_SimElapse(SIM_GPT_PERIODS * SIM_GPT_START_VALUE);
+    if((Gpt_GetTimeElapsed(GptConf_HEARTBEAT_CHANNEL_ID) != SIM_GPT_FIRST_TICKS) ||
+       (Gpt_GetTimeRemaining(GptConf_HEARTBEAT_CHANNEL_ID) != (SIM_GPT_START_VALUE - SIM_GPT_FIRST_TICKS)))
+    {
+        errors++;
+    }
+    Gpt_DisableNotification(GptConf_HEARTBEAT_CHANNEL_ID);
+    Gpt_StartTimer(GptConf_HEARTBEAT_CHANNEL_ID, SIM_GPT_START_VALUE);
+    Gpt_SimElapse(SIM_GPT_PERIODS * SIM_GPT_START_VALUE);
+    Gpt_StopTimer(GptConf_HEARTBEAT_CHANNEL_ID);
+    if((App_GetHeartbeats() - heartbeats) != (SIM_GPT_PERIODS + 1U))
+    {
+        errors++;
+    }
+
+    Gpt_DeInit();
+    return errors + (Det_GetErrorCount() - det_errors);
+}
+
+/*********************************************************************************************/
+static uint32 Sim_CheckDetLogRecord(uint32 Number)
+{
+    Det_RecordType record;
+
+    /* Every error of the check is module 0x100 + its number with a timestamp after its number of cycles */
+    if((Det_ReadRecord(Number, &record) != E_OK) || (record.sequence != (Number + 1U)) ||
+       (record.module_id != (uint16)(0x100U + Number)) || (record.instance_id != (uint8)Number) ||
+       (record.api_id != (uint8)(Number + 1U)) || (record.error_id != (uint8)(Number + 2U)) ||
+       ((((uint64)record.timestamp_high << 32) | record.timestamp_low) < ((1ULL << 32) + Number)))
+    {
+        return 1;
+    }
+    return 0;
+}
+
+/*********************************************************************************************/
+static uint32 Sim_CheckDetLog(void)
+{
+    uint32 errors = 0;
+    uint32 number;
+    Det_RecordType record;
+
+    Det_Init();
+    Gpt_SimTimestampSet(1ULL << 32, 1);
+    for(number = 0; number < SIM_DET_ERRORS; number++)
+    {
+        Gpt_SimTimestampAdvance(1);
+        (void)Det_ReportError((uint16)(0x100U + number), (uint8)number, (uint8)(number + 1U), (uint8)(number + 2U));
+    }
+
+    /* The oldest errors are overwritten, the last DET_LOG_SIZE are kept in order */
+    if((Det_GetErrorCount() != SIM_DET_ERRORS) || (Det_ReadRecord(0, &record) != E_NOT_OK) ||
+       (Det_ReadRecord(SIM_DET_ERRORS, &record) != E_NOT_OK))
+    {
+        errors++;
+    }
+    for(number = SIM_DET_ERRORS - DET_LOG_SIZE; number < SIM_DET_ERRORS; number++)
+    {
+        errors += Sim_CheckDetLogRecord(number);
+    }
+
+    /* A warm reset keeps the log and counts the reset */
+    Det_Init();
+    if((Det_Log.resets != 1) || (Det_GetErrorCount() != SIM_DET_ERRORS))
+    {
+        errors++;
+    }
+    errors += Sim_CheckDetLogRecord(SIM_DET_ERRORS - 1U);
+
+    /* A log with a broken header is cleared as after a power up */
+    Det_Log.magic = 0;
+    Det_Init();
+    if((Det_Log.resets != 0) || (Det_GetErrorCount() != 0) || (Det_ReadRecord(SIM_DET_ERRORS - 1U, &record) != E_NOT_OK))
+    {
+        errors++;
+    }
+    return errors;
+}
+
+/*********************************************************************************************/
+/* Description: ISR reporting the first error of the drivers while Det_ResetCounters clears the counters */
+static void Sim_DetResetIsr(void)
+{
+    Gpt_SimTimestampAdvance(1);
+    (void)Det_ReportError(Sim_DetErrors[0].module_id, 0, Sim_DetErrors[0].api_id, Sim_DetErrors[0].error_id);
+}
+
+/*********************************************************************************************/
+/* Description: Reset the counters with an error reported by an ISR meanwhile ... it shall count from 1
+ *              in a free counter with its own timestamps */
+static uint32 Sim_CheckDetReset(void)
+{
+    uint32 errors = 0;
+    uint32 iterator = 0;
+    uint32 reports = Det_GetErrorCount();
+    uint64 before = Gpt_GetTicks();
+    Det_CounterType counter;
+
+    Cpu_SimRaiseIsr(Sim_DetResetIsr);
+    Det_ResetCounters();
+
+    if((Det_GetErrorCount() != (reports + 1U)) || (Det_GetNextCounter(&iterator, &counter) != E_OK) ||
+       (counter.module_id != Sim_DetErrors[0].module_id) || (counter.api_id != Sim_DetErrors[0].api_id) ||
+       (counter.error_id != Sim_DetErrors[0].error_id) || (counter.count != 1U) ||
+       (counter.first_timestamp <= before) || (counter.last_timestamp != counter.first_timestamp) ||
+       (Det_GetNextCounter(&iterator, &counter) != E_NOT_OK) || (Det_GetDroppedCount() != 0))
+    {
+        errors++;
+    }
+    return errors;
+}
+
+/*********************************************************************************************/
+static uint32 Sim_CheckDetCounters(void)
+{
+    uint32 errors = 0;
+    uint32 error, report, iterator, found;
+    Det_CounterType counter;
+
+    /* The table lists every error the drivers report ... Det_Cfg.h sizes the counters for them */
+    if(SIM_DET_ERRORS_NUM != DET_REPORTED_ERRORS)
+    {
+        errors++;
+    }
+
+    /* Error n of the drivers is reported n + 1 times, interleaved with the others */
+    Det_ResetCounters();
+    for(report = 0; report < SIM_DET_ERRORS_NUM; report++)
+    {
+        for(error = report; error < SIM_DET_ERRORS_NUM; error++)
+        {
+            Gpt_SimTimestampAdvance(1);
+            (void)Det_ReportError(Sim_DetErrors[error].module_id, 0, Sim_DetErrors[error].api_id,
+                                  Sim_DetErrors[error].error_id);
+        }
+    }
+    found    = 0;
+    iterator = 0;
+    while(Det_GetNextCounter(&iterator, &counter) == E_OK)
+    {
+        for(error = 0; error < SIM_DET_ERRORS_NUM; error++)
+        {
+            if((counter.module_id == Sim_DetErrors[error].module_id) && (counter.api_id == Sim_DetErrors[error].api_id) &&
+               (counter.error_id == Sim_DetErrors[error].error_id))
+            {
+                break;
+            }
+        }
+        if((error == SIM_DET_ERRORS_NUM) || (counter.count != (error + 1U)) || (counter.first_timestamp == 0) ||
+           ((counter.count > 1) && (counter.last_timestamp <= counter.first_timestamp)))
+        {
+            errors++;
+        }
+        found++;
+    }
+    if((found != SIM_DET_ERRORS_NUM) || (Det_GetDroppedCount() != 0))
+    {
+        errors++;
+    }
+
+    /* More errors than counters ... the reports beyond the table are only dropped */
+    for(report = 0; report < SIM_DET_OVERFLOW_ERRORS; report++)
+    {
+        (void)Det_ReportError((uint16)(0x300U + report), 0, 0, 2);
+    }
+    if(Det_GetDroppedCount() < (SIM_DET_OVERFLOW_ERRORS + SIM_DET_ERRORS_NUM - DET_COUNTER_TABLE_SIZE))
+    {
+        errors++;
+    }
+
+    /* The full table is reset with a report of an ISR in between */
+    errors += Sim_CheckDetReset();
+
+    Det_ResetCounters();
+    iterator = 0;
+    if((Det_GetNextCounter(&iterator, &counter) != E_NOT_OK) || (Det_GetDroppedCount() != 0))
+    {
+        errors++;
+    }
+    return errors;
+}
+
+/*********************************************************************************************/
+static uint32 Sim_CheckIcuLostEdge(void)
+{
+    uint32 period = (uint32)(((uint64)Mcu_GetSysClockFrequency() * SIM_ICU_PERIOD) / 1000U);
+    uint32 active = (uint32)(((uint64)Mcu_GetSysClockFrequency() * SIM_ICU_ACTIVE) / 1000U);
+    uint32 errors = 0;
+    uint32 pulse;
+    Icu_StatisticsType statistics;
+
+    Icu_StopSignalMeasurement(IcuConf_PULSE_IN_CHANNEL_ID);
+    Sim_SetIcuInput(STD_LOW);
+    Icu_StartSignalMeasurement(IcuConf_PULSE_IN_CHANNEL_ID);
+
+    /* Both edges before the capture ISR runs ... the falling edge is missed, not taken for a period start */
+    Sim_SetIcuInput(STD_HIGH);
+    Sim_SetIcuInput(STD_LOW);
+    Gpt_SimElapse(active);
+
+    /* Whole pulses after it are measured to the cycle */
+    for(pulse = 0; pulse <= SIM_ICU_PERIODS; pulse++)
+    {
+        Sim_SetIcuInput(STD_HIGH);
+        Gpt_SimElapse(active);
+        Sim_SetIcuInput(STD_LOW);
+        Gpt_SimElapse(period - active);
+    }
+    if((E_OK != Icu_GetStatistics(IcuConf_PULSE_IN_CHANNEL_ID, &statistics)) || (statistics.lost != 1U) ||
+       (statistics.samples != SIM_ICU_PERIODS) || (statistics.period_min != period) ||
+       (statistics.period_max != period) || (statistics.active_mean != active))
+    {
+        errors++;
+    }
+    Icu_StopSignalMeasurement(IcuConf_PULSE_IN_CHANNEL_ID);
+    return errors;
+}
+
+/*********************************************************************************************/
+/* Description: Return the host monotonic clock in ns ... the cycle counter of Cpu.h counts the virtual time */
+static uint64 Sim_GetWallTime(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64)now.tv_sec * 1000000000U) + (uint64)now.tv_nsec;
+}
+
+/*********************************************************************************************/
+/* Description: Return the execution time in ns of Button_Task in the hyperperiod Hyperperiod */
+static uint32 Sim_TaskCost(uint32 Hyperperiod)
+{
+    return SIM_TASK_COST_US * 1000U * (1U + (Hyperperiod % SIM_TASK_COST_STEPS));
+}
+
+/*********************************************************************************************/
+/* Description: Give the tasks their execution time ... the virtual time elapses while the task is running */
+void Os_PostTaskHook(Os_TaskType TaskId)
+{
+    uint32 hyperperiod = (Os_GetTickCount() - g_Sim_Init_Ticks_Counted - 1U) / SIM_HYPERPERIOD_TICKS;
+
+    if(TaskId == OsConf_BUTTON_TASK_ID)
+    {
+        Gpt_SimElapse((uint32)(((uint64)Sim_TaskCost(hyperperiod) * Mcu_GetSysClockFrequency()) / 1000000000U));
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Check the figures of every hyperperiod the CPU load monitor published */
+static void Sim_CheckCpuLoad(void)
+{
+    uint32 hyperperiod = g_Sim_Load_Checked;
+    uint32 cost;
+    uint32 elapsed;
+    uint16 expected_load;
+    uint16 expected_average;
+    uint16 expected_peak;
+    Os_CpuLoadType load;
+
+    (void)Os_GetCpuLoad(&load);
+    if(load.hyperperiods == g_Sim_Load_Checked)
+    {
+        return;
+    }
+    g_Sim_Load_Checked = load.hyperperiods;
+
+    /* Button_Task runs in every tick, the hyperperiod ends with the last one and starts with the end of
+     * the previous one, or with the end of the Init Task for the first */
+    cost    = Sim_TaskCost(hyperperiod);
+    elapsed = (OS_HYPERPERIOD * 1000000U) + cost - ((hyperperiod == 0) ? 0U : Sim_TaskCost(hyperperiod - 1U));
+    expected_load = (uint16)(((uint64)SIM_HYPERPERIOD_TICKS * cost * 1000U) / elapsed);
+    expected_peak = (uint16)(((uint64)cost * 1000U) / (OS_BASE_TIME * 1000000U));
+
+    g_Sim_Load_Sum -= g_Sim_Load_History[hyperperiod % OS_CPU_LOAD_WINDOW];
+    g_Sim_Load_Sum += expected_load;
+    g_Sim_Load_History[hyperperiod % OS_CPU_LOAD_WINDOW] = expected_load;
+    expected_average = (uint16)(g_Sim_Load_Sum / ((hyperperiod < OS_CPU_LOAD_WINDOW) ? (hyperperiod + 1U) : OS_CPU_LOAD_WINDOW));
+    if(expected_peak > g_Sim_Load_Peak_Max)
+    {
+        g_Sim_Load_Peak_Max = expected_peak;
+    }
+
+    if((load.hyperperiods != (hyperperiod + 1U)) || (load.load != expected_load) || (load.average != expected_average) ||
+       (load.peak_tick != expected_peak) || (load.peak_tick_max != g_Sim_Load_Peak_Max))
+    {
+        g_Sim_Load_Wrong++;
+    }
+}
+
+/*********************************************************************************************/
+void Os_IdleHook(void)
+{
+    uint64 now = SysTick_SimGetTime();
+    Gpt_TimestampType timestamp;
+
+    if(!g_Sim_Init_Done)
+    {
+        /* First idle hook ... the Init Task completed */
+        RegSim_SetAccessHook(NULL_PTR);
+        g_Sim_Init_Ticks_Counted = Os_GetTickCount();
+        /* The Init Task ends on a tick ... drive the pulses from there, then in every tick */
+        Sim_ApplyPulses();
+        (void)SysTick_Subscribe(Sim_ApplyPulses, 1U, 0U);
+        g_Sim_Init_Done = TRUE;
+    }
+
+    Sim_MeasureLatency(now);
+    Sim_MeasurePulses();
+    Sim_CheckPressThread();
+    Sim_CheckCpuLoad();
+
+    timestamp = Gpt_GetTicks();
+    if(timestamp < g_Sim_Timestamp_Last)
+    {
+        g_Sim_Timestamp_Backwards++;
+    }
+    g_Sim_Timestamp_Last = timestamp;
+
+    if(now >= g_Sim_End_Time)
+    {
+        Os_Shutdown();
+    }
+    else
+    {
+        /* Nothing left to run before the next tick ... jump to it in virtual time */
+        Sim_ApplyStimulus(now);
+        (void)SysTick_SimTick();
+    }
+}
+
+/*********************************************************************************************/
+int main(int argc, char * argv[])
+{
+    uint32 hyperperiods = SIM_DEFAULT_HYPERPERIODS;
+    uint64 wall_start, wall_time;
+    uint32 led_toggles;
+    uint32 timestamp_errors;
+    uint32 delay_errors;
+    uint32 gpt_errors;
+    uint32 heartbeats;
+    uint32 seconds;
+    uint32 det_errors;
+    uint32 icu_errors;
+    Os_TaskType task_id;
+    App_PressStatsType press_stats;
+#if (OS_PROFILING_API == STD_ON)
+    Os_TaskStatsType stats;
+#endif
+#if (OS_CPU_LOAD_API == STD_ON)
+    Os_CpuLoadType load;
+#endif
+
+    if(argc > 1)
+    {
+        hyperperiods = (uint32)strtoul(argv[1], NULL, 0);
+    }
+    g_Sim_Press_Time   = (argc > 2) ? (uint32)strtoul(argv[2], NULL, 0) : SIM_DEFAULT_PRESS_TIME;
+    g_Sim_Release_Time = (argc > 3) ? (uint32)strtoul(argv[3], NULL, 0) : SIM_DEFAULT_RELEASE_TIME;
+    g_Sim_Init_Ticks   = (argc > 4) ? (uint32)strtoul(argv[4], NULL, 0) : SIM_DEFAULT_INIT_TICKS;
+    g_Sim_End_Time     = ((uint64)hyperperiods * OS_HYPERPERIOD) + SIM_SETTLE_TIME;
+    g_Sim_Press_Thread_Checked = (boolean)(((g_Sim_Press_Time + g_Sim_Release_Time) > (APP_LONG_PRESS_TIME + OsConf_PRESS_TASK_PERIOD))
+                                        && (g_Sim_Release_Time > OsConf_PRESS_TASK_PERIOD));
+
+    RegSim_Reset();
+
+    /* The overflow ISR of the timestamp clears its flag in the clocked timer */
+    Gpt_TimestampInit();
+    timestamp_errors = Sim_CheckTimestampWrap() + Sim_CheckConversions();
+    delay_errors     = Sim_CheckDelay();
+    gpt_errors       = Sim_CheckGpt();
+    det_errors       = Sim_CheckDetLog() + Sim_CheckDetCounters();
+
+    (void)SysTick_Subscribe(Sim_SysTickSubscriber, SIM_SUBSCRIBER_DIVISOR, SIM_SUBSCRIBER_PHASE);
+
+    Gpt_SimTimestampSet(0, 0);
+    g_Sim_Init_Ticks_Left = g_Sim_Init_Ticks;
+    RegSim_SetAccessHook(Sim_InitAccessHook);
+
+    heartbeats = App_GetHeartbeats();
+    wall_start = Sim_GetWallTime();
+    Os_start();
+    wall_time = Sim_GetWallTime() - wall_start;
+
+    heartbeats  = App_GetHeartbeats() - heartbeats;
+    seconds     = (uint32)(SysTick_SimGetTime() / 1000U);
+    led_toggles = RegSim_GetEdgeCount(DioConf_LED1_PORT_NUM, DioConf_LED1_CHANNEL_NUM);
+    App_GetPressStats(&press_stats);
+
+    /* The Os is shut down ... stop its tick so the Icu check elapses the timers alone */
+    Sim_MeasurePulses();
+    SysTick_Stop();
+    icu_errors = Sim_CheckIcuLostEdge();
+
+    printf("virtual time      : %llu ms (%llu ticks)\n", (unsigned long long)Os_GetTime(), (unsigned long long)Os_GetTickCount());
+    printf("wall time         : %.3f s\n", (double)wall_time / 1e9);
+    printf("hyperperiods / s  : %.0f\n", (double)g_Sim_End_Time / OS_HYPERPERIOD / ((double)wall_time / 1e9));
+    printf("missed ticks      : %u\n", Os_GetMissedTicks());
+    printf("init task         : %u ticks\n", g_Sim_Init_Ticks_Counted);
+    printf("systick subscriber: %u calls every %u ticks\n", g_Sim_Subscriber_Calls, SIM_SUBSCRIBER_DIVISOR);
+    printf("timestamp         : %llu cycles, %u wraps, %u wrong reads or conversions, %u backwards\n",
+           (unsigned long long)Gpt_GetTicks(), g_Gpt_Timestamp_High, timestamp_errors, g_Sim_Timestamp_Backwards);
+    printf("busy-wait         : %u waits out of their window\n", delay_errors);
+    printf("gpt channels      : %u wrong times, %u heartbeats in %u s\n", gpt_errors, heartbeats, seconds);
+    printf("icu pulses        : %u pulses, %u periods, %u lost, %u wrong batches, %u lost edge errors\n",
+           g_Sim_Icu_Pulses, g_Sim_Icu_Samples, g_Sim_Icu_Lost, g_Sim_Icu_Wrong, icu_errors);
+    printf("det log           : %u records or counters wrong\n", det_errors);
+    printf("register faults   : %u, last at 0x%08X\n", RegSim_GetFaultCount(), RegSim_GetLastFaultAddress());
+    printf("button presses    : %u\n", g_Sim_Presses);
+    printf("led toggles       : %u\n", led_toggles);
+    printf("press thread      : %u presses, %u long, %u wrong wake-ups%s\n", press_stats.presses,
+           press_stats.long_presses, g_Sim_Press_Wakeups_Wrong, g_Sim_Press_Thread_Checked ? "" : " (presses too close, not checked)");
+    if(led_toggles > 0)
+    {
+        printf("press to toggle   : %llu ms mean, %llu ms max\n",
+               (unsigned long long)(g_Sim_Latency_Sum / led_toggles), (unsigned long long)g_Sim_Latency_Max);
+    }
+#if (OS_TRACE_API == STD_ON)
+    printf("trace overhead    : %u ns/event\n", Os_TraceGetOverhead());
+#endif
+#if (OS_PROFILING_API == STD_ON)
+    for(task_id = 0; task_id < OS_TASKS_NUM; task_id++)
+    {
+        (void)Os_GetTaskStats(task_id, &stats);
+        printf("task %u            : %u activations, min %u max %u mean %u ns, %u overruns\n",
+               task_id, stats.activations, stats.min, stats.max, stats.mean, stats.overruns);
+    }
+#endif
+#if (OS_BUDGET_MONITOR == STD_ON)
+    for(task_id = 0; task_id < OS_TASKS_NUM; task_id++)
+    {
+        printf("task %u budget     : %u overruns found by the timer ISR\n", task_id, Os_GetBudgetOverruns(task_id));
+    }
+#endif
+#if ((OS_PROFILING_API == STD_OFF) && (OS_BUDGET_MONITOR == STD_OFF))
+    (void)task_id;
+#endif
+#if (REG_ACCESS_STATS == STD_ON)
+    RegAccess_PrintReport(stdout);
+#if (REG_ACCESS_LOG_SIZE > 0U)
+    RegAccess_PrintLog(stdout, 8U);
+#endif
+#endif
+#if (OS_CPU_LOAD_API == STD_ON)
+    (void)Os_GetCpuLoad(&load);
+    printf("cpu load          : %u.%u%% last, %u.%u%% average, peak tick %u per-mille, %u hyperperiods, %u wrong\n",
+           load.load / 10U, load.load % 10U, load.average / 10U, load.average % 10U, load.peak_tick_max,
+           load.hyperperiods, g_Sim_Load_Wrong);
+#endif
+
+    if((g_Sim_Init_Ticks_Counted != g_Sim_Init_Ticks) || (Os_GetMissedTicks() != 0))
+    {
+        printf("FAIL: the ticks counted during the Init Task shall activate no task\n");
+        return 1;
+    }
+#if (OS_PROFILING_API == STD_ON)
+    (void)Os_GetTaskStats(OsConf_BUTTON_TASK_ID, &stats);
+    if(stats.activations != ((Os_GetTickCount() - g_Sim_Init_Ticks_Counted) / (OsConf_BUTTON_TASK_PERIOD / OS_BASE_TIME)))
+    {
+        printf("FAIL: the first activation of the tasks shall follow one period after the Init Task\n");
+        return 1;
+    }
+#endif
+#if (OS_CPU_LOAD_API == STD_ON)
+    if((load.hyperperiods != ((Os_GetTickCount() - g_Sim_Init_Ticks_Counted) / SIM_HYPERPERIOD_TICKS)) ||
+       (g_Sim_Load_Checked != load.hyperperiods) || (load.hyperperiods <= OS_CPU_LOAD_WINDOW) || (g_Sim_Load_Wrong != 0))
+    {
+        printf("FAIL: the CPU load monitor shall measure the time the tasks took in every hyperperiod after the Init Task\n");
+        return 1;
+    }
+#endif
+    if(led_toggles != g_Sim_Presses)
+    {
+        printf("FAIL: the LED shall toggle once per button press\n");
+        return 1;
+    }
+    if(g_Sim_Press_Thread_Checked &&
+       ((press_stats.presses != g_Sim_Presses) || (press_stats.long_presses != g_Sim_Long_Presses) ||
+        (g_Sim_Long_Presses == 0) || (g_Sim_Press_Wakeups_Wrong != 0)))
+    {
+        printf("FAIL: the press thread shall wake up by the press event, after its delay and by the release mailbox\n");
+        return 1;
+    }
+    if((g_Sim_Subscriber_Misplaced != 0) ||
+       (g_Sim_Subscriber_Calls != ((Os_GetTickCount() + SIM_SUBSCRIBER_DIVISOR - SIM_SUBSCRIBER_PHASE - 1U) / SIM_SUBSCRIBER_DIVISOR)))
+    {
+        printf("FAIL: the SysTick subscriber shall be called every %u ticks from tick %u\n",
+               SIM_SUBSCRIBER_DIVISOR, SIM_SUBSCRIBER_PHASE + 1U);
+        return 1;
+    }
+    if((timestamp_errors != 0) || (g_Sim_Timestamp_Backwards != 0) || (Gpt_GetTicks() != Gpt_SimTimestampGetCycles()))
+    {
+        printf("FAIL: the timestamp shall count every core clock cycle across its wraps and convert for centuries\n");
+        return 1;
+    }
+    if(delay_errors != 0)
+    {
+        printf("FAIL: the busy-waits shall end within a few counter reads after their deadline\n");
+        return 1;
+    }
+    if(gpt_errors != 0)
+    {
+        printf("FAIL: the Gpt channels shall count their start value down on the simulated timers\n");
+        return 1;
+    }
+    if((heartbeats != seconds) && ((heartbeats + 1U) != seconds))
+    {
+        printf("FAIL: the heartbeat channel shall notify every second from the Init Task\n");
+        return 1;
+    }
+    if((g_Sim_Icu_Samples + 1U != g_Sim_Icu_Pulses) || (g_Sim_Icu_Lost != 0) || (g_Sim_Icu_Wrong != 0) || (icu_errors != 0))
+    {
+        printf("FAIL: the Icu shall measure every pulse to the cycle and count a missed edge lost\n");
+        return 1;
+    }
+    if(det_errors != 0)
+    {
+        printf("FAIL: the Det log shall keep the last %u errors across a warm reset and count every error\n", DET_LOG_SIZE);
+        return 1;
+    }
+    if(RegSim_GetFaultCount() != 0)
+    {
+        printf("FAIL: the drivers shall access only mapped registers of clocked peripherals and committed pins\n");
+        return 1;
+    }
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,178 @@
+ /******************************************************************************
+ *
+ * Module: Host Simulation
+ *
+ * File Name: RegAccess_Report.c
+ *
+ * Description: Report of the register access statistics of Reg_Access.c with
+ *              the names of the services and of the registers, e.g.
+ *                  Port_Init                         1      366      319      685.0
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "RegAccess_Report.h"
+
+#if (REG_ACCESS_STATS == STD_ON)
+
+#include <stdlib.h>
+#include "RegSim.h"
+#include "Port.h"
+#include "Dio.h"
+#include "Gpt.h"
+#include "Icu.h"
+
+/* Longest register name printed */
+#define REPORT_NAME_SIZE            (32U)
+
+/* Description: Name of one service */
+typedef struct
+{
+    uint16 module_id;
+    uint8 api_id;
+    const char * name;
+}Report_ApiNameType;
+
+static const Report_ApiNameType Report_ApiNames[] =
+{
+    {PORT_MODULE_ID, PORT_INIT_SID,                   "Port_Init"},
+    {PORT_MODULE_ID, PORT_SET_PIN_DIRECTION_SID,      "Port_SetPinDirection"},
+    {PORT_MODULE_ID, PORT_REFRESH_PORT_DIRECTION_SID, "Port_RefreshPortDirection"},
+    {PORT_MODULE_ID, PORT_SET_PIN_MODE_SID,           "Port_SetPinMode"},
+    {DIO_MODULE_ID,  DIO_READ_CHANNEL_SID,            "Dio_ReadChannel"},
+    {DIO_MODULE_ID,  DIO_WRITE_CHANNEL_SID,           "Dio_WriteChannel"},
+    {DIO_MODULE_ID,  DIO_FLIP_CHANNEL_SID,            "Dio_FlipChannel"},
+    {GPT_MODULE_ID,  GPT_INIT_SID,                    "Gpt_Init"},
+    {GPT_MODULE_ID,  GPT_DEINIT_SID,                  "Gpt_DeInit"},
+    {GPT_MODULE_ID,  GPT_GET_TIME_ELAPSED_SID,        "Gpt_GetTimeElapsed"},
+    {GPT_MODULE_ID,  GPT_GET_TIME_REMAINING_SID,      "Gpt_GetTimeRemaining"},
+    {GPT_MODULE_ID,  GPT_START_TIMER_SID,             "Gpt_StartTimer"},
+    {GPT_MODULE_ID,  GPT_STOP_TIMER_SID,              "Gpt_StopTimer"},
+    {GPT_MODULE_ID,  GPT_ENABLE_NOTIFICATION_SID,     "Gpt_EnableNotification"},
+    {GPT_MODULE_ID,  GPT_DISABLE_NOTIFICATION_SID,    "Gpt_DisableNotification"},
+    {GPT_MODULE_ID,  SYSTICK_START_SID,               "SysTick_Start"},
+    {GPT_MODULE_ID,  SYSTICK_STOP_SID,                "SysTick_Stop"},
+    {GPT_MODULE_ID,  SYSTICK_GET_CURRENT_VALUE_SID,   "SysTick_GetCurrentValue"},
+    {GPT_MODULE_ID,  SYSTICK_GET_RELOAD_VALUE_SID,    "SysTick_GetReloadValue"},
+    {GPT_MODULE_ID,  GPT_TIMESTAMP_INIT_SID,          "Gpt_TimestampInit"},
+    {GPT_MODULE_ID,  REG_ACCESS_ISR_API_ID,           "Gpt ISRs"},
+    {ICU_MODULE_ID,  ICU_INIT_SID,                    "Icu_Init"},
+    {ICU_MODULE_ID,  ICU_START_SIGNAL_MEASUREMENT_SID, "Icu_StartSignalMeasurement"},
+    {ICU_MODULE_ID,  ICU_STOP_SIGNAL_MEASUREMENT_SID, "Icu_StopSignalMeasurement"},
+    {ICU_MODULE_ID,  REG_ACCESS_ISR_API_ID,           "Icu ISR"},
+    {REG_ACCESS_NO_MODULE_ID, 0U,                     "(no service)"}
+};
+
+/*********************************************************************************************/
+const char * RegAccess_GetApiName(uint16 ModuleId, uint8 ApiId)
+{
+    uint32 index;
+
+    for(index = 0; index < (sizeof(Report_ApiNames) / sizeof(Report_ApiNames[0])); index++)
+    {
+        if((Report_ApiNames[index].module_id == ModuleId) && (Report_ApiNames[index].api_id == ApiId))
+        {
+            return Report_ApiNames[index].name;
+        }
+    }
+    return NULL;
+}
+
+/*********************************************************************************************/
+/* Description: Order the registers by their accesses, the most accessed first */
+static int Report_CompareRegisters(const void * First, const void * Second)
+{
+    const RegAccess_RegisterStatsType * first  = (const RegAccess_RegisterStatsType *)First;
+    const RegAccess_RegisterStatsType * second = (const RegAccess_RegisterStatsType *)Second;
+    uint32 first_total  = first->reads + first->writes;
+    uint32 second_total = second->reads + second->writes;
+
+    if(first_total != second_total)
+    {
+        return (first_total < second_total) ? 1 : -1;
+    }
+    return (first->address < second->address) ? -1 : 1;
+}
+
+/*********************************************************************************************/
+void RegAccess_PrintReport(FILE * Stream)
+{
+    RegAccess_ApiStatsType api;
+    RegAccess_RegisterStatsType registers[1U << REG_ACCESS_REGISTERS_BITS];
+    uint32 count = 0;
+    uint32 iterator = 0;
+    uint32 index;
+    const char * name;
+    char buffer[REPORT_NAME_SIZE];
+
+    fprintf(Stream, "%-26s %8s %8s %8s %10s\n", "service", "calls", "reads", "writes", "per call");
+    while(RegAccess_GetNextApi(&iterator, &api) == E_OK)
+    {
+        name = RegAccess_GetApiName(api.module_id, api.api_id);
+        if(name == NULL)
+        {
+            (void)snprintf(buffer, sizeof(buffer), "module %u service 0x%02X", api.module_id, api.api_id);
+            name = buffer;
+        }
+        fprintf(Stream, "%-26s %8u %8u %8u", name, api.calls, api.reads, api.writes);
+        if(api.calls != 0)
+        {
+            fprintf(Stream, " %10.1f", (double)(api.reads + api.writes) / api.calls);
+        }
+        fprintf(Stream, "\n");
+    }
+
+    iterator = 0;
+    while(RegAccess_GetNextRegister(&iterator, &registers[count]) == E_OK)
+    {
+        count++;
+    }
+    qsort(registers, count, sizeof(registers[0]), Report_CompareRegisters);
+
+    fprintf(Stream, "%-26s %8s %8s %8s\n", "register", "address", "reads", "writes");
+    for(index = 0; index < count; index++)
+    {
+        RegSim_GetRegisterName(registers[index].address, buffer, sizeof(buffer));
+        fprintf(Stream, "%-26s %08X %8u %8u\n", buffer, registers[index].address, registers[index].reads, registers[index].writes);
+    }
+
+    if(RegAccess_GetDroppedCount() != 0)
+    {
+        fprintf(Stream, "%u accesses not counted, the tables are full\n", RegAccess_GetDroppedCount());
+    }
+}
+
+#if (REG_ACCESS_LOG_SIZE > 0U)
+/*********************************************************************************************/
+void RegAccess_PrintLog(FILE * Stream, uint32 Count)
+{
+    static const char * const types[] = {"read", "write", "write8"};
+    uint32 head = RegAccess_GetLogCount();
+    uint32 number;
+    RegAccess_LogEntryType entry;
+    const char * name;
+    char buffer[REPORT_NAME_SIZE];
+
+    if(Count > REG_ACCESS_LOG_SIZE)
+    {
+        Count = REG_ACCESS_LOG_SIZE;
+    }
+    if(Count > head)
+    {
+        Count = head;
+    }
+
+    for(number = head - Count; number != head; number++)
+    {
+        if(RegAccess_ReadLog(number, &entry) != E_OK)
+        {
+            continue; /* Overwritten */
+        }
+        name = RegAccess_GetApiName(entry.module_id, entry.api_id);
+        RegSim_GetRegisterName(entry.address, buffer, sizeof(buffer));
+        fprintf(Stream, "%10u %-26s %-6s %-20s %08X\n", number, (name != NULL) ? name : "?", types[entry.type], buffer, entry.value);
+    }
+}
+#endif
+
+#endif /* REG_ACCESS_STATS == STD_ON */
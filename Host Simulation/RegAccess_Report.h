@@ -0,0 +1,35 @@
+ /******************************************************************************
+ *
+ * Module: Host Simulation
+ *
+ * File Name: RegAccess_Report.h
+ *
+ * Description: Header file for the report of the register access statistics
+ *              of Reg_Access.c, built with REG_ACCESS_STATS STD_ON.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef REGACCESS_REPORT_H
+#define REGACCESS_REPORT_H
+
+#include <stdio.h>
+#include "Reg_Access.h"
+
+#if (REG_ACCESS_STATS == STD_ON)
+
+/* Description: Return the name of a service like "Port_Init", NULL if unknown */
+const char * RegAccess_GetApiName(uint16 ModuleId, uint8 ApiId);
+
+/* Description: Print the accesses per service with their number per call, then per register,
+ *              the most accessed first */
+void RegAccess_PrintReport(FILE * Stream);
+
+#if (REG_ACCESS_LOG_SIZE > 0U)
+/* Description: Print the last Count logged accesses, oldest first */
+void RegAccess_PrintLog(FILE * Stream, uint32 Count);
+#endif
+
+#endif
+
+#endif /* REGACCESS_REPORT_H */
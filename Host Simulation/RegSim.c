@@ -0,0 +1,1156 @@
+ /******************************************************************************
+ *
+ * Module: Host Simulation
+ *
+ * File Name: RegSim.c
+ *
+ * Description: Simulated register file behind Reg_Access.h in host builds.
+ *              Every peripheral is a 4 KB region of RAM words, the registers
+ *              with side effects are modelled on the TM4C123GH6PM data sheet:
+ *              - GPIODATA masked by the address bits [9:2] and read from the pins
+ *              - GPIOLOCK and GPIOCR protecting the commit bits of GPIOAFSEL,
+ *                GPIOPUR, GPIOPDR and GPIODEN
+ *              - GPIOPUR and GPIOPDR clearing each other
+ *              - GPIOICR and GPTMICR clearing the raw interrupt status, MIS = RIS & IM
+ *              - RCGC2/RCGCGPIO, RCGCTIMER and RCGCWTIMER setting their PR bits
+ *                only after a few reads, like the wait loops of the drivers expect
+ *              - NVIC ENn and DISn setting and clearing the same enable bits
+ *              - SysTick counting down the elapsed cycles from its reload value,
+ *                COUNT cleared by a read of STCTRL
+ *              - GPTM Timer A counting down the elapsed cycles in one-shot and
+ *                periodic modes from GPTMTAILR, the wide timers through their
+ *                prescaler, a time-out setting TATORIS and clearing TAEN in
+ *                one-shot mode ... the count-up timers are not counted
+ *              - GPTM Timer A counting up the elapsed cycles in edge-time mode,
+ *                an edge selected by TAEVENT on the CCP0 pin of the timer (AFSEL,
+ *                DEN and PCTL 7) latching the count in GPTMTAR and setting CAERIS
+ *              The accesses a part would fault or ignore are counted.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "RegSim.h"
+#include "Port_Regs.h"
+#include "Gpt_Regs.h"
+
+/* Words of every simulated region */
+#define REGSIM_REGION_WORDS         (1024U)
+#define REGSIM_REGION_SIZE          (REGSIM_REGION_WORDS * 4U)
+
+/* Regions: the GPIO ports first, in the order of their port numbers */
+#define REGSIM_TIMERS_NUM           (12U)
+#define REGSIM_SYSCTL_REGION        (REGSIM_PORTS_NUM)
+#define REGSIM_TIMER_REGION(TIMER)  (REGSIM_PORTS_NUM + 1U + (TIMER))
+#define REGSIM_SCS_REGION           (REGSIM_PORTS_NUM + 1U + REGSIM_TIMERS_NUM)
+#define REGSIM_REGIONS_NUM          (REGSIM_SCS_REGION + 1U)
+#define REGSIM_NO_REGION            (0xFFU)
+
+/* Base addresses of the System Control and of the System Control Space */
+#define REGSIM_SYSCTL_BASE_ADDRESS  (0x400FE000U)
+#define REGSIM_SCS_BASE_ADDRESS     (0xE000E000U)
+
+/* System Control registers offsets */
+#define REGSIM_RCGC2_OFFSET         (SYSCTL_RCGC2_ADDRESS - REGSIM_SYSCTL_BASE_ADDRESS)
+#define REGSIM_RCGCTIMER_OFFSET     (SYSCTL_RCGCTIMER_ADDRESS - REGSIM_SYSCTL_BASE_ADDRESS)
+#define REGSIM_RCGCGPIO_OFFSET      (0x608U)
+#define REGSIM_RCGCWTIMER_OFFSET    (SYSCTL_RCGCWTIMER_ADDRESS - REGSIM_SYSCTL_BASE_ADDRESS)
+#define REGSIM_PRTIMER_OFFSET       (SYSCTL_PRTIMER_ADDRESS - REGSIM_SYSCTL_BASE_ADDRESS)
+#define REGSIM_PRGPIO_OFFSET        (SYSCTL_PRGPIO_ADDRESS - REGSIM_SYSCTL_BASE_ADDRESS)
+#define REGSIM_PRWTIMER_OFFSET      (SYSCTL_PRWTIMER_ADDRESS - REGSIM_SYSCTL_BASE_ADDRESS)
+
+/* Reads of a PR register before a newly enabled peripheral is ready */
+#define REGSIM_READY_READS          (2U)
+
+/* GPIO interrupt registers offsets, the others are in Port_Regs.h */
+#define REGSIM_GPIO_IS_OFFSET       (0x404U)
+#define REGSIM_GPIO_IBE_OFFSET      (0x408U)
+#define REGSIM_GPIO_IEV_OFFSET      (0x40CU)
+#define REGSIM_GPIO_IM_OFFSET       (0x410U)
+#define REGSIM_GPIO_RIS_OFFSET      (0x414U)
+#define REGSIM_GPIO_MIS_OFFSET      (0x418U)
+#define REGSIM_GPIO_ICR_OFFSET      (0x41CU)
+
+/* Pins of the JTAG port PC[3:0] and of the NMI pins PD7 and PF0 are protected by GPIOCR */
+#define REGSIM_PORTC                (2U)
+#define REGSIM_PORTD                (3U)
+#define REGSIM_PORTF                (5U)
+#define REGSIM_PORTC_PROTECTED      (0x0FU)
+#define REGSIM_PORTD_PROTECTED      (0x80U)
+#define REGSIM_PORTF_PROTECTED      (0x01U)
+
+/* Reset values of the JTAG pins PC[3:0]: alternate function 1 with pull-ups */
+#define REGSIM_PORTC_JTAG_PCTL      (0x00001111U)
+
+/* SysTick and NVIC registers offsets */
+#define REGSIM_SYSTICK_CTRL_OFFSET     (SYSTICK_CTRL_ADDRESS - REGSIM_SCS_BASE_ADDRESS)
+#define REGSIM_SYSTICK_RELOAD_OFFSET   (SYSTICK_RELOAD_ADDRESS - REGSIM_SCS_BASE_ADDRESS)
+#define REGSIM_SYSTICK_CURRENT_OFFSET  (SYSTICK_CURRENT_ADDRESS - REGSIM_SCS_BASE_ADDRESS)
+#define REGSIM_NVIC_EN0_OFFSET      (NVIC_EN0_ADDRESS - REGSIM_SCS_BASE_ADDRESS)
+#define REGSIM_NVIC_DIS0_OFFSET     (NVIC_DIS0_ADDRESS - REGSIM_SCS_BASE_ADDRESS)
+#define REGSIM_NVIC_WORDS           (8U)
+
+/* GPTMTAMR and GPTMCTL bits */
+#define REGSIM_TIMER_MODE_MASK      (0x00000003U)
+#define REGSIM_TIMER_ONE_SHOT       (0x00000001U)
+#define REGSIM_TIMER_PERIODIC       (0x00000002U)
+#define REGSIM_TIMER_COUNT_UP       (0x00000010U)
+#define REGSIM_TIMER_TAEN           (0x00000001U)
+#define REGSIM_TIMER_TATO           (0x00000001U)
+#define REGSIM_TIMER_CAPTURE        (0x00000003U)
+#define REGSIM_TIMER_EDGE_TIME      (0x00000004U)
+#define REGSIM_TIMER_EVENT_MASK     (0x0000000CU)
+#define REGSIM_TIMER_RISING_EDGE    (0x00000000U)
+#define REGSIM_TIMER_FALLING_EDGE   (0x00000004U)
+#define REGSIM_TIMER_CAE            (0x00000004U)
+
+/* GPIOPCTL function of the CCP pins and the bits of one pin */
+#define REGSIM_PCTL_CCP             (7U)
+#define REGSIM_PCTL_BITS            (4U)
+#define REGSIM_PCTL_MASK            (0xFU)
+
+/* Counter bits of a 16/32-bit timer in edge-time mode ... GPTMTAPR extends GPTMTAILR to 24 bits */
+#define REGSIM_TIMER_CAPTURE_LOW_MASK   (0x0000FFFFU)
+#define REGSIM_TIMER_CAPTURE_HIGH_MASK  (0x000000FFU)
+
+/* First wide timer and its prescaler bits */
+#define REGSIM_WIDE_TIMER0          (6U)
+#define REGSIM_WIDE_PRESCALER_MASK  (0x0000FFFFU)
+
+/* STCTRL bits */
+#define REGSIM_SYSTICK_ENABLE       (0x00000001U)
+#define REGSIM_SYSTICK_INTEN        (0x00000002U)
+#define REGSIM_SYSTICK_COUNT        (0x00010000U)
+
+/* Stored value of a register */
+#define REGSIM_REG(REGION, OFFSET)  (g_RegSim_Regs[(REGION)][(OFFSET) >> 2])
+
+/* Description: Clock gating register and the PR register telling when the peripherals are ready */
+typedef struct
+{
+    uint32 gate_offset;
+    uint8 ready;            /* Index in g_RegSim_Ready */
+}RegSim_GateType;
+
+/* Description: Peripheral ready register with the newly enabled bits not ready yet */
+typedef struct
+{
+    uint32 offset;
+    uint32 pending;
+    uint32 countdown;
+}RegSim_ReadyType;
+
+/* Base addresses of the regions */
+static const uint32 RegSim_RegionBase[REGSIM_REGIONS_NUM] =
+{
+    GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+    GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS,
+    REGSIM_SYSCTL_BASE_ADDRESS,
+    GPT_TIMER0_BASE_ADDRESS, GPT_TIMER1_BASE_ADDRESS, GPT_TIMER2_BASE_ADDRESS,
+    GPT_TIMER3_BASE_ADDRESS, GPT_TIMER4_BASE_ADDRESS, GPT_TIMER5_BASE_ADDRESS,
+    GPT_WIDE_TIMER0_BASE_ADDRESS, GPT_WIDE_TIMER1_BASE_ADDRESS, GPT_WIDE_TIMER2_BASE_ADDRESS,
+    GPT_WIDE_TIMER3_BASE_ADDRESS, GPT_WIDE_TIMER4_BASE_ADDRESS, GPT_WIDE_TIMER5_BASE_ADDRESS,
+    REGSIM_SCS_BASE_ADDRESS
+};
+
+/* Interrupt of the Timer A of every timer, in the order of the timer regions */
+static const uint8 RegSim_TimerIrq[REGSIM_TIMERS_NUM] =
+{
+    GPT_TIMER0A_IRQ_NUM, GPT_TIMER1A_IRQ_NUM, GPT_TIMER2A_IRQ_NUM,
+    GPT_TIMER3A_IRQ_NUM, GPT_TIMER4A_IRQ_NUM, GPT_TIMER5A_IRQ_NUM,
+    GPT_WIDE_TIMER0A_IRQ_NUM, GPT_WIDE_TIMER1A_IRQ_NUM, GPT_WIDE_TIMER2A_IRQ_NUM,
+    GPT_WIDE_TIMER3A_IRQ_NUM, GPT_WIDE_TIMER4A_IRQ_NUM, GPT_WIDE_TIMER5A_IRQ_NUM
+};
+
+/* Description: Port and pin of the CCP0 input of a timer */
+typedef struct
+{
+    uint8 port;
+    uint8 pin;
+}RegSim_CcpPinType;
+
+/* CCP0 pins of the timers in the order of the timer regions: T0CCP0 PB6 ... WT5CCP0 PD6 */
+static const RegSim_CcpPinType RegSim_TimerCcp[REGSIM_TIMERS_NUM] =
+{
+    {1U, 6U}, {1U, 4U}, {1U, 0U}, {1U, 2U}, {2U, 0U}, {2U, 2U},
+    {2U, 4U}, {2U, 6U}, {3U, 0U}, {3U, 2U}, {3U, 4U}, {3U, 6U}
+};
+
+/* Ready registers: GPIO ports, 16/32-bit timers, 32/64-bit wide timers */
+#define REGSIM_READY_GPIO           (0U)
+#define REGSIM_READY_TIMER          (1U)
+#define REGSIM_READY_WTIMER         (2U)
+#define REGSIM_READY_NUM            (3U)
+
+/* RCGC2 is the legacy gating register of the GPIO ports, RCGCGPIO the new one ... both are honoured */
+static const RegSim_GateType RegSim_Gates[] =
+{
+    {REGSIM_RCGC2_OFFSET,      REGSIM_READY_GPIO},
+    {REGSIM_RCGCGPIO_OFFSET,   REGSIM_READY_GPIO},
+    {REGSIM_RCGCTIMER_OFFSET,  REGSIM_READY_TIMER},
+    {REGSIM_RCGCWTIMER_OFFSET, REGSIM_READY_WTIMER}
+};
+
+#define REGSIM_GATES_NUM            (sizeof(RegSim_Gates) / sizeof(RegSim_Gates[0]))
+
+/* Global array store the words of every region */
+static uint32 g_RegSim_Regs[REGSIM_REGIONS_NUM][REGSIM_REGION_WORDS];
+
+/* Global array store the ready registers state */
+static RegSim_ReadyType g_RegSim_Ready[REGSIM_READY_NUM];
+
+/* GPIOCR of every port can be written only while it is unlocked */
+static boolean g_RegSim_Unlocked[REGSIM_PORTS_NUM];
+
+/* Pins driven from the simulated environment and their levels */
+static uint8 g_RegSim_Driven[REGSIM_PORTS_NUM];
+static uint8 g_RegSim_Driven_Level[REGSIM_PORTS_NUM];
+
+/* Pin levels after the last access and their changes */
+static uint8 g_RegSim_Level[REGSIM_PORTS_NUM];
+static uint32 g_RegSim_Edge_Count[REGSIM_PORTS_NUM][REGSIM_PINS_NUM];
+
+/* Accesses a part would fault or ignore */
+static uint32 g_RegSim_Faults = 0;
+static uint32 g_RegSim_Last_Fault = 0;
+
+/* Function called on every access, the simulation elapses its time by it */
+static RegSim_AccessHookType g_RegSim_Access_Hook = NULL_PTR;
+
+/* SysTick reached 0 with its interrupt enabled and the ISR did not run yet */
+static boolean g_RegSim_SysTick_Pending = FALSE;
+
+/* Cycles counted by the prescaler of every timer since its counter last decremented */
+static uint32 g_RegSim_Prescaled[REGSIM_TIMERS_NUM];
+
+/*********************************************************************************************/
+/* Description: Count a faulting access */
+static void RegSim_Fault(uint32 Address)
+{
+    g_RegSim_Faults++;
+    g_RegSim_Last_Fault = Address;
+}
+
+/*********************************************************************************************/
+/* Description: Return the region holding Address, REGSIM_NO_REGION if unmapped */
+static uint8 RegSim_FindRegion(uint32 Address)
+{
+    uint8 region;
+
+    for(region = 0; region < REGSIM_REGIONS_NUM; region++)
+    {
+        if((Address - RegSim_RegionBase[region]) < REGSIM_REGION_SIZE)
+        {
+            return region;
+        }
+    }
+    return REGSIM_NO_REGION;
+}
+
+/*********************************************************************************************/
+/* Description: Return TRUE if the clock of the peripheral of the region is enabled and ready */
+static boolean RegSim_IsClocked(uint8 Region)
+{
+    uint32 ready;
+    uint32 bit;
+
+    if(Region < REGSIM_PORTS_NUM)
+    {
+        ready = REGSIM_REG(REGSIM_SYSCTL_REGION, REGSIM_PRGPIO_OFFSET);
+        bit   = Region;
+    }
+    else if((Region >= REGSIM_TIMER_REGION(0)) && (Region < REGSIM_TIMER_REGION(6)))
+    {
+        ready = REGSIM_REG(REGSIM_SYSCTL_REGION, REGSIM_PRTIMER_OFFSET);
+        bit   = Region - REGSIM_TIMER_REGION(0);
+    }
+    else if((Region >= REGSIM_TIMER_REGION(6)) && (Region < REGSIM_SCS_REGION))
+    {
+        ready = REGSIM_REG(REGSIM_SYSCTL_REGION, REGSIM_PRWTIMER_OFFSET);
+        bit   = Region - REGSIM_TIMER_REGION(6);
+    }
+    else
+    {
+        return TRUE; /* System Control and System Control Space are always clocked */
+    }
+    return (ready & (1UL << bit)) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************/
+/* Description: Return the levels of the pins of a port */
+static uint8 RegSim_PinLevels(uint8 Port)
+{
+    uint8 output = (uint8)(REGSIM_REG(Port, PORT_DIR_REG_OFFSET) & ~REGSIM_REG(Port, PORT_ALT_FUNC_REG_OFFSET));
+    uint8 input;
+
+    /* Floating inputs follow their pull-up, the pull-downs and the others read low */
+    input = (uint8)((g_RegSim_Driven[Port] & g_RegSim_Driven_Level[Port]) |
+                    (~g_RegSim_Driven[Port] & REGSIM_REG(Port, PORT_PULL_UP_REG_OFFSET)));
+
+    return (uint8)((output & REGSIM_REG(Port, PORT_DATA_REG_OFFSET)) | (~output & input));
+}
+
+/*********************************************************************************************/
+/* Description: Return TRUE if the Timer A of a timer counts up in edge-time mode */
+static boolean RegSim_IsTimerCapturing(uint8 Timer)
+{
+    uint8 region = REGSIM_TIMER_REGION(Timer);
+    uint32 mode  = REGSIM_REG(region, GPT_TAMR_REG_OFFSET);
+
+    return ((REGSIM_REG(region, GPT_CTL_REG_OFFSET) & REGSIM_TIMER_TAEN) &&
+            ((mode & REGSIM_TIMER_MODE_MASK) == REGSIM_TIMER_CAPTURE) && (mode & REGSIM_TIMER_EDGE_TIME)) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************/
+/* Description: Latch the count of the timers whose CCP0 pin changed on the edge selected by TAEVENT */
+static void RegSim_CaptureEdges(uint8 Port, uint8 Level, uint8 Changed)
+{
+    uint8 timer;
+    uint8 region;
+    uint8 pin;
+    uint32 event;
+
+    for(timer = 0; timer < REGSIM_TIMERS_NUM; timer++)
+    {
+        pin = RegSim_TimerCcp[timer].pin;
+        if((RegSim_TimerCcp[timer].port != Port) || !(Changed & (1U << pin)) || !RegSim_IsTimerCapturing(timer) ||
+           !(REGSIM_REG(Port, PORT_ALT_FUNC_REG_OFFSET) & REGSIM_REG(Port, PORT_DIGITAL_ENABLE_REG_OFFSET) & (1U << pin)) ||
+           (((REGSIM_REG(Port, PORT_CTL_REG_OFFSET) >> (pin * REGSIM_PCTL_BITS)) & REGSIM_PCTL_MASK) != REGSIM_PCTL_CCP))
+        {
+            continue;
+        }
+        region = REGSIM_TIMER_REGION(timer);
+        event  = REGSIM_REG(region, GPT_CTL_REG_OFFSET) & REGSIM_TIMER_EVENT_MASK;
+        if(((event == REGSIM_TIMER_RISING_EDGE) && !(Level & (1U << pin))) ||
+           ((event == REGSIM_TIMER_FALLING_EDGE) && (Level & (1U << pin))))
+        {
+            continue;
+        }
+        REGSIM_REG(region, GPT_TAR_REG_OFFSET) = REGSIM_REG(region, GPT_TAV_REG_OFFSET);
+        REGSIM_REG(region, GPT_RIS_REG_OFFSET) |= REGSIM_TIMER_CAE;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Count the level changes of the pins of a port and latch the input edges in GPIORIS */
+static void RegSim_UpdatePins(uint8 Port)
+{
+    uint8 level   = RegSim_PinLevels(Port);
+    uint8 changed = (uint8)(level ^ g_RegSim_Level[Port]);
+    uint8 pin;
+    uint32 rising;
+    uint32 selected;
+
+    for(pin = 0; pin < REGSIM_PINS_NUM; pin++)
+    {
+        if(changed & (1U << pin))
+        {
+            g_RegSim_Edge_Count[Port][pin]++;
+        }
+    }
+
+    /* Edge sensitive pins (GPIOIS = 0): both edges if GPIOIBE, else rising if GPIOIEV, else falling */
+    rising   = level & changed;
+    selected = (REGSIM_REG(Port, REGSIM_GPIO_IBE_OFFSET) & changed) |
+               (~REGSIM_REG(Port, REGSIM_GPIO_IBE_OFFSET) &
+                ((REGSIM_REG(Port, REGSIM_GPIO_IEV_OFFSET) & rising) |
+                 (~REGSIM_REG(Port, REGSIM_GPIO_IEV_OFFSET) & (changed & ~rising))));
+    REGSIM_REG(Port, REGSIM_GPIO_RIS_OFFSET) |= selected & ~REGSIM_REG(Port, REGSIM_GPIO_IS_OFFSET) & 0xFFU;
+
+    RegSim_CaptureEdges(Port, level, changed);
+    g_RegSim_Level[Port] = level;
+}
+
+/*********************************************************************************************/
+/* Description: Return the GPIOCR bits of the pins protected in a port */
+static uint32 RegSim_ProtectedPins(uint8 Port)
+{
+    switch(Port)
+    {
+    case REGSIM_PORTC: return REGSIM_PORTC_PROTECTED;
+    case REGSIM_PORTD: return REGSIM_PORTD_PROTECTED;
+    case REGSIM_PORTF: return REGSIM_PORTF_PROTECTED;
+    default:           return 0;
+    }
+}
+
+/*********************************************************************************************/
+static uint32 RegSim_GpioRead(uint8 Port, uint32 Offset)
+{
+    uint32 value;
+
+    if(Offset <= PORT_DATA_REG_OFFSET)
+    {
+        /* Only the bits selected by the address are read, the inputs from the pins */
+        value = (REGSIM_REG(Port, PORT_DIR_REG_OFFSET) & REGSIM_REG(Port, PORT_DATA_REG_OFFSET)) |
+                (~REGSIM_REG(Port, PORT_DIR_REG_OFFSET) & RegSim_PinLevels(Port));
+        return value & REGSIM_REG(Port, PORT_DIGITAL_ENABLE_REG_OFFSET) & (Offset >> 2);
+    }
+
+    switch(Offset)
+    {
+    case REGSIM_GPIO_MIS_OFFSET:
+        return REGSIM_REG(Port, REGSIM_GPIO_RIS_OFFSET) & REGSIM_REG(Port, REGSIM_GPIO_IM_OFFSET);
+    case REGSIM_GPIO_ICR_OFFSET:
+        return 0;
+    case PORT_LOCK_REG_OFFSET:
+        return g_RegSim_Unlocked[Port] ? 0U : 1U;
+    default:
+        return REGSIM_REG(Port, Offset);
+    }
+}
+
+/*********************************************************************************************/
+static void RegSim_GpioWrite(uint8 Port, uint32 Address, uint32 Offset, uint32 Value)
+{
+    uint32 mask;
+    uint32 commit = REGSIM_REG(Port, PORT_COMMIT_REG_OFFSET);
+
+    if(Offset <= PORT_DATA_REG_OFFSET)
+    {
+        /* Only the bits selected by the address are written */
+        mask = Offset >> 2;
+        REGSIM_REG(Port, PORT_DATA_REG_OFFSET) = (REGSIM_REG(Port, PORT_DATA_REG_OFFSET) & ~mask) | (Value & mask);
+        RegSim_UpdatePins(Port);
+        return;
+    }
+
+    switch(Offset)
+    {
+    case PORT_ALT_FUNC_REG_OFFSET:
+    case PORT_PULL_UP_REG_OFFSET:
+    case PORT_PULL_DOWN_REG_OFFSET:
+    case PORT_DIGITAL_ENABLE_REG_OFFSET:
+        /* The bits not committed in GPIOCR keep their value ... changing them is a driver bug */
+        if((REGSIM_REG(Port, Offset) ^ Value) & ~commit & 0xFFU)
+        {
+            RegSim_Fault(Address);
+        }
+        Value = (REGSIM_REG(Port, Offset) & ~commit) | (Value & commit & 0xFFU);
+        REGSIM_REG(Port, Offset) = Value;
+        if(Offset == PORT_PULL_UP_REG_OFFSET)
+        {
+            REGSIM_REG(Port, PORT_PULL_DOWN_REG_OFFSET) &= ~Value;
+        }
+        else if(Offset == PORT_PULL_DOWN_REG_OFFSET)
+        {
+            REGSIM_REG(Port, PORT_PULL_UP_REG_OFFSET) &= ~Value;
+        }
+        break;
+    case PORT_LOCK_REG_OFFSET:
+        /* Any other value locks GPIOCR again */
+        g_RegSim_Unlocked[Port] = (Value == PORT_UNLOCK_VALUE) ? TRUE : FALSE;
+        break;
+    case PORT_COMMIT_REG_OFFSET:
+        if(!g_RegSim_Unlocked[Port])
+        {
+            RegSim_Fault(Address);
+            break;
+        }
+        /* Only the bits of the protected pins can be cleared */
+        REGSIM_REG(Port, Offset) = (Value | ~RegSim_ProtectedPins(Port)) & 0xFFU;
+        break;
+    case REGSIM_GPIO_ICR_OFFSET:
+        REGSIM_REG(Port, REGSIM_GPIO_RIS_OFFSET) &= ~Value;
+        break;
+    case REGSIM_GPIO_RIS_OFFSET:
+    case REGSIM_GPIO_MIS_OFFSET:
+        break; /* Read only */
+    default:
+        REGSIM_REG(Port, Offset) = Value;
+        break;
+    }
+    RegSim_UpdatePins(Port);
+}
+
+/*********************************************************************************************/
+static uint32 RegSim_SysCtlRead(uint32 Offset)
+{
+    uint8 index;
+    RegSim_ReadyType * ready;
+
+    for(index = 0; index < REGSIM_READY_NUM; index++)
+    {
+        ready = &g_RegSim_Ready[index];
+        if((ready->offset == Offset) && (ready->pending != 0) && (--ready->countdown == 0))
+        {
+            REGSIM_REG(REGSIM_SYSCTL_REGION, Offset) |= ready->pending;
+            ready->pending = 0;
+        }
+    }
+    return REGSIM_REG(REGSIM_SYSCTL_REGION, Offset);
+}
+
+/*********************************************************************************************/
+static void RegSim_SysCtlWrite(uint32 Offset, uint32 Value)
+{
+    uint8 index;
+    uint8 gate;
+    uint32 enabled;
+    RegSim_ReadyType * ready;
+
+    for(index = 0; index < REGSIM_READY_NUM; index++)
+    {
+        if(g_RegSim_Ready[index].offset == Offset)
+        {
+            return; /* Read only */
+        }
+    }
+
+    REGSIM_REG(REGSIM_SYSCTL_REGION, Offset) = Value;
+
+    for(index = 0; index < REGSIM_READY_NUM; index++)
+    {
+        /* A peripheral is clocked if any of its gating registers enables it */
+        enabled = 0;
+        for(gate = 0; gate < REGSIM_GATES_NUM; gate++)
+        {
+            if(RegSim_Gates[gate].ready == index)
+            {
+                enabled |= REGSIM_REG(REGSIM_SYSCTL_REGION, RegSim_Gates[gate].gate_offset);
+            }
+        }
+
+        ready = &g_RegSim_Ready[index];
+        REGSIM_REG(REGSIM_SYSCTL_REGION, ready->offset) &= enabled;
+        ready->pending &= enabled;
+        if(enabled & ~(REGSIM_REG(REGSIM_SYSCTL_REGION, ready->offset) | ready->pending))
+        {
+            ready->pending  |= enabled & ~REGSIM_REG(REGSIM_SYSCTL_REGION, ready->offset);
+            ready->countdown = REGSIM_READY_READS;
+        }
+    }
+}
+
+/*********************************************************************************************/
+static uint32 RegSim_TimerRead(uint8 Region, uint32 Offset)
+{
+    switch(Offset)
+    {
+    case GPT_MIS_REG_OFFSET:
+        return REGSIM_REG(Region, GPT_RIS_REG_OFFSET) & REGSIM_REG(Region, GPT_IMR_REG_OFFSET);
+    case GPT_ICR_REG_OFFSET:
+        return 0;
+    default:
+        return REGSIM_REG(Region, Offset);
+    }
+}
+
+/*********************************************************************************************/
+static void RegSim_TimerWrite(uint8 Region, uint32 Offset, uint32 Value)
+{
+    switch(Offset)
+    {
+    case GPT_TAILR_REG_OFFSET:
+        /* A down counter loads its start value at once */
+        REGSIM_REG(Region, Offset) = Value;
+        if(!(REGSIM_REG(Region, GPT_TAMR_REG_OFFSET) & REGSIM_TIMER_COUNT_UP))
+        {
+            REGSIM_REG(Region, GPT_TAR_REG_OFFSET) = Value;
+            REGSIM_REG(Region, GPT_TAV_REG_OFFSET) = Value;
+            g_RegSim_Prescaled[Region - REGSIM_TIMER_REGION(0)] = 0;
+        }
+        break;
+    case GPT_ICR_REG_OFFSET:
+        REGSIM_REG(Region, GPT_RIS_REG_OFFSET) &= ~Value;
+        break;
+    case GPT_RIS_REG_OFFSET:
+    case GPT_MIS_REG_OFFSET:
+        break; /* Read only */
+    default:
+        REGSIM_REG(Region, Offset) = Value;
+        break;
+    }
+}
+
+/*********************************************************************************************/
+static uint32 RegSim_ScsRead(uint32 Offset)
+{
+    uint32 value;
+
+    /* ENn and DISn both read the enable bits */
+    if((Offset >= REGSIM_NVIC_DIS0_OFFSET) && (Offset < (REGSIM_NVIC_DIS0_OFFSET + (4U * REGSIM_NVIC_WORDS))))
+    {
+        Offset = Offset - REGSIM_NVIC_DIS0_OFFSET + REGSIM_NVIC_EN0_OFFSET;
+    }
+    value = REGSIM_REG(REGSIM_SCS_REGION, Offset);
+
+    /* COUNT tells whether SysTick reached 0 since the last read of STCTRL */
+    if(Offset == REGSIM_SYSTICK_CTRL_OFFSET)
+    {
+        REGSIM_REG(REGSIM_SCS_REGION, Offset) &= ~REGSIM_SYSTICK_COUNT;
+    }
+    return value;
+}
+
+/*********************************************************************************************/
+static void RegSim_ScsWrite(uint32 Offset, uint32 Value)
+{
+    if((Offset >= REGSIM_NVIC_EN0_OFFSET) && (Offset < (REGSIM_NVIC_EN0_OFFSET + (4U * REGSIM_NVIC_WORDS))))
+    {
+        REGSIM_REG(REGSIM_SCS_REGION, Offset) |= Value;
+    }
+    else if((Offset >= REGSIM_NVIC_DIS0_OFFSET) && (Offset < (REGSIM_NVIC_DIS0_OFFSET + (4U * REGSIM_NVIC_WORDS))))
+    {
+        REGSIM_REG(REGSIM_SCS_REGION, Offset - REGSIM_NVIC_DIS0_OFFSET + REGSIM_NVIC_EN0_OFFSET) &= ~Value;
+    }
+    else if(Offset == REGSIM_SYSTICK_CURRENT_OFFSET)
+    {
+        /* Any write clears the counter and COUNT */
+        REGSIM_REG(REGSIM_SCS_REGION, Offset) = 0;
+        REGSIM_REG(REGSIM_SCS_REGION, REGSIM_SYSTICK_CTRL_OFFSET) &= ~REGSIM_SYSTICK_COUNT;
+    }
+    else if(Offset == REGSIM_SYSTICK_CTRL_OFFSET)
+    {
+        REGSIM_REG(REGSIM_SCS_REGION, Offset) = (REGSIM_REG(REGSIM_SCS_REGION, Offset) & REGSIM_SYSTICK_COUNT) |
+                                                (Value & ~REGSIM_SYSTICK_COUNT);
+    }
+    else
+    {
+        REGSIM_REG(REGSIM_SCS_REGION, Offset) = Value;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Return the region of an access, REGSIM_NO_REGION after counting a fault */
+static uint8 RegSim_Access(uint32 Address)
+{
+    uint8 region = RegSim_FindRegion(Address);
+
+    if(g_RegSim_Access_Hook != NULL_PTR)
+    {
+        (*g_RegSim_Access_Hook)(Address);
+    }
+
+    if((region == REGSIM_NO_REGION) || !RegSim_IsClocked(region))
+    {
+        RegSim_Fault(Address);
+        return REGSIM_NO_REGION;
+    }
+    return region;
+}
+
+/*********************************************************************************************/
+/* Description: Write a word to a region with its side effects */
+static void RegSim_WriteRegion(uint8 Region, uint32 Address, uint32 Value)
+{
+    uint32 offset = Address - RegSim_RegionBase[Region];
+
+    if(Region < REGSIM_PORTS_NUM)
+    {
+        RegSim_GpioWrite(Region, Address, offset, Value);
+    }
+    else if(Region == REGSIM_SYSCTL_REGION)
+    {
+        RegSim_SysCtlWrite(offset, Value);
+    }
+    else if(Region == REGSIM_SCS_REGION)
+    {
+        RegSim_ScsWrite(offset, Value);
+    }
+    else
+    {
+        RegSim_TimerWrite(Region, offset, Value);
+    }
+}
+
+/*********************************************************************************************/
+uint32 RegSim_Read32(uint32 Address)
+{
+    uint8 region;
+    uint32 offset;
+
+    if(Address & 0x3U)
+    {
+        RegSim_Fault(Address);
+        return 0;
+    }
+    region = RegSim_Access(Address);
+    if(region == REGSIM_NO_REGION)
+    {
+        return 0;
+    }
+
+    offset = Address - RegSim_RegionBase[region];
+    if(region < REGSIM_PORTS_NUM)
+    {
+        return RegSim_GpioRead(region, offset);
+    }
+    else if(region == REGSIM_SYSCTL_REGION)
+    {
+        return RegSim_SysCtlRead(offset);
+    }
+    else if(region == REGSIM_SCS_REGION)
+    {
+        return RegSim_ScsRead(offset);
+    }
+    else
+    {
+        return RegSim_TimerRead(region, offset);
+    }
+}
+
+/*********************************************************************************************/
+void RegSim_Write32(uint32 Address, uint32 Value)
+{
+    uint8 region;
+
+    if(Address & 0x3U)
+    {
+        RegSim_Fault(Address);
+        return;
+    }
+    region = RegSim_Access(Address);
+    if(region != REGSIM_NO_REGION)
+    {
+        RegSim_WriteRegion(region, Address, Value);
+    }
+}
+
+/*********************************************************************************************/
+void RegSim_Write8(uint32 Address, uint8 Value)
+{
+    uint8 region = RegSim_Access(Address);
+    uint32 word  = Address & ~0x3U;
+    uint32 shift = (Address & 0x3U) * 8U;
+
+    if(region != REGSIM_NO_REGION)
+    {
+        /* The other bytes of the word keep their stored value, little endian like the part */
+        RegSim_WriteRegion(region, word,
+                           (RegSim_Peek(word) & ~(0xFFUL << shift)) | ((uint32)Value << shift));
+    }
+}
+
+/*********************************************************************************************/
+void RegSim_Reset(void)
+{
+    uint8 region;
+    uint8 port;
+    uint8 pin;
+    uint32 word;
+
+    for(region = 0; region < REGSIM_REGIONS_NUM; region++)
+    {
+        for(word = 0; word < REGSIM_REGION_WORDS; word++)
+        {
+            g_RegSim_Regs[region][word] = 0;
+        }
+    }
+
+    for(port = 0; port < REGSIM_PORTS_NUM; port++)
+    {
+        REGSIM_REG(port, PORT_COMMIT_REG_OFFSET) = ~RegSim_ProtectedPins(port) & 0xFFU;
+        g_RegSim_Unlocked[port] = FALSE;
+        g_RegSim_Driven[port]   = 0;
+        g_RegSim_Driven_Level[port] = 0;
+    }
+
+    /* PC[3:0] come out of reset as the JTAG port */
+    REGSIM_REG(REGSIM_PORTC, PORT_ALT_FUNC_REG_OFFSET)       = REGSIM_PORTC_PROTECTED;
+    REGSIM_REG(REGSIM_PORTC, PORT_DIGITAL_ENABLE_REG_OFFSET) = REGSIM_PORTC_PROTECTED;
+    REGSIM_REG(REGSIM_PORTC, PORT_PULL_UP_REG_OFFSET)        = REGSIM_PORTC_PROTECTED;
+    REGSIM_REG(REGSIM_PORTC, PORT_CTL_REG_OFFSET)            = REGSIM_PORTC_JTAG_PCTL;
+
+    for(port = 0; port < REGSIM_PORTS_NUM; port++)
+    {
+        g_RegSim_Level[port] = RegSim_PinLevels(port);
+        for(pin = 0; pin < REGSIM_PINS_NUM; pin++)
+        {
+            g_RegSim_Edge_Count[port][pin] = 0;
+        }
+    }
+
+    g_RegSim_Ready[REGSIM_READY_GPIO].offset   = REGSIM_PRGPIO_OFFSET;
+    g_RegSim_Ready[REGSIM_READY_TIMER].offset  = REGSIM_PRTIMER_OFFSET;
+    g_RegSim_Ready[REGSIM_READY_WTIMER].offset = REGSIM_PRWTIMER_OFFSET;
+    for(region = 0; region < REGSIM_READY_NUM; region++)
+    {
+        g_RegSim_Ready[region].pending   = 0;
+        g_RegSim_Ready[region].countdown = 0;
+    }
+
+    for(region = 0; region < REGSIM_TIMERS_NUM; region++)
+    {
+        g_RegSim_Prescaled[region] = 0;
+    }
+
+    g_RegSim_Faults     = 0;
+    g_RegSim_Last_Fault = 0;
+    g_RegSim_SysTick_Pending = FALSE;
+}
+
+/*********************************************************************************************/
+void RegSim_SetPinLevel(uint8 PortNum, uint8 PinNum, uint8 Level)
+{
+    g_RegSim_Driven[PortNum] |= (uint8)(1U << PinNum);
+    if(Level == STD_HIGH)
+    {
+        g_RegSim_Driven_Level[PortNum] |= (uint8)(1U << PinNum);
+    }
+    else
+    {
+        g_RegSim_Driven_Level[PortNum] &= (uint8)~(1U << PinNum);
+    }
+    RegSim_UpdatePins(PortNum);
+}
+
+/*********************************************************************************************/
+uint8 RegSim_GetPinLevel(uint8 PortNum, uint8 PinNum)
+{
+    return (RegSim_PinLevels(PortNum) & (1U << PinNum)) ? STD_HIGH : STD_LOW;
+}
+
+/*********************************************************************************************/
+uint32 RegSim_GetEdgeCount(uint8 PortNum, uint8 PinNum)
+{
+    return g_RegSim_Edge_Count[PortNum][PinNum];
+}
+
+/*********************************************************************************************/
+uint32 RegSim_GetFaultCount(void)
+{
+    return g_RegSim_Faults;
+}
+
+/*********************************************************************************************/
+uint32 RegSim_GetLastFaultAddress(void)
+{
+    return g_RegSim_Last_Fault;
+}
+
+/*********************************************************************************************/
+/* Description: Count the cycles on SysTick ... it loads the reload value in the cycle after 0 */
+static void RegSim_ElapseSysTick(uint32 Cycles)
+{
+    uint32 ctrl    = REGSIM_REG(REGSIM_SCS_REGION, REGSIM_SYSTICK_CTRL_OFFSET);
+    uint32 reload  = REGSIM_REG(REGSIM_SCS_REGION, REGSIM_SYSTICK_RELOAD_OFFSET) & 0x00FFFFFFU;
+    uint32 current = REGSIM_REG(REGSIM_SCS_REGION, REGSIM_SYSTICK_CURRENT_OFFSET);
+
+    if(!(ctrl & REGSIM_SYSTICK_ENABLE) || (Cycles == 0))
+    {
+        return;
+    }
+
+    if(current == 0)
+    {
+        current = reload;
+        Cycles--;
+    }
+    if(Cycles < current)
+    {
+        current -= Cycles;
+    }
+    else
+    {
+        /* Reached 0, then counts whole periods of reload + 1 cycles */
+        Cycles -= current;
+        current = (Cycles == 0) ? 0 : (reload - (uint32)((Cycles - 1U) % ((uint64)reload + 1U)));
+        REGSIM_REG(REGSIM_SCS_REGION, REGSIM_SYSTICK_CTRL_OFFSET) |= REGSIM_SYSTICK_COUNT;
+        if(ctrl & REGSIM_SYSTICK_INTEN)
+        {
+            g_RegSim_SysTick_Pending = TRUE;
+        }
+    }
+    REGSIM_REG(REGSIM_SCS_REGION, REGSIM_SYSTICK_CURRENT_OFFSET) = current;
+}
+
+/*********************************************************************************************/
+/* Description: Return the cycles of one count of a timer ... the prescaler divides the wide timers only */
+static uint32 RegSim_TimerCountCycles(uint8 Timer)
+{
+    if(Timer < REGSIM_WIDE_TIMER0)
+    {
+        return 1U;
+    }
+    return (REGSIM_REG(REGSIM_TIMER_REGION(Timer), GPT_TAPR_REG_OFFSET) & REGSIM_WIDE_PRESCALER_MASK) + 1U;
+}
+
+/*********************************************************************************************/
+/* Description: Return TRUE if the Timer A of a timer counts down in one-shot or periodic mode */
+static boolean RegSim_IsTimerCounting(uint8 Timer)
+{
+    uint8 region = REGSIM_TIMER_REGION(Timer);
+    uint32 mode  = REGSIM_REG(region, GPT_TAMR_REG_OFFSET);
+
+    return ((REGSIM_REG(region, GPT_CTL_REG_OFFSET) & REGSIM_TIMER_TAEN) && !(mode & REGSIM_TIMER_COUNT_UP) &&
+            (((mode & REGSIM_TIMER_MODE_MASK) == REGSIM_TIMER_ONE_SHOT) ||
+             ((mode & REGSIM_TIMER_MODE_MASK) == REGSIM_TIMER_PERIODIC))) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************/
+/* Description: Count the cycles on the Timer A of a timer ... the time-out follows the count of 0 */
+static void RegSim_ElapseTimer(uint8 Timer, uint32 Cycles)
+{
+    uint8 region   = REGSIM_TIMER_REGION(Timer);
+    uint32 divider = RegSim_TimerCountCycles(Timer);
+    uint64 counts  = ((uint64)g_RegSim_Prescaled[Timer] + Cycles) / divider;
+    uint64 period  = (uint64)REGSIM_REG(region, GPT_TAILR_REG_OFFSET) + 1U;
+    uint64 left    = (uint64)REGSIM_REG(region, GPT_TAV_REG_OFFSET) + 1U;
+
+    if(RegSim_IsTimerCapturing(Timer))
+    {
+        /* Edge-time mode counts up and wraps without an event, GPTMTAPR extends the 16/32-bit timers */
+        if(Timer < REGSIM_WIDE_TIMER0)
+        {
+            period = ((uint64)(REGSIM_REG(region, GPT_TAPR_REG_OFFSET) & REGSIM_TIMER_CAPTURE_HIGH_MASK) << 16)
+                     + (REGSIM_REG(region, GPT_TAILR_REG_OFFSET) & REGSIM_TIMER_CAPTURE_LOW_MASK) + 1U;
+        }
+        REGSIM_REG(region, GPT_TAV_REG_OFFSET) = (uint32)(((uint64)REGSIM_REG(region, GPT_TAV_REG_OFFSET) + Cycles) % period);
+        return;
+    }
+    if(!RegSim_IsTimerCounting(Timer))
+    {
+        return;
+    }
+    g_RegSim_Prescaled[Timer] = (uint32)(((uint64)g_RegSim_Prescaled[Timer] + Cycles) % divider);
+
+    if(counts < left)
+    {
+        REGSIM_REG(region, GPT_TAV_REG_OFFSET) = (uint32)(left - 1U - counts);
+        return;
+    }
+
+    /* Time-out ... a one-shot timer stops with its start value loaded, a periodic one counts whole periods */
+    REGSIM_REG(region, GPT_RIS_REG_OFFSET) |= REGSIM_TIMER_TATO;
+    if((REGSIM_REG(region, GPT_TAMR_REG_OFFSET) & REGSIM_TIMER_MODE_MASK) == REGSIM_TIMER_ONE_SHOT)
+    {
+        REGSIM_REG(region, GPT_CTL_REG_OFFSET) &= ~REGSIM_TIMER_TAEN;
+        REGSIM_REG(region, GPT_TAV_REG_OFFSET) = (uint32)(period - 1U);
+        g_RegSim_Prescaled[Timer] = 0;
+    }
+    else
+    {
+        REGSIM_REG(region, GPT_TAV_REG_OFFSET) = (uint32)(period - 1U - ((counts - left) % period));
+    }
+}
+
+/*********************************************************************************************/
+void RegSim_Elapse(uint32 Cycles)
+{
+    uint8 timer;
+
+    RegSim_ElapseSysTick(Cycles);
+    for(timer = 0; timer < REGSIM_TIMERS_NUM; timer++)
+    {
+        RegSim_ElapseTimer(timer, Cycles);
+    }
+}
+
+/*********************************************************************************************/
+uint32 RegSim_GetEventCycles(void)
+{
+    uint32 cycles = RegSim_GetSysTickCycles();
+    uint64 timeout;
+    uint8 timer;
+
+    for(timer = 0; timer < REGSIM_TIMERS_NUM; timer++)
+    {
+        if(RegSim_IsTimerCounting(timer))
+        {
+            timeout = (((uint64)REGSIM_REG(REGSIM_TIMER_REGION(timer), GPT_TAV_REG_OFFSET) + 1U) * RegSim_TimerCountCycles(timer))
+                      - g_RegSim_Prescaled[timer];
+            if(timeout > 0xFFFFFFFFU)
+            {
+                timeout = 0xFFFFFFFFU;
+            }
+            if((cycles == 0) || (timeout < cycles))
+            {
+                cycles = (uint32)timeout;
+            }
+        }
+    }
+    return cycles;
+}
+
+/*********************************************************************************************/
+boolean RegSim_IsIrqPending(uint8 Irq)
+{
+    uint8 timer;
+    uint8 region;
+
+    if(!(REGSIM_REG(REGSIM_SCS_REGION, REGSIM_NVIC_EN0_OFFSET + (4U * (Irq / 32U))) & (1UL << (Irq % 32U))))
+    {
+        return FALSE;
+    }
+    for(timer = 0; timer < REGSIM_TIMERS_NUM; timer++)
+    {
+        region = REGSIM_TIMER_REGION(timer);
+        if((RegSim_TimerIrq[timer] == Irq) &&
+           (REGSIM_REG(region, GPT_RIS_REG_OFFSET) & REGSIM_REG(region, GPT_IMR_REG_OFFSET)))
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/*********************************************************************************************/
+uint32 RegSim_GetSysTickCycles(void)
+{
+    uint32 current = REGSIM_REG(REGSIM_SCS_REGION, REGSIM_SYSTICK_CURRENT_OFFSET);
+
+    if(!(REGSIM_REG(REGSIM_SCS_REGION, REGSIM_SYSTICK_CTRL_OFFSET) & REGSIM_SYSTICK_ENABLE))
+    {
+        return 0;
+    }
+    return (current == 0) ? ((REGSIM_REG(REGSIM_SCS_REGION, REGSIM_SYSTICK_RELOAD_OFFSET) & 0x00FFFFFFU) + 1U) : current;
+}
+
+/*********************************************************************************************/
+boolean RegSim_TakeSysTickInterrupt(void)
+{
+    boolean pending = g_RegSim_SysTick_Pending;
+
+    g_RegSim_SysTick_Pending = FALSE;
+    return pending;
+}
+
+/*********************************************************************************************/
+void RegSim_SetAccessHook(RegSim_AccessHookType Hook)
+{
+    g_RegSim_Access_Hook = Hook;
+}
+
+/*********************************************************************************************/
+uint32 RegSim_Peek(uint32 Address)
+{
+    uint8 region = RegSim_FindRegion(Address);
+
+    if(region == REGSIM_NO_REGION)
+    {
+        return 0;
+    }
+    return g_RegSim_Regs[region][(Address - RegSim_RegionBase[region]) >> 2];
+}
+
+/* Description: Name of a register at an offset of a region */
+typedef struct
+{
+    uint32 offset;
+    const char * name;
+}RegSim_NameType;
+
+static const char * const RegSim_RegionName[REGSIM_REGIONS_NUM] =
+{
+    "GPIOA", "GPIOB", "GPIOC", "GPIOD", "GPIOE", "GPIOF", "SYSCTL",
+    "TIMER0", "TIMER1", "TIMER2", "TIMER3", "TIMER4", "TIMER5",
+    "WTIMER0", "WTIMER1", "WTIMER2", "WTIMER3", "WTIMER4", "WTIMER5", "SCS"
+};
+
+static const RegSim_NameType RegSim_GpioNames[] =
+{
+    {PORT_DIR_REG_OFFSET, "DIR"}, {REGSIM_GPIO_IS_OFFSET, "IS"}, {REGSIM_GPIO_IBE_OFFSET, "IBE"},
+    {REGSIM_GPIO_IEV_OFFSET, "IEV"}, {REGSIM_GPIO_IM_OFFSET, "IM"}, {REGSIM_GPIO_RIS_OFFSET, "RIS"},
+    {REGSIM_GPIO_MIS_OFFSET, "MIS"}, {REGSIM_GPIO_ICR_OFFSET, "ICR"}, {PORT_ALT_FUNC_REG_OFFSET, "AFSEL"},
+    {PORT_PULL_UP_REG_OFFSET, "PUR"}, {PORT_PULL_DOWN_REG_OFFSET, "PDR"}, {PORT_DIGITAL_ENABLE_REG_OFFSET, "DEN"},
+    {PORT_LOCK_REG_OFFSET, "LOCK"}, {PORT_COMMIT_REG_OFFSET, "CR"}, {PORT_ANALOG_MODE_SEL_REG_OFFSET, "AMSEL"},
+    {PORT_CTL_REG_OFFSET, "PCTL"}
+};
+
+static const RegSim_NameType RegSim_SysCtlNames[] =
+{
+    {REGSIM_RCGC2_OFFSET, "RCGC2"}, {REGSIM_RCGCTIMER_OFFSET, "RCGCTIMER"}, {REGSIM_RCGCGPIO_OFFSET, "RCGCGPIO"},
+    {REGSIM_RCGCWTIMER_OFFSET, "RCGCWTIMER"}, {REGSIM_PRTIMER_OFFSET, "PRTIMER"}, {REGSIM_PRGPIO_OFFSET, "PRGPIO"},
+    {REGSIM_PRWTIMER_OFFSET, "PRWTIMER"}
+};
+
+static const RegSim_NameType RegSim_TimerNames[] =
+{
+    {GPT_CFG_REG_OFFSET, "CFG"}, {GPT_TAMR_REG_OFFSET, "TAMR"}, {GPT_CTL_REG_OFFSET, "CTL"},
+    {GPT_IMR_REG_OFFSET, "IMR"}, {GPT_RIS_REG_OFFSET, "RIS"}, {GPT_MIS_REG_OFFSET, "MIS"},
+    {GPT_ICR_REG_OFFSET, "ICR"}, {GPT_TAILR_REG_OFFSET, "TAILR"}, {GPT_TAPR_REG_OFFSET, "TAPR"},
+    {GPT_TAR_REG_OFFSET, "TAR"}, {GPT_TAV_REG_OFFSET, "TAV"}
+};
+
+static const RegSim_NameType RegSim_ScsNames[] =
+{
+    {SYSTICK_CTRL_ADDRESS - REGSIM_SCS_BASE_ADDRESS, "SYSTICK CTRL"},
+    {SYSTICK_RELOAD_ADDRESS - REGSIM_SCS_BASE_ADDRESS, "SYSTICK RELOAD"},
+    {REGSIM_SYSTICK_CURRENT_OFFSET, "SYSTICK CURRENT"},
+    {NVIC_SYSTEM_PRI3_ADDRESS - REGSIM_SCS_BASE_ADDRESS, "SYSPRI3"}
+};
+
+/* Description: Return the name of the register at an offset in a table, NULL if not there */
+static const char * RegSim_FindName(const RegSim_NameType * Names, uint32 Count, uint32 Offset)
+{
+    uint32 index;
+
+    for(index = 0; index < Count; index++)
+    {
+        if(Names[index].offset == Offset)
+        {
+            return Names[index].name;
+        }
+    }
+    return NULL;
+}
+
+#define REGSIM_NAMES_NUM(NAMES)     (sizeof(NAMES) / sizeof((NAMES)[0]))
+
+/*********************************************************************************************/
+void RegSim_GetRegisterName(uint32 Address, char * Name, uint32 Size)
+{
+    uint8 region = RegSim_FindRegion(Address);
+    uint32 offset;
+    const char * name = NULL;
+
+    if(region == REGSIM_NO_REGION)
+    {
+        (void)snprintf(Name, Size, "0x%08X", Address);
+        return;
+    }
+
+    offset = Address - RegSim_RegionBase[region];
+    if(region < REGSIM_PORTS_NUM)
+    {
+        if(offset <= PORT_DATA_REG_OFFSET)
+        {
+            /* The address bits [9:2] select the bits of GPIODATA */
+            (void)snprintf(Name, Size, "%s DATA[0x%02X]", RegSim_RegionName[region], offset >> 2);
+            return;
+        }
+        name = RegSim_FindName(RegSim_GpioNames, REGSIM_NAMES_NUM(RegSim_GpioNames), offset);
+    }
+    else if(region == REGSIM_SYSCTL_REGION)
+    {
+        name = RegSim_FindName(RegSim_SysCtlNames, REGSIM_NAMES_NUM(RegSim_SysCtlNames), offset);
+    }
+    else if(region == REGSIM_SCS_REGION)
+    {
+        if((offset >= REGSIM_NVIC_EN0_OFFSET) && (offset < (REGSIM_NVIC_EN0_OFFSET + (4U * REGSIM_NVIC_WORDS))))
+        {
+            (void)snprintf(Name, Size, "NVIC EN%u", (offset - REGSIM_NVIC_EN0_OFFSET) / 4U);
+            return;
+        }
+        if((offset >= REGSIM_NVIC_DIS0_OFFSET) && (offset < (REGSIM_NVIC_DIS0_OFFSET + (4U * REGSIM_NVIC_WORDS))))
+        {
+            (void)snprintf(Name, Size, "NVIC DIS%u", (offset - REGSIM_NVIC_DIS0_OFFSET) / 4U);
+            return;
+        }
+        if((Address >= NVIC_PRI0_ADDRESS) && (Address < (NVIC_PRI0_ADDRESS + 140U)))
+        {
+            /* One priority byte per interrupt */
+            (void)snprintf(Name, Size, "NVIC PRI IRQ%u", Address - NVIC_PRI0_ADDRESS);
+            return;
+        }
+        name = RegSim_FindName(RegSim_ScsNames, REGSIM_NAMES_NUM(RegSim_ScsNames), offset);
+    }
+    else
+    {
+        name = RegSim_FindName(RegSim_TimerNames, REGSIM_NAMES_NUM(RegSim_TimerNames), offset);
+    }
+
+    if((name != NULL) && (region == REGSIM_SCS_REGION))
+    {
+        (void)snprintf(Name, Size, "%s", name);
+    }
+    else if(name != NULL)
+    {
+        (void)snprintf(Name, Size, "%s %s", RegSim_RegionName[region], name);
+    }
+    else
+    {
+        (void)snprintf(Name, Size, "%s+0x%03X", RegSim_RegionName[region], offset);
+    }
+}
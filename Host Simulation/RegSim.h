@@ -0,0 +1,77 @@
+ /******************************************************************************
+ *
+ * Module: Host Simulation
+ *
+ * File Name: RegSim.h
+ *
+ * Description: Header file for the simulated register file behind Reg_Access.h
+ *              in host builds. The GPIO ports, the System Control, the general
+ *              purpose timers and the System Control Space (SysTick and NVIC) are
+ *              kept in RAM with the side effects the Port, Dio and Gpt Drivers
+ *              rely on, so the unmodified drivers run on a PC.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef REGSIM_H
+#define REGSIM_H
+
+#include "Reg_Access.h"
+
+/* Number of the simulated GPIO ports and pins per port */
+#define REGSIM_PORTS_NUM            (6U)
+#define REGSIM_PINS_NUM             (8U)
+
+/* Description: Put every register in its reset state, all the clocks gated, no pin driven from outside */
+void RegSim_Reset(void);
+
+/* Description: Drive the level of a pin from the simulated environment, it is read when the pin is an input */
+void RegSim_SetPinLevel(uint8 PortNum, uint8 PinNum, uint8 Level);
+
+/* Description: Return the level of a pin ... the GPIODATA bit of an output, else the driven level
+ *              or the pull-up or pull-down of a floating input */
+uint8 RegSim_GetPinLevel(uint8 PortNum, uint8 PinNum);
+
+/* Description: Return the number of level changes of a pin since RegSim_Reset */
+uint32 RegSim_GetEdgeCount(uint8 PortNum, uint8 PinNum);
+
+/* Description: Return the number of accesses the hardware would fault or ignore: unmapped addresses
+ *              and peripherals accessed before their clock is enabled and ready */
+uint32 RegSim_GetFaultCount(void);
+
+/* Description: Return the address of the last faulting access, 0 if none */
+uint32 RegSim_GetLastFaultAddress(void);
+
+/* Description: Count Cycles System clock cycles on the enabled SysTick Timer and GPTM Timers A.
+ *              SysTick reaching 0 sets COUNT and, with INTEN, the pending SysTick interrupt,
+ *              a time-out of a timer sets its TATORIS */
+void RegSim_Elapse(uint32 Cycles);
+
+/* Description: Return the cycles until SysTick reaches 0, 0 while it is disabled */
+uint32 RegSim_GetSysTickCycles(void);
+
+/* Description: Return the cycles until SysTick reaches 0 or the next time-out of a timer, 0 if none counts */
+uint32 RegSim_GetEventCycles(void);
+
+/* Description: Return TRUE if the interrupt Irq of a Timer A is enabled in the NVIC and its masked
+ *              status is set ... the caller then runs the ISR, which clears the status */
+boolean RegSim_IsIrqPending(uint8 Irq);
+
+/* Description: Return TRUE once SysTick reached 0 with its interrupt enabled, and clear the pending interrupt
+ *              like the exception entry does ... the caller then runs SysTick_Handler */
+boolean RegSim_TakeSysTickInterrupt(void);
+
+/* Description: Function called on every register access before its effect */
+typedef void (*RegSim_AccessHookType)(uint32 Address);
+
+/* Description: Call Hook on every register access, NULL_PTR for none. RegSim_Reset keeps it */
+void RegSim_SetAccessHook(RegSim_AccessHookType Hook);
+
+/* Description: Return the stored value of a register without the side effects of a read, 0 if unmapped */
+uint32 RegSim_Peek(uint32 Address);
+
+/* Description: Write the name of the register at Address to Name, like "GPIOF DEN" or "NVIC EN0",
+ *              the region and the offset for the registers without a name */
+void RegSim_GetRegisterName(uint32 Address, char * Name, uint32 Size);
+
+#endif /* REGSIM_H */
@@ -0,0 +1,178 @@
+ /******************************************************************************
+ *
+ * Module: Host Tools
+ *
+ * File Name: Det_LogDecoder.c
+ *
+ * Description: Host tool printing a RAM dump of Det_Log as a table of the
+ *              logged development errors, oldest first. The records being
+ *              written or overwritten when the dump was taken are skipped.
+ *
+ *              Build: gcc -DHOST_BUILD -I"../IAR Workspace" Det_LogDecoder.c -o Det_LogDecoder
+ *              Usage: Det_LogDecoder <dump.bin>
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Det.h"
+
+/* Number of the header words before the records in Det_LogType */
+#define DECODER_HEADER_WORDS    (5U)
+
+/* Number of the words of one Det_RecordType */
+#define DECODER_RECORD_WORDS    (5U)
+
+/* Module Ids of the drivers of the project */
+typedef struct
+{
+    uint16 id;
+    const char * name;
+}Decoder_ModuleType;
+
+static const Decoder_ModuleType Decoder_Modules[] =
+{
+    {15U, "Det"}, {100U, "Gpt"}, {101U, "Mcu"}, {120U, "Dio"}, {122U, "Icu"}, {124U, "Port"}
+};
+
+/* Read one little endian 32-bit word from the dump */
+static int Decoder_ReadWord(FILE * File, uint32 * Word)
+{
+    uint8 bytes[4];
+
+    if(fread(bytes, 1, sizeof(bytes), File) != sizeof(bytes))
+    {
+        return 0;
+    }
+    *Word = (uint32)bytes[0] | ((uint32)bytes[1] << 8) | ((uint32)bytes[2] << 16) | ((uint32)bytes[3] << 24);
+    return 1;
+}
+
+/* Name of a module Id, NULL if unknown */
+static const char * Decoder_ModuleName(uint16 Id)
+{
+    uint32 index;
+
+    for(index = 0; index < (sizeof(Decoder_Modules) / sizeof(Decoder_Modules[0])); index++)
+    {
+        if(Decoder_Modules[index].id == Id)
+        {
+            return Decoder_Modules[index].name;
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char * argv[])
+{
+    FILE * file;
+    uint32 header[DECODER_HEADER_WORDS];
+    uint32 * records;
+    uint32 * record;
+    uint32 count, first, index, skipped = 0;
+    uint64 timestamp;
+    uint16 module_id;
+    const char * name;
+    char default_name[8];
+
+    if(argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <dump.bin>\n", argv[0]);
+        return 1;
+    }
+
+    file = fopen(argv[1], "rb");
+    if(file == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    /* magic, clock_hz, size, head, resets */
+    for(index = 0; index < DECODER_HEADER_WORDS; index++)
+    {
+        if(!Decoder_ReadWord(file, &header[index]))
+        {
+            fprintf(stderr, "%s: truncated header\n", argv[1]);
+            return 1;
+        }
+    }
+    if(header[0] != DET_LOG_MAGIC)
+    {
+        fprintf(stderr, "%s: not a Det log dump (magic 0x%08X)\n", argv[1], header[0]);
+        return 1;
+    }
+    if((header[2] == 0) || ((header[2] & (header[2] - 1)) != 0))
+    {
+        fprintf(stderr, "%s: corrupted header\n", argv[1]);
+        return 1;
+    }
+
+    records = malloc(header[2] * DECODER_RECORD_WORDS * sizeof(uint32));
+    for(index = 0; index < (header[2] * DECODER_RECORD_WORDS); index++)
+    {
+        if(!Decoder_ReadWord(file, &records[index]))
+        {
+            fprintf(stderr, "%s: truncated records\n", argv[1]);
+            return 1;
+        }
+    }
+    fclose(file);
+
+    /* Once the ring buffer wrapped around the oldest record is the one at head */
+    if(header[3] > header[2])
+    {
+        count = header[2];
+        first = header[3] - header[2];
+    }
+    else
+    {
+        count = header[3];
+        first = 0;
+    }
+
+    printf("%u errors reported, %u kept, %u warm resets, timestamps at %u Hz\n",
+           header[3], count, header[4], header[1]);
+    printf("%10s %14s  %-10s %8s %5s %5s\n", "number", "time [us]", "module", "instance", "api", "error");
+
+    for(index = first; index != (first + count); index++)
+    {
+        /* sequence, module_id | instance_id << 16 | api_id << 24, error_id, timestamp_low, timestamp_high */
+        record = &records[(index & (header[2] - 1)) * DECODER_RECORD_WORDS];
+
+        /* A record is valid only if it was completely written for this error number */
+        if(record[0] != (index + 1))
+        {
+            skipped++;
+            continue;
+        }
+
+        module_id = (uint16)(record[1] & 0xFFFF);
+        name      = Decoder_ModuleName(module_id);
+        if(name == NULL)
+        {
+            snprintf(default_name, sizeof(default_name), "%u", module_id);
+            name = default_name;
+        }
+        timestamp = ((uint64)record[4] << 32) | record[3];
+
+        if((header[1] == 0) || (timestamp == 0))
+        {
+            printf("%10u %14s", index, "-");
+        }
+        else
+        {
+            printf("%10u %14.3f", index, (double)timestamp * 1e6 / header[1]);
+        }
+        printf("  %-10s %8u  0x%02X  0x%02X\n",
+               name, (record[1] >> 16) & 0xFF, (record[1] >> 24) & 0xFF, record[2] & 0xFF);
+    }
+
+    if(skipped != 0)
+    {
+        printf("%u records skipped, written during the dump or interrupted by a reset\n", skipped);
+    }
+    free(records);
+    return 0;
+}
@@ -0,0 +1,134 @@
+ /******************************************************************************
+ *
+ * Module: Host Tools
+ *
+ * File Name: Os_MailboxStress.c
+ *
+ * Description: Host stress test of the Os mailboxes. A producer thread sends
+ *              a sequence of numbers in batches of random size and a consumer
+ *              thread running concurrently receives them in batches of
+ *              random size, checking that no element is lost, duplicated or
+ *              read before it is completely written.
+ *
+ *              Build: gcc -O2 -pthread -DHOST_BUILD -I"../IAR Workspace"
+ *                         Os_MailboxStress.c "../IAR Workspace/Os_Mailbox.c" -o Os_MailboxStress
+ *              Usage: Os_MailboxStress [elements]
+ *              Exit status is 0 when the consumer received the whole sequence in order.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include "Os_Mailbox.h"
+#include "Cpu.h"
+
+/* Default number of the elements sent through the mailbox */
+#define STRESS_DEFAULT_ELEMENTS     (10000000U)
+
+/* Mailbox capacity and largest batch */
+#define STRESS_CAPACITY             (64U)
+#define STRESS_MAX_BATCH            (24U)
+
+/* Element made of two words ... a torn read gives two different words */
+typedef struct
+{
+    uint32 sequence;
+    uint32 check;
+}Stress_ElementType;
+
+static Stress_ElementType g_Stress_Buffer[STRESS_CAPACITY];
+static Os_MailboxType g_Stress_Mailbox;
+static uint32 g_Stress_Elements;
+
+/*********************************************************************************************/
+static void * Stress_Producer(void * Arg)
+{
+    Stress_ElementType batch[STRESS_MAX_BATCH];
+    uint32 sequence = 0;
+    uint32 seed = 1;
+    uint16 count;
+    uint16 sent;
+    uint16 index;
+
+    (void)Arg;
+    while(sequence < g_Stress_Elements)
+    {
+        count = (uint16)(1U + (rand_r(&seed) % STRESS_MAX_BATCH));
+        if(count > (g_Stress_Elements - sequence))
+        {
+            count = (uint16)(g_Stress_Elements - sequence);
+        }
+        for(index = 0; index < count; index++)
+        {
+            batch[index].sequence = sequence + index;
+            batch[index].check    = ~(sequence + index);
+        }
+
+        /* Send the whole batch ... retry the rest while the mailbox is full */
+        sent = (uint16)Os_MailboxSend(&g_Stress_Mailbox, batch, count);
+        while(sent < count)
+        {
+            /* Let the consumer run in case both threads share one core */
+            (void)sched_yield();
+            sent = (uint16)(sent + Os_MailboxSend(&g_Stress_Mailbox, &batch[sent], (uint16)(count - sent)));
+        }
+        sequence += count;
+    }
+    return NULL;
+}
+
+int main(int argc, char * argv[])
+{
+    Stress_ElementType batch[STRESS_MAX_BATCH];
+    pthread_t producer;
+    uint32 expected = 0;
+    uint32 errors = 0;
+    uint32 seed = 2;
+    uint32 start_time;
+    uint32 elapsed;
+    uint16 received;
+    uint16 index;
+
+    g_Stress_Elements = (argc > 1) ? (uint32)strtoul(argv[1], NULL, 0) : STRESS_DEFAULT_ELEMENTS;
+    if(Os_MailboxInit(&g_Stress_Mailbox, g_Stress_Buffer, sizeof(Stress_ElementType), STRESS_CAPACITY) != E_OK)
+    {
+        printf("FAIL: mailbox initialization\n");
+        return 1;
+    }
+
+    start_time = Cpu_GetCycleCount();
+    pthread_create(&producer, NULL, Stress_Producer, NULL);
+
+    while(expected < g_Stress_Elements)
+    {
+        received = Os_MailboxReceive(&g_Stress_Mailbox, batch, (uint16)(1U + (rand_r(&seed) % STRESS_MAX_BATCH)));
+        if(received == 0)
+        {
+            (void)sched_yield();
+        }
+        for(index = 0; index < received; index++)
+        {
+            if((batch[index].sequence != expected) || (batch[index].check != ~expected))
+            {
+                errors++;
+            }
+            expected++;
+        }
+    }
+    pthread_join(producer, NULL);
+    elapsed = Cpu_GetCycleCount() - start_time;
+
+    printf("elements          : %u, %u left in the mailbox\n", expected, Os_MailboxCount(&g_Stress_Mailbox));
+    printf("throughput        : %.1f ns per element\n", (double)elapsed / expected);
+
+    if((errors != 0) || (Os_MailboxCount(&g_Stress_Mailbox) != 0))
+    {
+        printf("FAIL: %u elements lost, duplicated or torn\n", errors);
+        return 1;
+    }
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,146 @@
+ /******************************************************************************
+ *
+ * Module: Host Tools
+ *
+ * File Name: Os_ReadyQueueBench.c
+ *
+ * Description: Host microbenchmark of the selection of the highest priority
+ *              ready task: the priority bitmap of the preemptive Os kernel
+ *              with Cpu_CountLeadingZeros and with its portable fallback,
+ *              against a linear scan of a ready flag per task.
+ *
+ *              Build: gcc -O2 -DHOST_BUILD -I"../IAR Workspace" Os_ReadyQueueBench.c -o Os_ReadyQueueBench
+ *              Usage: Os_ReadyQueueBench [selections per case]
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Cpu.h"
+
+/* Number of the random ready sets replayed by every case */
+#define BENCH_SETS_NUM          (1024U)
+
+/* Default number of the selections measured by every case */
+#define BENCH_DEFAULT_LOOPS     (10000000U)
+
+/* Ready sets in both representations ... bitmap with priority 0 at bit 31 and one flag per priority */
+static uint32 g_Bench_Bitmap[BENCH_SETS_NUM];
+static boolean g_Bench_Flags[BENCH_SETS_NUM][32];
+
+/* Sum of the selected priorities ... keeps the compiler from removing the selections */
+static volatile uint32 g_Bench_Sink;
+
+/* Fill the ready sets of Tasks tasks ... random sets, or only the lowest priority task ready as the worst case of a scan */
+static void Bench_FillSets(uint8 Tasks, boolean WorstCase)
+{
+    uint32 set;
+    uint8 priority;
+
+    for(set = 0; set < BENCH_SETS_NUM; set++)
+    {
+        g_Bench_Bitmap[set] = 0;
+        for(priority = 0; priority < 32; priority++)
+        {
+            g_Bench_Flags[set][priority] = FALSE;
+            if(priority < Tasks)
+            {
+                if(WorstCase ? (priority == (Tasks - 1)) : ((rand() % 4) == 0))
+                {
+                    g_Bench_Flags[set][priority] = TRUE;
+                    g_Bench_Bitmap[set] |= (0x80000000U >> priority);
+                }
+            }
+        }
+    }
+}
+
+/* Highest priority ready task by a linear scan, Tasks when no task is ready */
+static uint8 Bench_LinearScan(const boolean * Flags, uint8 Tasks)
+{
+    uint8 priority = 0;
+
+    while((priority < Tasks) && (Flags[priority] == FALSE))
+    {
+        priority++;
+    }
+    return priority;
+}
+
+/* Return the mean ns per selection of the method Method over Loops selections */
+static double Bench_Run(uint8 Method, uint8 Tasks, uint32 Loops)
+{
+    uint32 loop;
+    uint32 sum = 0;
+    uint32 start;
+    uint32 elapsed;
+
+    start = Cpu_GetCycleCount();
+    for(loop = 0; loop < Loops; loop++)
+    {
+        uint32 set = loop & (BENCH_SETS_NUM - 1);
+        switch(Method)
+        {
+        case 0:
+            sum += Cpu_CountLeadingZeros(g_Bench_Bitmap[set]);
+            break;
+        case 1:
+            sum += Cpu_CountLeadingZerosGeneric(g_Bench_Bitmap[set]);
+            break;
+        default:
+            sum += Bench_LinearScan(g_Bench_Flags[set], Tasks);
+            break;
+        }
+    }
+    elapsed = Cpu_GetCycleCount() - start;
+    g_Bench_Sink = sum;
+
+    return (double)elapsed / Loops;
+}
+
+int main(int argc, char * argv[])
+{
+    static const uint8 tasks_num[] = {8, 16, 32};
+    static const char * const method_name[] = {"bitmap clz", "bitmap generic", "linear scan"};
+    uint32 loops = (argc > 1) ? (uint32)strtoul(argv[1], NULL, 0) : BENCH_DEFAULT_LOOPS;
+    uint32 set;
+    uint8 worst_case;
+    uint8 index;
+    uint8 method;
+
+    /* Check the three methods agree before timing them */
+    for(index = 0; index < sizeof(tasks_num); index++)
+    {
+        Bench_FillSets(tasks_num[index], FALSE);
+        for(set = 0; set < BENCH_SETS_NUM; set++)
+        {
+            uint8 expected = Bench_LinearScan(g_Bench_Flags[set], tasks_num[index]);
+            uint8 clz = Cpu_CountLeadingZeros(g_Bench_Bitmap[set]);
+            uint8 generic = Cpu_CountLeadingZerosGeneric(g_Bench_Bitmap[set]);
+
+            /* An empty set gives 32 leading zeros ... any value from Tasks selects the idle thread */
+            if((((clz < tasks_num[index]) ? clz : tasks_num[index]) != expected) || (generic != clz))
+            {
+                printf("FAIL: %u tasks, ready set 0x%08X\n", tasks_num[index], g_Bench_Bitmap[set]);
+                return 1;
+            }
+        }
+    }
+
+    printf("tasks,ready set,method,ns per selection\n");
+    for(worst_case = 0; worst_case < 2; worst_case++)
+    {
+        for(index = 0; index < sizeof(tasks_num); index++)
+        {
+            srand(1);
+            Bench_FillSets(tasks_num[index], worst_case);
+            for(method = 0; method < 3; method++)
+            {
+                printf("%u,%s,%s,%.2f\n", tasks_num[index], worst_case ? "lowest only" : "random",
+                       method_name[method], Bench_Run(method, tasks_num[index], loops));
+            }
+        }
+    }
+    return 0;
+}
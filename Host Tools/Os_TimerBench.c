@@ -0,0 +1,172 @@
+ /******************************************************************************
+ *
+ * Module: Host Tools
+ *
+ * File Name: Os_TimerBench.c
+ *
+ * Description: Host check and benchmark of the Os software timers. Thousands
+ *              of one-shot and periodic timers with random timeouts are
+ *              started, stopped and restarted from their callbacks, and
+ *              every expiry is compared with the tick expected by a
+ *              reference model.
+ *
+ *              Build: gcc -O2 -DHOST_BUILD -DOS_TIMERS_NUM=4096U -I"../IAR Workspace"
+ *                         Os_TimerBench.c "../IAR Workspace/Os_Timer.c" -o Os_TimerBench
+ *              Usage: Os_TimerBench [ticks]
+ *              Exit status is 0 when every timer expired on its expected tick.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Os_Timer.h"
+#include "Cpu.h"
+
+#if (OS_TIMER_API == STD_OFF)
+  #error "The benchmark needs OS_TIMER_API"
+#endif
+
+/* Default number of the processed ticks */
+#define BENCH_DEFAULT_TICKS     (1000000U)
+
+/* Reference model of every timer */
+typedef struct
+{
+    boolean running;
+    Os_TickType expires;
+    Os_TickType period;
+}Bench_TimerType;
+
+static Bench_TimerType g_Bench_Timer[OS_TIMERS_NUM];
+
+/* Tick being processed */
+static Os_TickType g_Bench_Tick = 0;
+
+/* Statistics */
+static uint32 g_Bench_Expiries = 0;
+static uint32 g_Bench_Errors = 0;
+static uint32 g_Bench_Starts = 0;
+static uint64 g_Bench_Start_Time = 0;
+
+/* Random timeout in ms ... mostly short, some reaching the upper levels of the wheel */
+static uint32 Bench_RandomTime(void)
+{
+    switch(rand() % 4)
+    {
+    case 0:  return (uint32)(rand() % (64 * OS_BASE_TIME));
+    case 1:  return (uint32)(rand() % (4096 * OS_BASE_TIME));
+    case 2:  return (uint32)(rand() % (262144 * OS_BASE_TIME));
+    default: return (uint32)(((uint32)rand() << 8) % (OS_TIMER_MAX_TICKS * OS_BASE_TIME));
+    }
+}
+
+/* Start the timer TimerId in the wheel and in the reference model */
+static void Bench_Start(Os_TimerIdType TimerId)
+{
+    uint32 timeout = Bench_RandomTime();
+    uint32 period = ((rand() % 2) == 0) ? 0 : (1U + Bench_RandomTime());
+    Os_TickType ticks = (timeout + OS_BASE_TIME - 1U) / OS_BASE_TIME;
+    uint32 start_time;
+
+    start_time = Cpu_GetCycleCount();
+    (void)Os_TimerStart(TimerId, timeout, period);
+    g_Bench_Start_Time += Cpu_GetCycleCount() - start_time;
+    g_Bench_Starts++;
+
+    g_Bench_Timer[TimerId].running = TRUE;
+    g_Bench_Timer[TimerId].expires = g_Bench_Tick + ((ticks == 0) ? 1U : ticks);
+    g_Bench_Timer[TimerId].period  = (period + OS_BASE_TIME - 1U) / OS_BASE_TIME;
+}
+
+/* Expiry callback ... check the tick then stop or restart some timers at random */
+static void Bench_Callback(Os_TimerIdType TimerId)
+{
+    Bench_TimerType * timer = &g_Bench_Timer[TimerId];
+    Os_TimerIdType other = (Os_TimerIdType)(rand() % OS_TIMERS_NUM);
+
+    g_Bench_Expiries++;
+    if((!timer->running) || (timer->expires != g_Bench_Tick))
+    {
+        g_Bench_Errors++;
+    }
+    if(timer->period != 0)
+    {
+        timer->expires = g_Bench_Tick + timer->period;
+    }
+    else
+    {
+        timer->running = FALSE;
+    }
+
+    switch(rand() % 8)
+    {
+    case 0:
+        (void)Os_TimerStop(other);
+        g_Bench_Timer[other].running = FALSE;
+        break;
+    case 1:
+        Bench_Start(other);
+        break;
+    default:
+        if(!timer->running)
+        {
+            Bench_Start(TimerId);
+        }
+        break;
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    Os_TickType ticks = (argc > 1) ? (Os_TickType)strtoul(argv[1], NULL, 0) : BENCH_DEFAULT_TICKS;
+    Os_TimerIdType timer_id;
+    uint32 running = 0;
+    uint32 start_time;
+    uint32 process_time;
+
+    srand(1);
+    Os_TimerInit();
+    for(timer_id = 0; timer_id < OS_TIMERS_NUM; timer_id++)
+    {
+        Os_TimerIdType id;
+        if((Os_TimerAlloc(Bench_Callback, &id) != E_OK) || (id != timer_id))
+        {
+            printf("FAIL: allocation of the timer %u\n", timer_id);
+            return 1;
+        }
+        Bench_Start(timer_id);
+    }
+
+    start_time = Cpu_GetCycleCount();
+    while(g_Bench_Tick != ticks)
+    {
+        g_Bench_Tick++;
+        Os_TimerProcess(g_Bench_Tick);
+    }
+    process_time = Cpu_GetCycleCount() - start_time;
+
+    /* Every running timer of the model shall still be active and due later */
+    for(timer_id = 0; timer_id < OS_TIMERS_NUM; timer_id++)
+    {
+        if(Os_TimerIsActive(timer_id) != g_Bench_Timer[timer_id].running)
+        {
+            g_Bench_Errors++;
+        }
+        running += g_Bench_Timer[timer_id].running ? 1U : 0U;
+    }
+
+    printf("timers            : %u (%u running at the end)\n", OS_TIMERS_NUM, running);
+    printf("ticks             : %u\n", ticks);
+    printf("expiries          : %u\n", g_Bench_Expiries);
+    printf("starts            : %u, %.1f ns each\n", g_Bench_Starts, (double)g_Bench_Start_Time / g_Bench_Starts);
+    printf("process           : %.1f ns per tick, including the callbacks\n", (double)process_time / ticks);
+
+    if(g_Bench_Errors != 0)
+    {
+        printf("FAIL: %u timers expired on a wrong tick\n", g_Bench_Errors);
+        return 1;
+    }
+    printf("PASS\n");
+    return 0;
+}
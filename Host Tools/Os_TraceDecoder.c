@@ -0,0 +1,169 @@
+ /******************************************************************************
+ *
+ * Module: Host Tools
+ *
+ * File Name: Os_TraceDecoder.c
+ *
+ * Description: Host tool converting a RAM dump of Os_TraceBuffer into the
+ *              Chrome trace JSON format (chrome://tracing, ui.perfetto.dev).
+ *
+ *              Build: gcc -DHOST_BUILD -I"../IAR Workspace" Os_TraceDecoder.c -o Os_TraceDecoder
+ *              Usage: Os_TraceDecoder <dump.bin> [task0 name] [task1 name] ... > trace.json
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Os_Trace.h"
+
+/* Number of the header words before the records in Os_TraceBufferType */
+#define DECODER_HEADER_WORDS    (6U)
+
+/* Maximum number of the task ids in a record */
+#define DECODER_MAX_TASKS       (OS_TRACE_ID_MASK + 1)
+
+/* Read one little endian 32-bit word from the dump */
+static int Decoder_ReadWord(FILE * File, uint32 * Word)
+{
+    uint8 bytes[4];
+
+    if(fread(bytes, 1, sizeof(bytes), File) != sizeof(bytes))
+    {
+        return 0;
+    }
+    *Word = (uint32)bytes[0] | ((uint32)bytes[1] << 8) | ((uint32)bytes[2] << 16) | ((uint32)bytes[3] << 24);
+    return 1;
+}
+
+int main(int argc, char * argv[])
+{
+    FILE * file;
+    uint32 header[DECODER_HEADER_WORDS];
+    uint32 * records;
+    uint32 count, first, index, record, type, id;
+    uint64 time = 0;
+    const char * separator = "";
+    uint8 task_running[DECODER_MAX_TASKS] = {0};
+    char default_name[16];
+    const char * name;
+
+    if(argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <dump.bin> [task0 name] [task1 name] ...\n", argv[0]);
+        return 1;
+    }
+
+    file = fopen(argv[1], "rb");
+    if(file == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    /* magic, clock_hz, size, head, overhead, last_time */
+    for(index = 0; index < DECODER_HEADER_WORDS; index++)
+    {
+        if(!Decoder_ReadWord(file, &header[index]))
+        {
+            fprintf(stderr, "%s: truncated header\n", argv[1]);
+            return 1;
+        }
+    }
+    if(header[0] != OS_TRACE_MAGIC)
+    {
+        fprintf(stderr, "%s: not an Os trace dump (magic 0x%08X)\n", argv[1], header[0]);
+        return 1;
+    }
+    if((header[1] == 0) || (header[2] == 0) || ((header[2] & (header[2] - 1)) != 0))
+    {
+        fprintf(stderr, "%s: corrupted header\n", argv[1]);
+        return 1;
+    }
+
+    records = malloc(header[2] * sizeof(uint32));
+    for(index = 0; index < header[2]; index++)
+    {
+        if(!Decoder_ReadWord(file, &records[index]))
+        {
+            fprintf(stderr, "%s: truncated records\n", argv[1]);
+            return 1;
+        }
+    }
+    fclose(file);
+
+    /* Once the ring buffer wrapped around the oldest record is the one at head */
+    if(header[3] > header[2])
+    {
+        count = header[2];
+        first = header[3] & (header[2] - 1);
+    }
+    else
+    {
+        count = header[3];
+        first = 0;
+    }
+
+    printf("{\"displayTimeUnit\":\"ns\",\"otherData\":{\"clock_hz\":%u,\"overhead_cycles\":%u,\"records\":%u},\n",
+           header[1], header[4], count);
+    printf("\"traceEvents\":[\n");
+
+    for(index = 0; index < count; index++)
+    {
+        record = records[(first + index) & (header[2] - 1)];
+        type   = record >> OS_TRACE_TYPE_SHIFT;
+        id     = (record >> OS_TRACE_ID_SHIFT) & OS_TRACE_ID_MASK;
+
+        if(type == OS_TRACE_EVENT_OVERFLOW)
+        {
+            time += (uint64)(record & OS_TRACE_DELTA_MASK) << OS_TRACE_DELTA_BITS;
+            continue;
+        }
+        time += record & OS_TRACE_DELTA_MASK;
+
+        if(((int)id + 2) < argc)
+        {
+            name = argv[id + 2];
+        }
+        else
+        {
+            snprintf(default_name, sizeof(default_name), "Task %u", id);
+            name = default_name;
+        }
+
+        switch(type)
+        {
+            case OS_TRACE_EVENT_TASK_START:
+                printf("%s{\"name\":\"%s\",\"ph\":\"B\",\"pid\":1,\"tid\":1,\"ts\":%.3f}",
+                       separator, name, (double)time * 1e6 / header[1]);
+                task_running[id] = 1;
+                break;
+            case OS_TRACE_EVENT_TASK_STOP:
+                /* The start of the oldest task may be overwritten in the ring buffer */
+                if(task_running[id] == 0)
+                {
+                    continue;
+                }
+                printf("%s{\"name\":\"%s\",\"ph\":\"E\",\"pid\":1,\"tid\":1,\"ts\":%.3f}",
+                       separator, name, (double)time * 1e6 / header[1]);
+                task_running[id] = 0;
+                break;
+            case OS_TRACE_EVENT_TICK_ISR:
+                printf("%s{\"name\":\"SysTick\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":0,\"ts\":%.3f}",
+                       separator, (double)time * 1e6 / header[1]);
+                break;
+            case OS_TRACE_EVENT_MARKER:
+                printf("%s{\"name\":\"Marker %u\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":1,\"ts\":%.3f}",
+                       separator, id, (double)time * 1e6 / header[1]);
+                break;
+            default:
+                fprintf(stderr, "Unknown record 0x%08X skipped\n", record);
+                continue;
+        }
+        separator = ",\n";
+    }
+
+    printf("\n]}\n");
+    free(records);
+    return 0;
+}
@@ -0,0 +1,280 @@
+ /******************************************************************************
+ *
+ * Module: Host Tools
+ *
+ * File Name: PortDio_BenchReport.c
+ *
+ * Description: Host tool printing the results of the Port and Dio microbenchmark
+ *              as CSV or JSON, one line or object per service and pin or channel,
+ *              to compare them across commits. Without a file it runs
+ *              PortDio_Bench.c on the simulated registers of Host Simulation,
+ *              with a file it converts a RAM dump of PortDio_BenchTable taken on
+ *              the target after a run with PORTDIO_BENCH_AT_STARTUP.
+ *
+ *              Build: W="../IAR Workspace"; S="../Host Simulation"
+ *                     gcc -O2 -DHOST_BUILD [-DREG_ACCESS_STATS=STD_ON]
+ *                         [-DPORT_DEV_ERROR_DETECT=STD_OFF -DDIO_DEV_ERROR_DETECT=STD_OFF]
+ *                         -I"$S" -I"$W" PortDio_BenchReport.c "$S/RegSim.c" "$S/Gpt_Sim.c"
+ *                         "$S/Mcu_Sim.c" "$W/Gpt.c" "$W/PortDio_Bench.c" "$W/Port.c" "$W/Port_PBcfg.c"
+ *                         "$W/Dio.c" "$W/Dio_PBcfg.c" "$W/Det.c" "$W/Reg_Access.c" -o PortDio_BenchReport
+ *              Usage: PortDio_BenchReport [-json] [dump.bin]
+ *              Exit status is 0 when the results are complete, and on the host
+ *              when no register access faulted and no development error was reported.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "PortDio_Bench.h"
+#include "RegSim.h"
+#include "Det.h"
+
+/* Number of the header words before the results in PortDio_BenchTableType */
+#define REPORT_HEADER_WORDS     (5U)
+
+/* Number of the words of one PortDio_BenchResultType */
+#define REPORT_RESULT_WORDS     (7U)
+
+/* Names of the measured services */
+typedef struct
+{
+    uint16 module_id;
+    uint8 api_id;
+    const char * name;
+}Report_ApiType;
+
+static const Report_ApiType Report_Apis[] =
+{
+    {PORT_MODULE_ID, PORT_INIT_SID,                   "Port_Init"},
+    {PORT_MODULE_ID, PORT_SET_PIN_DIRECTION_SID,      "Port_SetPinDirection"},
+    {PORT_MODULE_ID, PORT_REFRESH_PORT_DIRECTION_SID, "Port_RefreshPortDirection"},
+    {PORT_MODULE_ID, PORT_SET_PIN_MODE_SID,           "Port_SetPinMode"},
+    {DIO_MODULE_ID,  DIO_READ_CHANNEL_SID,            "Dio_ReadChannel"},
+    {DIO_MODULE_ID,  DIO_WRITE_CHANNEL_SID,           "Dio_WriteChannel"},
+    {DIO_MODULE_ID,  DIO_FLIP_CHANNEL_SID,            "Dio_FlipChannel"}
+};
+
+/* Read one little endian 32-bit word from the dump */
+static int Report_ReadWord(FILE * File, uint32 * Word)
+{
+    uint8 bytes[4];
+
+    if(fread(bytes, 1, sizeof(bytes), File) != sizeof(bytes))
+    {
+        return 0;
+    }
+    *Word = (uint32)bytes[0] | ((uint32)bytes[1] << 8) | ((uint32)bytes[2] << 16) | ((uint32)bytes[3] << 24);
+    return 1;
+}
+
+/* Load a dump of PortDio_BenchTable taken on the target */
+static int Report_LoadDump(const char * Path, PortDio_BenchTableType * Table)
+{
+    FILE * file = fopen(Path, "rb");
+    uint32 header[REPORT_HEADER_WORDS];
+    uint32 words[REPORT_RESULT_WORDS];
+    uint32 index;
+    uint32 word;
+
+    if(file == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", Path);
+        return 0;
+    }
+    for(index = 0; index < REPORT_HEADER_WORDS; index++)
+    {
+        if(!Report_ReadWord(file, &header[index]))
+        {
+            fprintf(stderr, "%s: truncated header\n", Path);
+            fclose(file);
+            return 0;
+        }
+    }
+    Table->magic           = header[0];
+    Table->options         = header[1];
+    Table->frequency_hz    = header[2];
+    Table->overhead_cycles = header[3];
+    Table->count           = header[4];
+    if((Table->magic != PORTDIO_BENCH_MAGIC) || (Table->count > PORTDIO_BENCH_RESULTS_NUM))
+    {
+        fprintf(stderr, "%s: not a complete PortDio_BenchTable of this configuration\n", Path);
+        fclose(file);
+        return 0;
+    }
+
+    for(index = 0; index < Table->count; index++)
+    {
+        for(word = 0; word < REPORT_RESULT_WORDS; word++)
+        {
+            if(!Report_ReadWord(file, &words[word]))
+            {
+                fprintf(stderr, "%s: truncated after %u results\n", Path, index);
+                fclose(file);
+                return 0;
+            }
+        }
+        Table->result[index].module_id    = (uint16)(words[0] & 0xFFFFU);
+        Table->result[index].api_id       = (uint8)(words[0] >> 16);
+        Table->result[index].index        = (uint8)(words[0] >> 24);
+        Table->result[index].calls        = words[1];
+        Table->result[index].total_cycles = words[2];
+        Table->result[index].min_cycles   = words[3];
+        Table->result[index].max_cycles   = words[4];
+        Table->result[index].reads        = words[5];
+        Table->result[index].writes       = words[6];
+    }
+    fclose(file);
+    return 1;
+}
+
+/* Name of a measured service */
+static const char * Report_ApiName(uint16 ModuleId, uint8 ApiId)
+{
+    uint32 index;
+
+    for(index = 0; index < (sizeof(Report_Apis) / sizeof(Report_Apis[0])); index++)
+    {
+        if((Report_Apis[index].module_id == ModuleId) && (Report_Apis[index].api_id == ApiId))
+        {
+            return Report_Apis[index].name;
+        }
+    }
+    return "unknown";
+}
+
+/* Name of the pin of a result, like "PF1", or "all" for the services of the whole driver */
+static void Report_PinName(const PortDio_BenchResultType * Result, char * Name, size_t Size)
+{
+    uint8 port = 0xFFU;
+    uint8 pin = 0;
+
+    if((Result->module_id == PORT_MODULE_ID) && (Result->index < PORT_CONFIGURED_PINS))
+    {
+        port = Port_Configuration.Pin[Result->index].port_num;
+        pin  = Port_Configuration.Pin[Result->index].pin_num;
+    }
+    else if((Result->module_id == DIO_MODULE_ID) && (Result->index < DIO_CONFIGURED_CHANNLES))
+    {
+        port = Dio_Configuration.Channels[Result->index].Port_Num;
+        pin  = Dio_Configuration.Channels[Result->index].Ch_Num;
+    }
+
+    if(port < REGSIM_PORTS_NUM)
+    {
+        (void)snprintf(Name, Size, "P%c%u", 'A' + port, pin);
+    }
+    else
+    {
+        (void)snprintf(Name, Size, "all");
+    }
+}
+
+/* Print the results as CSV or JSON ... the ns are computed from the counter frequency of the run */
+static void Report_Print(const PortDio_BenchTableType * Table, int Json)
+{
+    const PortDio_BenchResultType * result;
+    const char * detect_port = (Table->options & PORTDIO_BENCH_OPTION_PORT_DET) ? "on" : "off";
+    const char * detect_dio  = (Table->options & PORTDIO_BENCH_OPTION_DIO_DET) ? "on" : "off";
+    double average;
+    double ns;
+    double reads;
+    double writes;
+    char pin[8];
+    uint32 index;
+
+    if(Json)
+    {
+        printf("{\n  \"target\": \"%s\",\n  \"port_det\": \"%s\",\n  \"dio_det\": \"%s\",\n"
+               "  \"register_stats\": %s,\n  \"frequency_hz\": %u,\n  \"overhead_cycles\": %u,\n  \"results\": [\n",
+               (Table->options & PORTDIO_BENCH_OPTION_HOST) ? "host" : "tm4c123gh6pm", detect_port, detect_dio,
+               (Table->options & PORTDIO_BENCH_OPTION_REG_STATS) ? "true" : "false",
+               Table->frequency_hz, Table->overhead_cycles);
+    }
+    else
+    {
+        printf("api,index,pin,port_det,dio_det,calls,min_cycles,avg_cycles,max_cycles,ns_per_op,reads_per_op,writes_per_op\n");
+    }
+
+    for(index = 0; index < Table->count; index++)
+    {
+        result  = &Table->result[index];
+        average = (result->calls != 0) ? ((double)result->total_cycles / result->calls) : 0.0;
+        ns      = average * 1e9 / Table->frequency_hz;
+        reads   = (result->calls != 0) ? ((double)result->reads / result->calls) : 0.0;
+        writes  = (result->calls != 0) ? ((double)result->writes / result->calls) : 0.0;
+        Report_PinName(result, pin, sizeof(pin));
+
+        if(Json)
+        {
+            printf("    {\"api\": \"%s\", \"index\": %u, \"pin\": \"%s\", \"calls\": %u, \"min_cycles\": %u, "
+                   "\"avg_cycles\": %.1f, \"max_cycles\": %u, \"ns_per_op\": %.1f, \"reads_per_op\": %.1f, "
+                   "\"writes_per_op\": %.1f}%s\n",
+                   Report_ApiName(result->module_id, result->api_id), result->index, pin, result->calls,
+                   result->min_cycles, average, result->max_cycles, ns, reads, writes,
+                   (index + 1U < Table->count) ? "," : "");
+        }
+        else
+        {
+            printf("%s,%u,%s,%s,%s,%u,%u,%.1f,%u,%.1f,%.1f,%.1f\n",
+                   Report_ApiName(result->module_id, result->api_id), result->index, pin, detect_port, detect_dio,
+                   result->calls, result->min_cycles, average, result->max_cycles, ns, reads, writes);
+        }
+    }
+
+    if(Json)
+    {
+        printf("  ]\n}\n");
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    static PortDio_BenchTableType dump;
+    const PortDio_BenchTableType * table = &PortDio_BenchTable;
+    const char * path = NULL;
+    int json = 0;
+    int arg;
+    int status = 0;
+
+    for(arg = 1; arg < argc; arg++)
+    {
+        if(strcmp(argv[arg], "-json") == 0)
+        {
+            json = 1;
+        }
+        else
+        {
+            path = argv[arg];
+        }
+    }
+
+    if(path != NULL)
+    {
+        if(!Report_LoadDump(path, &dump))
+        {
+            return 1;
+        }
+        table = &dump;
+    }
+    else
+    {
+        RegSim_Reset();
+        Det_Init();
+        PortDio_Bench_Run();
+
+        if(RegSim_GetFaultCount() != 0)
+        {
+            fprintf(stderr, "%u register faults, the last at %08X\n", RegSim_GetFaultCount(), RegSim_GetLastFaultAddress());
+            status = 1;
+        }
+        if(Det_GetErrorCount() != 0)
+        {
+            fprintf(stderr, "%u development errors reported\n", Det_GetErrorCount());
+            status = 1;
+        }
+    }
+
+    Report_Print(table, json);
+    return status;
+}
@@ -0,0 +1,672 @@
+ /******************************************************************************
+ *
+ * Module: Host Tools
+ *
+ * File Name: RegAccess_CaptureReplay.c
+ *
+ * Description: Host tool replaying a capture of the register writes of
+ *              Port_Init (REG_ACCESS_CAPTURE, a RAM dump of RegAccess_Capture)
+ *              into the simulated registers of Host Simulation/RegSim.c. It
+ *              prints the final registers of every GPIO port and the writes
+ *              which left their register unchanged, and diffs the final state
+ *              with a second capture or with an expected image.
+ *
+ *              The captures hold no reads, so after every System Control write
+ *              the replay reads the PR registers like the wait loops of the
+ *              drivers do. An image is a text file of "address value" lines in
+ *              hex, -image writes the one of a capture.
+ *
+ *              Build: W="../IAR Workspace"; S="../Host Simulation"
+ *                     gcc -O2 -DHOST_BUILD -DREG_ACCESS_CAPTURE=STD_ON -I"$S" -I"$W"
+ *                         RegAccess_CaptureReplay.c "$S/RegSim.c" "$S/Gpt_Sim.c" "$S/Mcu_Sim.c"
+ *                         "$W/Gpt.c" "$W/Port.c" "$W/Port_PBcfg.c" "$W/Det.c" "$W/Reg_Access.c"
+ *                         -o RegAccess_CaptureReplay
+ *              Usage: RegAccess_CaptureReplay -host <out.bin>
+ *                         capture Port_Init of this tree on the simulated registers
+ *                     RegAccess_CaptureReplay [-list] [-image <out.txt>] <capture.bin> [<other.bin> | <expected.txt>]
+ *                         replay a capture, -list prints every write in order
+ *              Exit status is 0 when the captures are valid, replay without register
+ *              faults and the final states match.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "RegSim.h"
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Gpt_Regs.h"
+
+#if (REG_ACCESS_CAPTURE == STD_OFF)
+  #error "The tool needs REG_ACCESS_CAPTURE"
+#endif
+
+/* Number of the header words before the records in RegAccess_CaptureType */
+#define REPLAY_HEADER_WORDS     (4U)
+
+/* Largest capture read, every write takes at least one word */
+#define REPLAY_MAX_WORDS        (65536U)
+
+/* Registers of an image: the written ones and those of the port table */
+#define REPLAY_MAX_REGISTERS    (1024U)
+
+/* Base address of the System Control, its writes may enable a peripheral clock */
+#define REPLAY_SYSCTL_BASE      (0x400FE000U)
+
+/* Reads of every PR register after a System Control write ... RegSim needs 2 to set a ready bit */
+#define REPLAY_READY_READS      (4U)
+
+/* Registers listed with their writes without effect */
+#define REPLAY_TOP_REGISTERS    (10U)
+
+/* Description: One captured write */
+typedef struct
+{
+    uint32 address;
+    uint32 value;
+    uint8 type;             /* REG_ACCESS_WRITE or REG_ACCESS_WRITE8 */
+    boolean no_effect;      /* Set by the replay when the stored register did not change */
+}Replay_WriteType;
+
+/* Description: Decoded capture */
+typedef struct
+{
+    const char * path;
+    uint32 dropped;
+    uint32 count;
+    Replay_WriteType write[REPLAY_MAX_WORDS];
+}Replay_CaptureType;
+
+/* Description: Writes of one register in a replay */
+typedef struct
+{
+    uint32 address;
+    uint32 writes;
+    uint32 no_effect;
+}Replay_RegisterType;
+
+/* Registers printed for every port */
+static const uint32 Replay_PortRegisters[] =
+{
+    PORT_DIR_REG_OFFSET, PORT_ALT_FUNC_REG_OFFSET, PORT_PULL_UP_REG_OFFSET, PORT_PULL_DOWN_REG_OFFSET,
+    PORT_DIGITAL_ENABLE_REG_OFFSET, PORT_COMMIT_REG_OFFSET, PORT_ANALOG_MODE_SEL_REG_OFFSET,
+    PORT_CTL_REG_OFFSET, PORT_DATA_REG_OFFSET
+};
+
+static const char * const Replay_PortRegisterNames[] =
+{
+    "DIR", "AFSEL", "PUR", "PDR", "DEN", "CR", "AMSEL", "PCTL", "DATA"
+};
+
+#define REPLAY_PORT_REGISTERS_NUM   (sizeof(Replay_PortRegisters) / sizeof(Replay_PortRegisters[0]))
+
+static const uint32 Replay_PortBase[REGSIM_PORTS_NUM] =
+{
+    GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+    GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS
+};
+
+/* Captures of the command line */
+static Replay_CaptureType g_Replay_First;
+static Replay_CaptureType g_Replay_Second;
+
+/* Writes per register of the last replay */
+static Replay_RegisterType g_Replay_Registers[REPLAY_MAX_REGISTERS];
+static uint32 g_Replay_Registers_Num;
+
+/* Registers compared by a diff and written to an image */
+static uint32 g_Replay_Image_Address[REPLAY_MAX_REGISTERS];
+static uint32 g_Replay_Image_Num;
+
+/*********************************************************************************************/
+/* Read one little endian 32-bit word */
+static int Replay_ReadWord(FILE * File, uint32 * Word)
+{
+    uint8 bytes[4];
+
+    if(fread(bytes, 1, sizeof(bytes), File) != sizeof(bytes))
+    {
+        return 0;
+    }
+    *Word = (uint32)bytes[0] | ((uint32)bytes[1] << 8) | ((uint32)bytes[2] << 16) | ((uint32)bytes[3] << 24);
+    return 1;
+}
+
+/* Write one little endian 32-bit word */
+static void Replay_WriteWord(FILE * File, uint32 Word)
+{
+    uint8 bytes[4] = {(uint8)Word, (uint8)(Word >> 8), (uint8)(Word >> 16), (uint8)(Word >> 24)};
+
+    (void)fwrite(bytes, 1, sizeof(bytes), File);
+}
+
+/*********************************************************************************************/
+/* Return 1 if the file starts with the magic of a capture */
+static int Replay_IsCapture(const char * Path)
+{
+    FILE * file = fopen(Path, "rb");
+    uint32 magic = 0;
+    int found;
+
+    if(file == NULL)
+    {
+        return 0;
+    }
+    found = Replay_ReadWord(file, &magic) && (magic == REG_ACCESS_CAPTURE_MAGIC);
+    fclose(file);
+    return found;
+}
+
+/*********************************************************************************************/
+/* Decode a capture file ... the records of the used words, the rest of a RAM dump is ignored */
+static int Replay_Load(const char * Path, Replay_CaptureType * Capture)
+{
+    FILE * file = fopen(Path, "rb");
+    uint32 header[REPLAY_HEADER_WORDS];
+    uint32 index;
+    uint32 record;
+    uint32 offset;
+    Replay_WriteType * write;
+
+    Capture->path  = Path;
+    Capture->count = 0;
+    if(file == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", Path);
+        return 0;
+    }
+    for(index = 0; index < REPLAY_HEADER_WORDS; index++)
+    {
+        if(!Replay_ReadWord(file, &header[index]))
+        {
+            fprintf(stderr, "%s: truncated header\n", Path);
+            fclose(file);
+            return 0;
+        }
+    }
+    if((header[0] != REG_ACCESS_CAPTURE_MAGIC) || (header[1] > REPLAY_MAX_WORDS))
+    {
+        fprintf(stderr, "%s: not a complete capture, stop it by REG_ACCESS_CAPTURE_STOP before the dump\n", Path);
+        fclose(file);
+        return 0;
+    }
+    Capture->dropped = header[3];
+
+    for(index = 0; index < header[1]; index++)
+    {
+        if(!Replay_ReadWord(file, &record))
+        {
+            fprintf(stderr, "%s: truncated after %u words\n", Path, index);
+            fclose(file);
+            return 0;
+        }
+        offset = record & REG_ACCESS_CAPTURE_OFFSET_MASK;
+        write  = &Capture->write[Capture->count++];
+        write->address   = ((record & REG_ACCESS_CAPTURE_SCS) ? REG_ACCESS_CAPTURE_SCS_BASE : REG_ACCESS_CAPTURE_PERIPH_BASE) + offset;
+        write->no_effect = FALSE;
+        if(record & REG_ACCESS_CAPTURE_BYTE)
+        {
+            write->type  = REG_ACCESS_WRITE8;
+            write->value = (record >> REG_ACCESS_CAPTURE_VALUE_SHIFT) & REG_ACCESS_CAPTURE_VALUE_MASK;
+        }
+        else
+        {
+            write->type = REG_ACCESS_WRITE;
+            if((++index >= header[1]) || !Replay_ReadWord(file, &write->value))
+            {
+                fprintf(stderr, "%s: truncated in record %u\n", Path, Capture->count - 1U);
+                fclose(file);
+                return 0;
+            }
+        }
+    }
+    fclose(file);
+
+    if(header[2] != Capture->count)
+    {
+        fprintf(stderr, "%s: %u writes decoded, the header counts %u\n", Path, Capture->count, header[2]);
+        return 0;
+    }
+    return 1;
+}
+
+/*********************************************************************************************/
+/* Capture Port_Init of this tree on the simulated registers */
+static int Replay_CaptureHost(const char * Path)
+{
+    FILE * file;
+    uint32 index;
+
+    RegSim_Reset();
+    REG_ACCESS_CAPTURE_START();
+    Port_Init(&Port_Configuration);
+    REG_ACCESS_CAPTURE_STOP();
+
+    file = fopen(Path, "wb");
+    if(file == NULL)
+    {
+        fprintf(stderr, "cannot create %s\n", Path);
+        return 1;
+    }
+    Replay_WriteWord(file, RegAccess_Capture.magic);
+    Replay_WriteWord(file, RegAccess_Capture.used);
+    Replay_WriteWord(file, RegAccess_Capture.writes);
+    Replay_WriteWord(file, RegAccess_Capture.dropped);
+    for(index = 0; index < RegAccess_Capture.used; index++)
+    {
+        Replay_WriteWord(file, RegAccess_Capture.word[index]);
+    }
+    fclose(file);
+
+    printf("%s: %u writes in %u words, %u dropped\n", Path, RegAccess_Capture.writes, RegAccess_Capture.used, RegAccess_Capture.dropped);
+    return (RegAccess_Capture.dropped != 0) ? 1 : 0;
+}
+
+/*********************************************************************************************/
+/* Address of the stored register written by a write ... GPIODATA is stored once for all its masked addresses */
+static uint32 Replay_StoredAddress(uint32 Address)
+{
+    uint8 port;
+
+    for(port = 0; port < REGSIM_PORTS_NUM; port++)
+    {
+        if((Address - Replay_PortBase[port]) <= PORT_DATA_REG_OFFSET)
+        {
+            return Replay_PortBase[port] + PORT_DATA_REG_OFFSET;
+        }
+    }
+    return Address & ~3U;
+}
+
+/* Port of a register, REGSIM_PORTS_NUM outside the GPIO ports */
+static uint8 Replay_Port(uint32 Address)
+{
+    uint8 port;
+
+    for(port = 0; port < REGSIM_PORTS_NUM; port++)
+    {
+        if((Address - Replay_PortBase[port]) < 0x1000U)
+        {
+            return port;
+        }
+    }
+    return REGSIM_PORTS_NUM;
+}
+
+/* Add a register to the registers of the images once */
+static void Replay_AddImageRegister(uint32 Address)
+{
+    uint32 index;
+
+    for(index = 0; index < g_Replay_Image_Num; index++)
+    {
+        if(g_Replay_Image_Address[index] == Address)
+        {
+            return;
+        }
+    }
+    if(g_Replay_Image_Num < REPLAY_MAX_REGISTERS)
+    {
+        g_Replay_Image_Address[g_Replay_Image_Num++] = Address;
+    }
+}
+
+/* Count a write of a register of the replay */
+static void Replay_CountRegister(uint32 Address, boolean NoEffect)
+{
+    uint32 index;
+
+    for(index = 0; index < g_Replay_Registers_Num; index++)
+    {
+        if(g_Replay_Registers[index].address == Address)
+        {
+            break;
+        }
+    }
+    if(index == g_Replay_Registers_Num)
+    {
+        if(index == REPLAY_MAX_REGISTERS)
+        {
+            return;
+        }
+        g_Replay_Registers[index].address   = Address;
+        g_Replay_Registers[index].writes    = 0;
+        g_Replay_Registers[index].no_effect = 0;
+        g_Replay_Registers_Num++;
+    }
+    g_Replay_Registers[index].writes++;
+    if(NoEffect)
+    {
+        g_Replay_Registers[index].no_effect++;
+    }
+}
+
+/*********************************************************************************************/
+/* Replay the writes of a capture from the reset state, a write without effect leaves its stored register unchanged */
+static void Replay_Run(Replay_CaptureType * Capture)
+{
+    Replay_WriteType * write;
+    uint32 stored;
+    uint32 before;
+    uint32 index;
+    uint32 read;
+
+    RegSim_Reset();
+    g_Replay_Registers_Num = 0;
+
+    for(index = 0; index < Capture->count; index++)
+    {
+        write  = &Capture->write[index];
+        stored = Replay_StoredAddress(write->address);
+        before = RegSim_Peek(stored);
+        if(write->type == REG_ACCESS_WRITE8)
+        {
+            RegSim_Write8(write->address, (uint8)write->value);
+        }
+        else
+        {
+            RegSim_Write32(write->address, write->value);
+        }
+        write->no_effect = (boolean)(RegSim_Peek(stored) == before);
+        Replay_CountRegister(stored, write->no_effect);
+
+        /* Wait for the peripherals a gating write may have enabled */
+        if((write->address & ~0xFFFU) == REPLAY_SYSCTL_BASE)
+        {
+            for(read = 0; read < REPLAY_READY_READS; read++)
+            {
+                (void)RegSim_Read32(SYSCTL_PRGPIO_ADDRESS);
+                (void)RegSim_Read32(SYSCTL_PRTIMER_ADDRESS);
+                (void)RegSim_Read32(SYSCTL_PRWTIMER_ADDRESS);
+            }
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Order the registers by their writes without effect, the most first */
+static int Replay_CompareRegisters(const void * First, const void * Second)
+{
+    const Replay_RegisterType * first  = (const Replay_RegisterType *)First;
+    const Replay_RegisterType * second = (const Replay_RegisterType *)Second;
+
+    if(first->no_effect != second->no_effect)
+    {
+        return (first->no_effect < second->no_effect) ? 1 : -1;
+    }
+    return (first->address < second->address) ? -1 : 1;
+}
+
+/* Print the write sequence of the last replay */
+static void Replay_PrintList(const Replay_CaptureType * Capture)
+{
+    char name[32];
+    uint32 index;
+
+    for(index = 0; index < Capture->count; index++)
+    {
+        RegSim_GetRegisterName(Capture->write[index].address, name, sizeof(name));
+        printf("%6u %-22s %s%08X%s\n", index, name, (Capture->write[index].type == REG_ACCESS_WRITE8) ? "byte " : "",
+               Capture->write[index].value, Capture->write[index].no_effect ? "  no effect" : "");
+    }
+}
+
+/* Print the final registers of every port and the writes without effect of the last replay */
+static uint32 Replay_PrintReport(const Replay_CaptureType * Capture)
+{
+    uint32 writes[REGSIM_PORTS_NUM + 1U] = {0};
+    uint32 no_effect[REGSIM_PORTS_NUM + 1U] = {0};
+    uint32 total = 0;
+    uint32 index;
+    uint8 port;
+    char name[32];
+
+    for(index = 0; index < Capture->count; index++)
+    {
+        port = Replay_Port(Capture->write[index].address);
+        writes[port]++;
+        if(Capture->write[index].no_effect)
+        {
+            no_effect[port]++;
+            total++;
+        }
+    }
+
+    printf("%s: %u writes, %u without effect, %u dropped by the capture, %u register faults\n",
+           Capture->path, Capture->count, total, Capture->dropped, RegSim_GetFaultCount());
+
+    printf("%-6s %6s %9s", "port", "writes", "no effect");
+    for(index = 0; index < REPLAY_PORT_REGISTERS_NUM; index++)
+    {
+        printf(" %8s", Replay_PortRegisterNames[index]);
+    }
+    printf("\n");
+    for(port = 0; port < REGSIM_PORTS_NUM; port++)
+    {
+        printf("GPIO%c  %6u %9u", 'A' + port, writes[port], no_effect[port]);
+        for(index = 0; index < REPLAY_PORT_REGISTERS_NUM; index++)
+        {
+            printf(" %08X", RegSim_Peek(Replay_PortBase[port] + Replay_PortRegisters[index]));
+        }
+        printf("\n");
+    }
+    printf("%-6s %6u %9u RCGC2 %08X\n", "other", writes[REGSIM_PORTS_NUM], no_effect[REGSIM_PORTS_NUM],
+           RegSim_Peek(SYSCTL_RCGC2_ADDRESS));
+
+    if(total != 0)
+    {
+        qsort(g_Replay_Registers, g_Replay_Registers_Num, sizeof(g_Replay_Registers[0]), Replay_CompareRegisters);
+        printf("registers written without effect:\n");
+        for(index = 0; (index < g_Replay_Registers_Num) && (index < REPLAY_TOP_REGISTERS)
+                       && (g_Replay_Registers[index].no_effect != 0); index++)
+        {
+            RegSim_GetRegisterName(g_Replay_Registers[index].address, name, sizeof(name));
+            printf("  %-22s %4u of %4u writes\n", name, g_Replay_Registers[index].no_effect, g_Replay_Registers[index].writes);
+        }
+    }
+    return RegSim_GetFaultCount();
+}
+
+/*********************************************************************************************/
+/* Registers of the images of the captures: the port table and every written register */
+static void Replay_CollectRegisters(const Replay_CaptureType * Capture)
+{
+    uint32 index;
+    uint8 port;
+
+    for(port = 0; port < REGSIM_PORTS_NUM; port++)
+    {
+        for(index = 0; index < REPLAY_PORT_REGISTERS_NUM; index++)
+        {
+            Replay_AddImageRegister(Replay_PortBase[port] + Replay_PortRegisters[index]);
+        }
+    }
+    Replay_AddImageRegister(SYSCTL_RCGC2_ADDRESS);
+    for(index = 0; index < Capture->count; index++)
+    {
+        Replay_AddImageRegister(Replay_StoredAddress(Capture->write[index].address));
+    }
+}
+
+/* Write the final registers of the last replay as an image */
+static int Replay_WriteImage(const char * Path)
+{
+    FILE * file = fopen(Path, "w");
+    char name[32];
+    uint32 index;
+
+    if(file == NULL)
+    {
+        fprintf(stderr, "cannot create %s\n", Path);
+        return 0;
+    }
+    for(index = 0; index < g_Replay_Image_Num; index++)
+    {
+        RegSim_GetRegisterName(g_Replay_Image_Address[index], name, sizeof(name));
+        fprintf(file, "%08X %08X  # %s\n", g_Replay_Image_Address[index], RegSim_Peek(g_Replay_Image_Address[index]), name);
+    }
+    fclose(file);
+    return 1;
+}
+
+/* Compare the final registers of the last replay with an image, return the number of the differences */
+static uint32 Replay_DiffImage(const char * Path)
+{
+    FILE * file = fopen(Path, "r");
+    char line[128];
+    char name[32];
+    unsigned int address;
+    unsigned int value;
+    uint32 actual;
+    uint32 compared = 0;
+    uint32 differences = 0;
+
+    if(file == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", Path);
+        return 1;
+    }
+    while(fgets(line, sizeof(line), file) != NULL)
+    {
+        if(sscanf(line, "%x %x", &address, &value) != 2)
+        {
+            continue; /* Blank or comment line */
+        }
+        compared++;
+        actual = RegSim_Peek(address);
+        if(actual != value)
+        {
+            RegSim_GetRegisterName(address, name, sizeof(name));
+            printf("  %-22s capture %08X expected %08X\n", name, actual, value);
+            differences++;
+        }
+    }
+    fclose(file);
+    printf("%s: %u registers compared, %u differ\n", Path, compared, differences);
+    return differences;
+}
+
+/* Compare the writes and the final registers of two captures, return the number of the differences */
+static uint32 Replay_DiffCaptures(Replay_CaptureType * First, Replay_CaptureType * Second)
+{
+    static uint32 first_values[REPLAY_MAX_REGISTERS];
+    const Replay_WriteType * first;
+    const Replay_WriteType * second;
+    uint32 differences = 0;
+    uint32 index;
+    uint32 value;
+    char name[32];
+
+    /* First write of a different register or value ... the order of the writes is part of the configuration */
+    for(index = 0; (index < First->count) && (index < Second->count); index++)
+    {
+        first  = &First->write[index];
+        second = &Second->write[index];
+        if((first->address != second->address) || (first->value != second->value) || (first->type != second->type))
+        {
+            break;
+        }
+    }
+    if((index == First->count) && (index == Second->count))
+    {
+        printf("write sequences: identical, %u writes\n", index);
+    }
+    else
+    {
+        printf("write sequences: %u and %u writes, the first %u are the same\n", First->count, Second->count, index);
+    }
+
+    Replay_Run(First);
+    for(index = 0; index < g_Replay_Image_Num; index++)
+    {
+        first_values[index] = RegSim_Peek(g_Replay_Image_Address[index]);
+    }
+    Replay_Run(Second);
+    for(index = 0; index < g_Replay_Image_Num; index++)
+    {
+        value = RegSim_Peek(g_Replay_Image_Address[index]);
+        if(value != first_values[index])
+        {
+            RegSim_GetRegisterName(g_Replay_Image_Address[index], name, sizeof(name));
+            printf("  %-22s %08X %08X\n", name, first_values[index], value);
+            differences++;
+        }
+    }
+    printf("final registers: %u compared, %u differ\n", g_Replay_Image_Num, differences);
+    return differences;
+}
+
+/*********************************************************************************************/
+int main(int argc, char * argv[])
+{
+    const char * files[2] = {NULL, NULL};
+    const char * image = NULL;
+    uint32 files_num = 0;
+    uint32 status = 0;
+    int list = 0;
+    int arg;
+
+    for(arg = 1; arg < argc; arg++)
+    {
+        if((strcmp(argv[arg], "-host") == 0) && (arg + 1 < argc))
+        {
+            return Replay_CaptureHost(argv[arg + 1]);
+        }
+        else if((strcmp(argv[arg], "-image") == 0) && (arg + 1 < argc))
+        {
+            image = argv[++arg];
+        }
+        else if(strcmp(argv[arg], "-list") == 0)
+        {
+            list = 1;
+        }
+        else if(files_num < 2U)
+        {
+            files[files_num++] = argv[arg];
+        }
+    }
+    if(files_num == 0)
+    {
+        fprintf(stderr, "usage: %s -host <out.bin>\n"
+                        "       %s [-list] [-image <out.txt>] <capture.bin> [<other.bin> | <expected.txt>]\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    if(!Replay_Load(files[0], &g_Replay_First))
+    {
+        return 1;
+    }
+    Replay_CollectRegisters(&g_Replay_First);
+    Replay_Run(&g_Replay_First);
+    if(list)
+    {
+        Replay_PrintList(&g_Replay_First);
+    }
+    status += Replay_PrintReport(&g_Replay_First);
+    if((image != NULL) && !Replay_WriteImage(image))
+    {
+        status++;
+    }
+
+    if(files_num == 2U)
+    {
+        if(Replay_IsCapture(files[1]))
+        {
+            if(!Replay_Load(files[1], &g_Replay_Second))
+            {
+                return 1;
+            }
+            Replay_Run(&g_Replay_Second);
+            status += Replay_PrintReport(&g_Replay_Second);
+            Replay_CollectRegisters(&g_Replay_Second);
+            status += Replay_DiffCaptures(&g_Replay_First, &g_Replay_Second);
+        }
+        else
+        {
+            status += Replay_DiffImage(files[1]);
+        }
+    }
+    return (status != 0) ? 1 : 0;
+}
@@ -14,21 +14,108 @@
 #include "Button.h"
 #include "Led.h"
 #include "Dio.h"
+#include "Os.h"
+#include "Os_Mailbox.h"
+#include "Os_Pt.h"
+#include "Gpt_Timestamp.h"
+#include "Icu.h"
+#include "Mcu.h"
+#include "Reg_Access.h"
+
+/* Capacity of the button mailbox ... state changes queued between two runs of App_Task */
+#define APP_BUTTON_MAILBOX_SIZE     (8U)
+
+/* Debounced button states sent by Button_Task to App_Task */
+static uint8 g_Button_Mailbox_Buffer[APP_BUTTON_MAILBOX_SIZE];
+static Os_MailboxType g_Button_Mailbox;
+
+/* Capacity of the release mailbox ... releases queued while Press_Task waits for the long press time */
+#define APP_RELEASE_MAILBOX_SIZE    (2U)
+
+/* Debounced releases sent by Button_Task to Press_Task */
+static uint8 g_Release_Mailbox_Buffer[APP_RELEASE_MAILBOX_SIZE];
+static Os_MailboxType g_Release_Mailbox;
+
+/* Presses timed by Press_Task */
+static App_PressStatsType g_App_Press_Stats;
+
+/* Periods of the heartbeat channel since the Init Task started it */
+static volatile uint32 g_App_Heartbeats = 0;
 
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
 {
-    /* Initialize Port Driver */
+    /* Initialize Port Driver ... its register writes are captured with REG_ACCESS_CAPTURE */
+    REG_ACCESS_CAPTURE_START();
     Port_Init(&Port_Configuration);
+    REG_ACCESS_CAPTURE_STOP();
     
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+    /* Start the 64-bit timestamp ... the core clock is already set by main */
+    Gpt_TimestampInit();
+#endif
+
+    /* Initialize Gpt Driver and start the heartbeat, one period per second of the System clock */
+    Gpt_Init(&Gpt_Configuration);
+    Gpt_EnableNotification(GptConf_HEARTBEAT_CHANNEL_ID);
+    Gpt_StartTimer(GptConf_HEARTBEAT_CHANNEL_ID, Mcu_GetSysClockFrequency());
+
+    /* Initialize Icu Driver and measure the pulses on PC6 ... its timer is lent by the Gpt Driver */
+    Icu_Init(&Icu_Configuration);
+    Icu_StartSignalMeasurement(IcuConf_PULSE_IN_CHANNEL_ID);
+
+    /* Initialize the mailbox from Button_Task to App_Task */
+    (void)Os_MailboxInit(&g_Button_Mailbox, g_Button_Mailbox_Buffer, sizeof(uint8), APP_BUTTON_MAILBOX_SIZE);
+
+    /* Initialize the mailbox from Button_Task to Press_Task */
+    (void)Os_MailboxInit(&g_Release_Mailbox, g_Release_Mailbox_Buffer, sizeof(uint8), APP_RELEASE_MAILBOX_SIZE);
+}
+
+/* Description: Notification of the heartbeat channel, called by its timer ISR every second */
+void App_HeartbeatNotification(void)
+{
+    g_App_Heartbeats++;
+}
+
+/* Description: Return the seconds counted by the heartbeat channel */
+uint32 App_GetHeartbeats(void)
+{
+    return g_App_Heartbeats;
 }
 
 /* Description: Task executes every 20 Mili-seconds to check the button state */
 void Button_Task(void)
 {
+    uint8 button_previous_state = BUTTON_getState();
+    uint8 button_current_state;
+
     BUTTON_refreshState();
+    button_current_state = BUTTON_getState();
+
+    /* Queue every debounced state change ... App_Task sees all of them even if it runs later */
+    if(button_current_state != button_previous_state)
+    {
+        (void)Os_MailboxSend(&g_Button_Mailbox, &button_current_state, 1);
+#if (OS_EVENT_API == STD_ON)
+        /* Wake up App_Task as soon as the debounced state changes instead of waiting for its period */
+        (void)Os_SetEvent(OsConf_APP_TASK_ID, OsConf_APP_BUTTON_EVENT);
+#endif
+
+        /* Start the timing of a press in Press_Task and end it by the release */
+        if(button_current_state == BUTTON_PRESSED)
+        {
+#if (OS_EVENT_API == STD_ON)
+            (void)Os_SetEvent(OsConf_PRESS_TASK_ID, OsConf_PRESS_BUTTON_EVENT);
+#endif
+        }
+        else
+        {
+            (void)Os_MailboxSend(&g_Release_Mailbox, &button_current_state, 1);
+        }
+    }
 }
 
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
@@ -37,20 +124,76 @@ void Led_Task(void)
     LED_refreshOutput();
 }
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task executes every 60 Mili-seconds, or once the button state changes,
+ *              to get the button status and toggle the led */
 void App_Task(void)
 {
     static uint8 button_previous_state = BUTTON_RELEASED;
-    static uint8 button_current_state  = BUTTON_RELEASED;
-	
-    button_current_state = BUTTON_getState(); /* Read the button state */
-	
-    /* Only Toggle the led in case the current state of the switch is pressed
-     * and the previous state is released */ 
-    if((button_current_state == BUTTON_PRESSED) && (button_previous_state == BUTTON_RELEASED))
+    uint8 button_states[APP_BUTTON_MAILBOX_SIZE];
+    uint16 states_num;
+    uint16 index;
+
+#if (OS_EVENT_API == STD_ON)
+    /* The mailbox is read below whatever activated the task */
+    (void)Os_ClearEvent(OsConf_APP_TASK_ID, OsConf_APP_BUTTON_EVENT);
+#endif
+
+    /* Read all the button state changes queued since the last run */
+    states_num = Os_MailboxReceive(&g_Button_Mailbox, button_states, APP_BUTTON_MAILBOX_SIZE);
+
+    for(index = 0; index < states_num; index++)
     {
-	LED_toggle();
+        /* Only Toggle the led in case the current state of the switch is pressed
+         * and the previous state is released */
+        if((button_states[index] == BUTTON_PRESSED) && (button_previous_state == BUTTON_RELEASED))
+        {
+            LED_toggle();
+        }
+        button_previous_state = button_states[index];
     }
-	
-    button_previous_state = button_current_state;
+}
+
+#if (OS_EVENT_API == STD_ON)
+/* Description: Protothread of Press_Task ... waits for a press, then for the long press time and the release */
+static OS_PT_THREAD(App_PressThread(Os_PtType * Pt))
+{
+    uint8 release;
+
+    OS_PT_BEGIN(Pt);
+    while(1)
+    {
+        OS_PT_WAIT_EVENT(Pt, OsConf_PRESS_TASK_ID, OsConf_PRESS_BUTTON_EVENT);
+        (void)Os_ClearEvent(OsConf_PRESS_TASK_ID, OsConf_PRESS_BUTTON_EVENT);
+        g_App_Press_Stats.press_tick = Os_GetTickCount();
+
+        /* The press is a long one if the button is still held after APP_LONG_PRESS_TIME */
+        OS_PT_DELAY(Pt, APP_LONG_PRESS_TIME);
+        g_App_Press_Stats.delay_tick = Os_GetTickCount();
+        if(Os_MailboxCount(&g_Release_Mailbox) == 0)
+        {
+            g_App_Press_Stats.long_presses++;
+        }
+
+        OS_PT_WAIT_MAILBOX(Pt, &g_Release_Mailbox);
+        (void)Os_MailboxReceive(&g_Release_Mailbox, &release, 1);
+        g_App_Press_Stats.release_tick = Os_GetTickCount();
+        g_App_Press_Stats.presses++;
+    }
+    OS_PT_END(Pt);
+}
+
+/* Description: Task executes every 60 Mili-seconds, or once the button is pressed,
+ *              to continue the protothread timing the presses */
+OS_PT_TASK(Press_Task, App_PressThread)
+#else
+/* Description: Without the events the presses are not timed */
+void Press_Task(void)
+{
+}
+#endif
+
+/* Description: Return the presses timed by Press_Task */
+void App_GetPressStats(App_PressStatsType * Stats)
+{
+    *Stats = g_App_Press_Stats;
 }
@@ -13,17 +13,45 @@
 #define APP_H_
 
 #include "Std_Types.h"
+#include "Os.h"
+
+/* Time in ms a press shall last to be counted a long press by Press_Task */
+#define APP_LONG_PRESS_TIME         (300U)
+
+/* Description: Button presses timed by the protothread of Press_Task */
+typedef struct
+{
+    uint32 presses;          /* Presses completed by their release */
+    uint32 long_presses;     /* Presses still held APP_LONG_PRESS_TIME after they started */
+    Os_TickType press_tick;  /* Tick the thread woke up by the press event */
+    Os_TickType delay_tick;  /* Tick the thread woke up after APP_LONG_PRESS_TIME */
+    Os_TickType release_tick;/* Tick the thread received the release */
+}App_PressStatsType;
 
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void);
 
+/* Description: Notification of the heartbeat channel, called by its timer ISR every second */
+void App_HeartbeatNotification(void);
+
+/* Description: Return the seconds counted by the heartbeat channel */
+uint32 App_GetHeartbeats(void);
+
 /* Description: Task executes every 20 Mili-seconds to check the button state */
 void Button_Task(void);
 
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void);
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task executes every 60 Mili-seconds, or once the button state changes,
+ *              to get the button status and toggle the led */
 void App_Task(void);
 
+/* Description: Task executes every 60 Mili-seconds, or once the button is pressed,
+ *              to continue the protothread timing the presses */
+void Press_Task(void);
+
+/* Description: Return the presses timed by Press_Task */
+void App_GetPressStats(App_PressStatsType * Stats);
+
 #endif /* APP_H_ */
@@ -51,4 +51,20 @@
 /* This is used to define the abstraction of compiler keyword static */
 #define STATIC            static
 
+/* This is used to define the variables left uninitialized by the startup code, kept across warm resets */
+#if defined(__ICCARM__)
+#define NO_INIT           __no_init
+#elif defined(__GNUC__) && !defined(HOST_BUILD)
+#define NO_INIT           __attribute__((section(".noinit")))
+#else
+#define NO_INIT
+#endif
+
+/* This is used to mark a statement falling through into the next case label, e.g. in the Os_Pt.h protothreads */
+#if defined(__GNUC__) && (__GNUC__ >= 7)
+#define FALLTHROUGH       __attribute__((__fallthrough__))
+#else
+#define FALLTHROUGH       ((void)0)
+#endif
+
 #endif
@@ -0,0 +1,241 @@
+ /******************************************************************************
+ *
+ * Module: Common - CPU Abstraction
+ *
+ * File Name: Cpu.h
+ *
+ * Description: Access to the ARM Cortex-M4F core features used by the upper layers.
+ *              Host builds (HOST_BUILD defined) map them to host equivalents.
+ *
+ * Author: Omar Anwar
+ *
+ *******************************************************************************/
+
+#ifndef CPU_H
+#define CPU_H
+
+#include "Std_Types.h"
+
+#ifdef HOST_BUILD
+
+#include <time.h>
+
+/* Frequency of the counter returned by Cpu_GetCycleCount ... the host counter counts ns */
+#define CPU_CYCLE_COUNTER_FREQUENCY_HZ      (1000000000U)
+
+/*
+ * Pre-compile option for the counter returned by Cpu_GetCycleCount on the host:
+ * STD_OFF --> host monotonic clock, the wall time
+ * STD_ON  --> virtual time of the host simulation, returned by Cpu_SimGetCycleCount of Gpt_Sim.c
+ */
+#ifndef CPU_SIM_CYCLE_COUNTER
+#define CPU_SIM_CYCLE_COUNTER               (STD_OFF)
+#endif
+
+#if (CPU_SIM_CYCLE_COUNTER == STD_ON)
+/* Description: Return the virtual time of the host simulation in ns ... it wraps around every 2^32 ns */
+uint32 Cpu_SimGetCycleCount(void);
+#endif
+
+/*
+ * Pre-compile option for the interrupt masking on the host:
+ * STD_OFF --> nothing to mask, the host simulation calls the ISRs synchronously
+ * STD_ON  --> Cpu_SimEnterCritical and Cpu_SimExitCritical of Gpt_Sim.c track the masking, an ISR raised
+ *             while the interrupts are disabled runs once they are enabled again
+ */
+#ifndef CPU_SIM_INTERRUPTS
+#define CPU_SIM_INTERRUPTS                  (STD_OFF)
+#endif
+
+#if (CPU_SIM_INTERRUPTS == STD_ON)
+/* Description: Disable the simulated interrupts and return their previous state */
+uint32 Cpu_SimEnterCritical(void);
+
+/* Description: Restore the state of the simulated interrupts, a pending ISR runs once they are enabled */
+void Cpu_SimExitCritical(uint32 State);
+#endif
+
+#else
+
+#include "tm4c123gh6pm_registers.h"
+#include "Mcu_Cfg.h"
+
+#ifdef __ICCARM__
+#include <intrinsics.h>
+#endif
+
+/* Frequency of the counter returned by Cpu_GetCycleCount ... the DWT counts core clock cycles */
+#define CPU_CYCLE_COUNTER_FREQUENCY_HZ      (McuConf_CORE_CLOCK_FREQUENCY)
+
+#define CPU_DEMCR_TRCENA_MASK               0x01000000
+#define CPU_DWT_CTRL_CYCCNTENA_MASK         0x00000001
+
+#endif
+
+/* Type definition for the saved interrupt state returned by Cpu_EnterCritical */
+typedef uint32 Cpu_StateType;
+
+/* Convert a time in us to cycle counter counts */
+#define CPU_US_TO_CYCLES(US)                ((uint32)(US) * (CPU_CYCLE_COUNTER_FREQUENCY_HZ / 1000000U))
+
+/* Description: Enable the free running cycle counter of the core */
+LOCAL_INLINE void Cpu_InitCycleCounter(void)
+{
+#ifndef HOST_BUILD
+    CORE_DEMCR_REG |= CPU_DEMCR_TRCENA_MASK;       /* Enable the DWT unit */
+    DWT_CYCCNT_REG  = 0;                           /* Clear the cycle counter */
+    DWT_CTRL_REG   |= CPU_DWT_CTRL_CYCCNTENA_MASK; /* Start counting the core clock cycles */
+#endif
+}
+
+/* Description: Read the free running cycle counter ... it wraps around every 2^32 counts */
+LOCAL_INLINE uint32 Cpu_GetCycleCount(void)
+{
+#if defined(HOST_BUILD) && (CPU_SIM_CYCLE_COUNTER == STD_ON)
+    return Cpu_SimGetCycleCount();
+#elif defined(HOST_BUILD)
+    struct timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32)(((uint64)now.tv_sec * 1000000000U) + (uint64)now.tv_nsec);
+#else
+    return DWT_CYCCNT_REG;
+#endif
+}
+
+/* Description: Data Memory Barrier ... the memory accesses before it complete before any access after it,
+ *              it also stops the compiler from moving the accesses across it */
+LOCAL_INLINE void Cpu_DataMemoryBarrier(void)
+{
+#ifdef HOST_BUILD
+    __sync_synchronize();
+#elif defined(__ICCARM__)
+    __DMB();
+#else
+    __asm volatile ("DMB" : : : "memory");
+#endif
+}
+
+/* Description: Add 1 to *Address and return its previous value as a single atomic operation.
+ *              It retries the LDREX/STREX pair if an ISR accessed the exclusive monitor in between,
+ *              so it is safe from tasks and ISRs without masking the interrupts */
+LOCAL_INLINE uint32 Cpu_AtomicFetchIncrement(volatile uint32 * Address)
+{
+#if defined(__ICCARM__)
+    uint32 value;
+    do
+    {
+        value = __LDREX((unsigned long *)Address);
+    } while(__STREX(value + 1, (unsigned long *)Address) != 0);
+    return value;
+#else
+    return __atomic_fetch_add(Address, 1U, __ATOMIC_SEQ_CST);
+#endif
+}
+
+/* Description: Write Desired to *Address if it holds Expected as a single atomic operation and return the
+ *              value read, the write took place when it equals Expected. Safe from tasks and ISRs */
+LOCAL_INLINE uint32 Cpu_AtomicCompareExchange(volatile uint32 * Address, uint32 Expected, uint32 Desired)
+{
+#if defined(__ICCARM__)
+    uint32 value;
+    do
+    {
+        value = __LDREX((unsigned long *)Address);
+        if(value != Expected)
+        {
+            __CLREX(); /* Release the exclusive monitor, nothing to write */
+            break;
+        }
+    } while(__STREX(Desired, (unsigned long *)Address) != 0);
+    return value;
+#else
+    (void)__atomic_compare_exchange_n(Address, &Expected, Desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return Expected; /* Updated with the value read when the exchange failed */
+#endif
+}
+
+/* Description: Count the leading zero bits of Value in C ... portable fallback of Cpu_CountLeadingZeros */
+LOCAL_INLINE uint8 Cpu_CountLeadingZerosGeneric(uint32 Value)
+{
+    uint8 count = 0;
+
+    if(Value == 0)
+    {
+        return 32;
+    }
+    /* Binary search of the most significant set bit ... shift it to bit 31 while counting the shifts */
+    if((Value & 0xFFFF0000) == 0)
+    {
+        count += 16;
+        Value <<= 16;
+    }
+    if((Value & 0xFF000000) == 0)
+    {
+        count += 8;
+        Value <<= 8;
+    }
+    if((Value & 0xF0000000) == 0)
+    {
+        count += 4;
+        Value <<= 4;
+    }
+    if((Value & 0xC0000000) == 0)
+    {
+        count += 2;
+        Value <<= 2;
+    }
+    if((Value & 0x80000000) == 0)
+    {
+        count += 1;
+    }
+    return count;
+}
+
+/* Description: Count the leading zero bits of Value, 32 when Value is 0.
+ *              It is the single cycle CLZ instruction on the Cortex-M4 */
+LOCAL_INLINE uint8 Cpu_CountLeadingZeros(uint32 Value)
+{
+#if defined(__ICCARM__)
+    return (uint8)__CLZ(Value);
+#elif defined(__GNUC__)
+    return (uint8)((Value == 0) ? 32 : __builtin_clz(Value));
+#else
+    return Cpu_CountLeadingZerosGeneric(Value);
+#endif
+}
+
+/* Description: Disable the IRQ interrupts and return the previous PRIMASK to be restored by Cpu_ExitCritical.
+ *              It can be nested and called from tasks and ISRs */
+LOCAL_INLINE Cpu_StateType Cpu_EnterCritical(void)
+{
+#if defined(HOST_BUILD) && (CPU_SIM_INTERRUPTS == STD_ON)
+    return Cpu_SimEnterCritical();
+#elif defined(HOST_BUILD)
+    /* The host simulation calls the ISRs synchronously ... nothing to mask */
+    return 0;
+#elif defined(__ICCARM__)
+    Cpu_StateType state = __get_PRIMASK();
+    __disable_interrupt();
+    return state;
+#else
+    Cpu_StateType state;
+    __asm volatile ("MRS %0, PRIMASK\n CPSID I" : "=r" (state) : : "memory");
+    return state;
+#endif
+}
+
+/* Description: Restore the PRIMASK saved by Cpu_EnterCritical */
+LOCAL_INLINE void Cpu_ExitCritical(Cpu_StateType State)
+{
+#if defined(HOST_BUILD) && (CPU_SIM_INTERRUPTS == STD_ON)
+    Cpu_SimExitCritical(State);
+#elif defined(HOST_BUILD)
+    (void)State;
+#elif defined(__ICCARM__)
+    __set_PRIMASK(State);
+#else
+    __asm volatile ("MSR PRIMASK, %0" : : "r" (State) : "memory");
+#endif
+}
+
+#endif /* CPU_H */
@@ -10,16 +10,263 @@
  ******************************************************************************/
 
 #include "Det.h"
+#include "Cpu.h"
+#include "Gpt.h"
 
+#if (GPT_TIMESTAMP_API == STD_ON)
+#include "Gpt_Timestamp.h"
+#define DET_TIMESTAMP_FREQUENCY     (GPT_TIMESTAMP_FREQUENCY)
+#else
+#define DET_TIMESTAMP_FREQUENCY     (0U)
+#endif
+
+/* Index of the error number Number inside the ring buffer */
+#define DET_LOG_INDEX(Number)       ((Number) & (DET_LOG_SIZE - 1))
+
+/* Error log ... left out of the zero initialization of the startup code to be read after a warm reset */
+NO_INIT Det_LogType Det_Log;
+
+#if (DET_COUNTERS_API == STD_ON)
+
+/* Key of a free counter ... module 0xFFFF, service 0xFF and error 0xFF are not counted */
+#define DET_COUNTER_FREE            (0xFFFFFFFFU)
+
+/* Key of the counter of an error */
+#define DET_COUNTER_KEY(ModuleId, ApiId, ErrorId) \
+    (((uint32)(ModuleId) << 16) | ((uint32)(ApiId) << 8) | (uint32)(ErrorId))
+
+/* First slot tried for a key ... multiplicative hash keeping the top bits */
+#define DET_COUNTER_HASH(Key)       ((uint32)((Key) * 2654435761U) >> (32U - DET_COUNTER_TABLE_BITS))
+
+/* Description: Counter of one error in the hash table */
+typedef struct
+{
+    volatile uint32 key;    /* DET_COUNTER_KEY once claimed, DET_COUNTER_FREE before */
+    volatile uint32 count;
+    uint32 first_low;
+    uint32 first_high;
+    uint32 last_low;        /* Written by every report ... nested reports of the same error may mix their halves */
+    uint32 last_high;
+}Det_CounterSlotType;
+
+/* Description: Hash table with open addressing, kept across warm resets with the log */
+typedef struct
+{
+    volatile uint32 dropped;
+    Det_CounterSlotType slots[DET_COUNTER_TABLE_SIZE];
+}Det_CounterTableType;
+
+STATIC NO_INIT Det_CounterTableType Det_Counters;
+
+#endif
+
+/*********************************************************************************************/
+/* Description: Return the Gpt timestamp, 0 before Gpt_TimestampInit */
+STATIC uint64 Det_GetTimestamp(void)
+{
+#if (GPT_TIMESTAMP_API == STD_ON)
+    return Gpt_TimestampIsRunning() ? Gpt_GetTicks() : 0;
+#else
+    return 0;
+#endif
+}
+
+#if (DET_COUNTERS_API == STD_ON)
+/*********************************************************************************************/
+/* Description: Count one report ... the probe sequence stops at the counter of the error or at a free one
+ *              claimed by compare and exchange, so two reporters never claim the same counter */
+STATIC void Det_CountError(uint16 ModuleId, uint8 ApiId, uint8 ErrorId, uint64 Timestamp)
+{
+    uint32 key  = DET_COUNTER_KEY(ModuleId, ApiId, ErrorId);
+    uint32 hash = DET_COUNTER_HASH(key);
+    uint32 probe;
+    uint32 found;
+    Det_CounterSlotType * slot;
+
+    for(probe = 0; probe < DET_COUNTER_MAX_PROBES; probe++)
+    {
+        slot  = &Det_Counters.slots[(hash + probe) & (DET_COUNTER_TABLE_SIZE - 1)];
+        found = slot->key;
+        if(found == DET_COUNTER_FREE)
+        {
+            found = Cpu_AtomicCompareExchange(&slot->key, DET_COUNTER_FREE, key);
+            if(found == DET_COUNTER_FREE)
+            {
+                found = key; /* Claimed by this report */
+            }
+        }
+        if(found == key)
+        {
+            if(Cpu_AtomicFetchIncrement(&slot->count) == 0)
+            {
+                slot->first_low  = (uint32)Timestamp;
+                slot->first_high = (uint32)(Timestamp >> 32);
+            }
+            slot->last_low  = (uint32)Timestamp;
+            slot->last_high = (uint32)(Timestamp >> 32);
+            return;
+        }
+    }
+    (void)Cpu_AtomicFetchIncrement(&Det_Counters.dropped);
+}
+#endif
+
+/*********************************************************************************************/
+void Det_Init(void)
+{
+    uint32 index;
+
+    if((Det_Log.magic == DET_LOG_MAGIC) && (Det_Log.size == DET_LOG_SIZE) && (Det_Log.clock_hz == DET_TIMESTAMP_FREQUENCY))
+    {
+        /* Warm reset ... keep the errors logged before it */
+        Det_Log.resets++;
+        return;
+    }
+
+    /* Power up ... the RAM holds random values */
+    Det_Log.magic    = 0;
+    Det_Log.clock_hz = DET_TIMESTAMP_FREQUENCY;
+    Det_Log.size     = DET_LOG_SIZE;
+    Det_Log.head     = 0;
+    Det_Log.resets   = 0;
+    for(index = 0; index < DET_LOG_SIZE; index++)
+    {
+        Det_Log.records[index].sequence = 0;
+    }
+#if (DET_COUNTERS_API == STD_ON)
+    Det_ResetCounters();
+#endif
+    Det_Log.magic    = DET_LOG_MAGIC;
+}
+
+/*********************************************************************************************/
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                       uint8 InstanceId,
                       uint8 ApiId,
                       uint8 ErrorId )
 {
+    /* Claim the next record without masking the interrupts, a nested report claims the one after it.
+     * Only DET_LOG_SIZE nested reports during this one reach the same record and lose it */
+    uint32 number = Cpu_AtomicFetchIncrement(&Det_Log.head);
+    volatile Det_RecordType * record = &Det_Log.records[DET_LOG_INDEX(number)];
+    uint64 timestamp = Det_GetTimestamp();
+
+    /* Invalidate the record while it is written ... a reset or a reader in between finds it incomplete */
+    record->sequence = 0;
+    Cpu_DataMemoryBarrier();
+
+    record->module_id      = ModuleId;
+    record->instance_id    = InstanceId;
+    record->api_id         = ApiId;
+    record->error_id       = ErrorId;
+    record->timestamp_low  = (uint32)timestamp;
+    record->timestamp_high = (uint32)(timestamp >> 32);
+
+    Cpu_DataMemoryBarrier();
+    record->sequence = number + 1;
+
+#if (DET_COUNTERS_API == STD_ON)
+    Det_CountError(ModuleId, ApiId, ErrorId, timestamp);
+#endif
+
+#if (DET_HALT_ON_ERROR == STD_ON)
     while(1)
     {
 
     }
+#endif
+    return E_OK;
+}
+
+/*********************************************************************************************/
+uint32 Det_GetErrorCount(void)
+{
+    return Det_Log.head;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Det_ReadRecord(uint32 Number, Det_RecordType * Record)
+{
+    volatile Det_RecordType * record = &Det_Log.records[DET_LOG_INDEX(Number)];
+
+    if(Record == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+
+    /* The sequence is checked before and after the copy, a report in between changes it */
+    if(record->sequence != (Number + 1))
+    {
+        return E_NOT_OK;
+    }
+    Cpu_DataMemoryBarrier();
+    Record->module_id      = record->module_id;
+    Record->instance_id    = record->instance_id;
+    Record->api_id         = record->api_id;
+    Record->error_id       = record->error_id;
+    Record->timestamp_low  = record->timestamp_low;
+    Record->timestamp_high = record->timestamp_high;
+    Cpu_DataMemoryBarrier();
+    if(record->sequence != (Number + 1))
+    {
+        return E_NOT_OK;
+    }
+    Record->sequence = Number + 1;
     return E_OK;
 }
 
+#if (DET_COUNTERS_API == STD_ON)
+/*********************************************************************************************/
+Std_ReturnType Det_GetNextCounter(uint32 * Iterator, Det_CounterType * Counter)
+{
+    Det_CounterSlotType * slot;
+    uint32 key;
+
+    if((Iterator == NULL_PTR) || (Counter == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+
+    /* Skip the free counters and the counters claimed but not incremented yet */
+    for(; *Iterator < DET_COUNTER_TABLE_SIZE; (*Iterator)++)
+    {
+        slot = &Det_Counters.slots[*Iterator];
+        key  = slot->key;
+        if((key != DET_COUNTER_FREE) && (slot->count != 0))
+        {
+            Counter->module_id       = (uint16)(key >> 16);
+            Counter->api_id          = (uint8)(key >> 8);
+            Counter->error_id        = (uint8)key;
+            Counter->count           = slot->count;
+            Counter->first_timestamp = ((uint64)slot->first_high << 32) | slot->first_low;
+            Counter->last_timestamp  = ((uint64)slot->last_high << 32) | slot->last_low;
+            (*Iterator)++;
+            return E_OK;
+        }
+    }
+    return E_NOT_OK;
+}
+
+/*********************************************************************************************/
+uint32 Det_GetDroppedCount(void)
+{
+    return Det_Counters.dropped;
+}
+
+/*********************************************************************************************/
+void Det_ResetCounters(void)
+{
+    Cpu_StateType state;
+    uint32 index;
+
+    /* A report from an ISR waits for the whole table ... it never finds a counter freed with its count left */
+    state = Cpu_EnterCritical();
+    for(index = 0; index < DET_COUNTER_TABLE_SIZE; index++)
+    {
+        Det_Counters.slots[index].count = 0;
+        Det_Counters.slots[index].key   = DET_COUNTER_FREE;
+    }
+    Det_Counters.dropped = 0;
+    Cpu_ExitCritical(state);
+}
+#endif
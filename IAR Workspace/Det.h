@@ -6,6 +6,17 @@
  *
  * Description:  Det stores the development errors reported by other modules.
  *
+ *               Every error is appended to Det_Log, a ring buffer of the last
+ *               DET_LOG_SIZE errors with their timestamp, and Det_ReportError
+ *               returns to the caller unless DET_HALT_ON_ERROR is STD_ON.
+ *               The log is not cleared by the startup code so the errors
+ *               before a watchdog or software reset can be read after it,
+ *               dump it from RAM and convert it by Host Tools/Det_LogDecoder.c.
+ *
+ *               Every error is also counted per (module, service, error) in a
+ *               hash table with the time of its first and last report, to tell
+ *               which check fires how often without keeping every report.
+ *
  * Author: Mohamed Tarek
  ******************************************************************************/
 
@@ -46,12 +57,200 @@
   #error "The AR version of Std_Types.h does not match the expected version"
 #endif
 
+/* Det Pre-Compile Configuration Header file */
+#include "Det_Cfg.h"
+
+/* AUTOSAR Version checking between Det_Cfg.h and Det.h files */
+#if ((DET_CFG_AR_RELEASE_MAJOR_VERSION != DET_AR_MAJOR_VERSION)\
+ ||  (DET_CFG_AR_RELEASE_MINOR_VERSION != DET_AR_MINOR_VERSION)\
+ ||  (DET_CFG_AR_RELEASE_PATCH_VERSION != DET_AR_PATCH_VERSION))
+  #error "The AR version of Det_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Det_Cfg.h and Det.h files */
+#if ((DET_CFG_SW_MAJOR_VERSION != DET_SW_MAJOR_VERSION)\
+ ||  (DET_CFG_SW_MINOR_VERSION != DET_SW_MINOR_VERSION)\
+ ||  (DET_CFG_SW_PATCH_VERSION != DET_SW_PATCH_VERSION))
+  #error "The SW version of Det_Cfg.h does not match the expected version"
+#endif
+
+#if ((DET_LOG_SIZE & (DET_LOG_SIZE - 1)) != 0)
+  #error "DET_LOG_SIZE shall be a power of 2"
+#endif
+
+#if (DET_COUNTERS_API == STD_ON)
+
+/* Number of the counters in the hash table */
+#define DET_COUNTER_TABLE_SIZE        (1U << DET_COUNTER_TABLE_BITS)
+
+#if ((2U * DET_COUNTER_TABLE_SIZE) < (3U * DET_REPORTED_ERRORS))
+  #error "DET_COUNTER_TABLE_BITS is too small for DET_REPORTED_ERRORS"
+#endif
+
+#if (DET_COUNTER_MAX_PROBES > DET_COUNTER_TABLE_SIZE)
+  #error "DET_COUNTER_MAX_PROBES shall not exceed the counters in the hash table"
+#endif
+
+#endif
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Value of the magic member ... tells a log kept across a warm reset from random RAM after power up */
+#define DET_LOG_MAGIC                 (0x4445544CU) /* "DETL" */
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Description: One reported error, 5 words in the RAM dump */
+typedef struct
+{
+    uint32 sequence;       /* Number of the error + 1, 0 while the record is being written */
+    uint16 module_id;
+    uint8 instance_id;
+    uint8 api_id;
+    uint8 error_id;
+    uint8 reserved[3];
+    uint32 timestamp_low;  /* Gpt timestamp in core clock cycles, 0 if reported before Gpt_TimestampInit */
+    uint32 timestamp_high;
+}Det_RecordType;
+
+/* Description: Error log ring buffer ... dump Det_Log from RAM and convert it by the host decoder */
+typedef struct
+{
+    uint32 magic;          /* DET_LOG_MAGIC once the log is initialized */
+    uint32 clock_hz;       /* Frequency of the timestamps */
+    uint32 size;           /* Number of records in the ring buffer */
+    volatile uint32 head;  /* Number of errors reported so far, the next one goes to records[head % size] */
+    uint32 resets;         /* Number of warm resets which kept the log */
+    Det_RecordType records[DET_LOG_SIZE];
+}Det_LogType;
+
+/* Description: Occurrences of one error of one service, returned by Det_GetNextCounter */
+typedef struct
+{
+    uint16 module_id;
+    uint8 api_id;
+    uint8 error_id;
+    uint32 count;
+    uint64 first_timestamp; /* Gpt timestamps in core clock cycles, 0 if reported before Gpt_TimestampInit */
+    uint64 last_timestamp;
+}Det_CounterType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Det_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to initialize the error log, called first by main:
+*              - Keep the log and the counters and count the reset after a warm reset
+*              - Clear them after a power up
+************************************************************************************/
+void Det_Init(void);
+
+/************************************************************************************
+* Service Name: Det_ReportError
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ModuleId - Module ID of the calling module
+*                  InstanceId - Index of the instance of the calling module
+*                  ApiId - Service ID of the API which detected the error
+*                  ErrorId - ID of the detected development error
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - always E_OK
+* Description: Function to append the error to the log and count it, safe to be called from
+*              tasks and ISRs without masking the interrupts, in a bounded time.
+************************************************************************************/
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                                 uint8 InstanceId,
                                 uint8 ApiId,
 		                uint8 ErrorId );
 
+/************************************************************************************
+* Service Name: Det_GetErrorCount
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of errors reported since the power up
+* Description: Function to get the number of the reported errors, the log keeps the last DET_LOG_SIZE.
+************************************************************************************/
+uint32 Det_GetErrorCount(void);
+
+/************************************************************************************
+* Service Name: Det_ReadRecord
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Number - Number of the error, from 0 for the first one since the power up
+* Parameters (inout): None
+* Parameters (out): Record - Copy of the logged error
+* Return value: Std_ReturnType - E_OK: the error was copied
+*                                E_NOT_OK: not reported yet, overwritten or overwritten during the copy
+* Description: Function to read one logged error while the other errors are still reported.
+************************************************************************************/
+Std_ReturnType Det_ReadRecord(uint32 Number, Det_RecordType * Record);
+
+#if (DET_COUNTERS_API == STD_ON)
+
+/************************************************************************************
+* Service Name: Det_GetNextCounter
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): Iterator - Set to 0 before the first call, updated to the next counter
+* Parameters (out): Counter - Occurrences of the next error reported since the last reset
+* Return value: Std_ReturnType - E_OK: Counter is valid
+*                                E_NOT_OK: no more counters or invalid parameter
+* Description: Function to enumerate the counted errors in the order of the hash table:
+*                  uint32 iterator = 0;
+*                  while(Det_GetNextCounter(&iterator, &counter) == E_OK) { ... }
+************************************************************************************/
+Std_ReturnType Det_GetNextCounter(uint32 * Iterator, Det_CounterType * Counter);
+
+/************************************************************************************
+* Service Name: Det_GetDroppedCount
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of the reports not counted since the last reset
+* Description: Function to get the number of reports which found no free counter in
+*              DET_COUNTER_MAX_PROBES slots, they are still in the log.
+************************************************************************************/
+uint32 Det_GetDroppedCount(void);
+
+/************************************************************************************
+* Service Name: Det_ResetCounters
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear all the counters, the log is kept. The interrupts are
+*              disabled while the counters are cleared, an error reported by an ISR
+*              meanwhile is counted once they are cleared.
+************************************************************************************/
+void Det_ResetCounters(void);
+
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Error log, kept across warm resets */
+extern Det_LogType Det_Log;
+
 #endif /* DET_H */
@@ -0,0 +1,57 @@
+ /******************************************************************************
+ *
+ * Module: Det
+ *
+ * File Name: Det_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for the Det module
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef DET_CFG_H
+#define DET_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define DET_CFG_SW_MAJOR_VERSION              (1U)
+#define DET_CFG_SW_MINOR_VERSION              (0U)
+#define DET_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define DET_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define DET_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define DET_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/*
+ * Pre-compile option to stop in Det_ReportError after logging the error ... STD_ON to catch
+ * the first error with the debugger, STD_OFF to log the errors and return to the caller
+ */
+#define DET_HALT_ON_ERROR                   (STD_OFF)
+
+/* Number of the last errors kept in the log, a power of two */
+#define DET_LOG_SIZE                        (32U)
+
+/* Pre-compile option for the error counters per module, service and error */
+#define DET_COUNTERS_API                    (STD_ON)
+
+/*
+ * Number of the different errors the modules can report, one counter each per service
+ * and error (the Det_ReportError calls of every *_SID with every *_E_ code it reports):
+ * Port 9, Dio 8, Gpt 19, Icu 14, Mcu 8
+ */
+#define DET_REPORTED_ERRORS                 (9U + 8U + 19U + 14U + 8U)
+
+/*
+ * Counters in the hash table as a power of two ... at least 1.5 times the reported errors
+ * to keep the probe sequences short, the errors beyond it are only counted as dropped
+ */
+#define DET_COUNTER_TABLE_BITS              (7U)
+
+/* Slots tried for one error before it is dropped, bounds the time of Det_ReportError */
+#define DET_COUNTER_MAX_PROBES              (8U)
+
+#endif /* DET_CFG_H */
@@ -11,6 +11,7 @@
 
 #include "Dio.h"
 #include "Dio_Regs.h"
+#include "Reg_Access.h"
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 
@@ -40,7 +41,7 @@ STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 ************************************************************************************/
 void Dio_Init(const Dio_ConfigType * ConfigPtr)
 {
-#if (DIO_DEV_ERROR_DETECT == STD_ON)
+#if DIO_DEV_ERROR_CHECK(DIO_DEV_ERROR_INIT, DIO_DEV_ERROR_POINTER_CHECK)
 	/* check if the input configuration pointer is not a NULL_PTR */
 	if (NULL_PTR == ConfigPtr)
 	{
@@ -73,10 +74,12 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 ************************************************************************************/
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	uint32 Port_Address = 0;
 	boolean error = FALSE;
 
-#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	REG_ACCESS_API(DIO_MODULE_ID, DIO_WRITE_CHANNEL_SID);
+
+#if DIO_DEV_ERROR_CHECK(DIO_DEV_ERROR_WRITE_CHANNEL, DIO_DEV_ERROR_UNINIT_CHECK)
 	/* Check if the Driver is initialized before using this function */
 	if (DIO_NOT_INITIALIZED == Dio_Status)
 	{
@@ -88,6 +91,8 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	{
 		/* No Action Required */
 	}
+#endif
+#if DIO_DEV_ERROR_CHECK(DIO_DEV_ERROR_WRITE_CHANNEL, DIO_DEV_ERROR_RANGE_CHECK)
 	/* Check if the used channel is within the valid range */
 	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
 	{
@@ -105,31 +110,31 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
+		/* Select the address of the correct PORT register according to the Port Id stored in the Port_Num member */
 		switch(Dio_PortChannels[ChannelId].Port_Num)
 		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
+                    case 0:    Port_Address = GPIO_PORTA_DATA_ADDRESS;
 		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
+		    case 1:    Port_Address = GPIO_PORTB_DATA_ADDRESS;
 		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
+		    case 2:    Port_Address = GPIO_PORTC_DATA_ADDRESS;
 		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
+		    case 3:    Port_Address = GPIO_PORTD_DATA_ADDRESS;
 		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
+                    case 4:    Port_Address = GPIO_PORTE_DATA_ADDRESS;
 		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
+                    case 5:    Port_Address = GPIO_PORTF_DATA_ADDRESS;
 		               break;
 		}
 		if(Level == STD_HIGH)
 		{
 			/* Write Logic High */
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			REG_SET_BIT32(Port_Address, Dio_PortChannels[ChannelId].Ch_Num);
 		}
 		else if(Level == STD_LOW)
 		{
 			/* Write Logic Low */
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			REG_CLEAR_BIT32(Port_Address, Dio_PortChannels[ChannelId].Ch_Num);
 		}
 	}
 	else
@@ -152,11 +157,13 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 ************************************************************************************/
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	uint32 Port_Address = 0;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
-#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	REG_ACCESS_API(DIO_MODULE_ID, DIO_READ_CHANNEL_SID);
+
+#if DIO_DEV_ERROR_CHECK(DIO_DEV_ERROR_READ_CHANNEL, DIO_DEV_ERROR_UNINIT_CHECK)
 	/* Check if the Driver is initialized before using this function */
 	if (DIO_NOT_INITIALIZED == Dio_Status)
 	{
@@ -168,6 +175,8 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	{
 		/* No Action Required */
 	}
+#endif
+#if DIO_DEV_ERROR_CHECK(DIO_DEV_ERROR_READ_CHANNEL, DIO_DEV_ERROR_RANGE_CHECK)
 	/* Check if the used channel is within the valid range */
 	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
 	{
@@ -185,24 +194,24 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
+		/* Select the address of the correct PORT register according to the Port Id stored in the Port_Num member */
 		switch(Dio_PortChannels[ChannelId].Port_Num)
 		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
+                    case 0:    Port_Address = GPIO_PORTA_DATA_ADDRESS;
 		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
+		    case 1:    Port_Address = GPIO_PORTB_DATA_ADDRESS;
 		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
+		    case 2:    Port_Address = GPIO_PORTC_DATA_ADDRESS;
 		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
+		    case 3:    Port_Address = GPIO_PORTD_DATA_ADDRESS;
 		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
+                    case 4:    Port_Address = GPIO_PORTE_DATA_ADDRESS;
 		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
+                    case 5:    Port_Address = GPIO_PORTF_DATA_ADDRESS;
 		               break;
 		}
 		/* Read the required channel */
-		if(BIT_IS_SET(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num))
+		if(REG_BIT_IS_SET32(Port_Address, Dio_PortChannels[ChannelId].Ch_Num))
 		{
 			output = STD_HIGH;
 		}
@@ -232,7 +241,7 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 #if (DIO_VERSION_INFO_API == STD_ON)
 void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 {
-#if (DIO_DEV_ERROR_DETECT == STD_ON)
+#if DIO_DEV_ERROR_CHECK(DIO_DEV_ERROR_VERSION_INFO, DIO_DEV_ERROR_POINTER_CHECK)
 	/* Check if input pointer is not Null pointer */
 	if(NULL_PTR == versioninfo)
 	{
@@ -241,7 +250,7 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 				DIO_GET_VERSION_INFO_SID, DIO_E_PARAM_POINTER);
 	}
 	else
-#endif /* (DIO_DEV_ERROR_DETECT == STD_ON) */
+#endif
 	{
 		/* Copy the vendor Id */
 		versioninfo->vendorID = (uint16)DIO_VENDOR_ID;
@@ -271,11 +280,13 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	uint32 Port_Address = 0;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
-#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	REG_ACCESS_API(DIO_MODULE_ID, DIO_FLIP_CHANNEL_SID);
+
+#if DIO_DEV_ERROR_CHECK(DIO_DEV_ERROR_FLIP_CHANNEL, DIO_DEV_ERROR_UNINIT_CHECK)
 	/* Check if the Driver is initialized before using this function */
 	if (DIO_NOT_INITIALIZED == Dio_Status)
 	{
@@ -287,6 +298,8 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	{
 		/* No Action Required */
 	}
+#endif
+#if DIO_DEV_ERROR_CHECK(DIO_DEV_ERROR_FLIP_CHANNEL, DIO_DEV_ERROR_RANGE_CHECK)
 	/* Check if the used channel is within the valid range */
 	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
 	{
@@ -304,31 +317,31 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
+		/* Select the address of the correct PORT register according to the Port Id stored in the Port_Num member */
 		switch(Dio_PortChannels[ChannelId].Port_Num)
 		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
+                    case 0:    Port_Address = GPIO_PORTA_DATA_ADDRESS;
 		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
+		    case 1:    Port_Address = GPIO_PORTB_DATA_ADDRESS;
 		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
+		    case 2:    Port_Address = GPIO_PORTC_DATA_ADDRESS;
 		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
+		    case 3:    Port_Address = GPIO_PORTD_DATA_ADDRESS;
 		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
+                    case 4:    Port_Address = GPIO_PORTE_DATA_ADDRESS;
 		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
+                    case 5:    Port_Address = GPIO_PORTF_DATA_ADDRESS;
 		               break;
 		}
 		/* Read the required channel and write the required level */
-		if(BIT_IS_SET(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num))
+		if(REG_BIT_IS_SET32(Port_Address, Dio_PortChannels[ChannelId].Ch_Num))
 		{
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			REG_CLEAR_BIT32(Port_Address, Dio_PortChannels[ChannelId].Ch_Num);
 			output = STD_LOW;
 		}
 		else
 		{
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			REG_SET_BIT32(Port_Address, Dio_PortChannels[ChannelId].Ch_Num);
 			output = STD_HIGH;
 		}
 	}
@@ -42,6 +42,13 @@
 #define DIO_INITIALIZED                (1U)
 #define DIO_NOT_INITIALIZED            (0U)
 
+/*
+ * Macros for the Development Error Detect profiles of DIO_DEV_ERROR_PROFILE
+ */
+#define DIO_DEV_ERROR_PROFILE_ALL      (0U)
+#define DIO_DEV_ERROR_PROFILE_CONFIG   (1U)
+#define DIO_DEV_ERROR_PROFILE_CUSTOM   (2U)
+
 /* Standard AUTOSAR types */
 #include "Std_Types.h"
 
@@ -128,6 +135,33 @@
  * error code (Not exist in AUTOSAR 4.0.3 DIO SWS Document.
  */
 #define DIO_E_UNINIT                   (uint8)0xF0
+
+/* APIs which check their development errors in the selected DIO_DEV_ERROR_PROFILE */
+#if (DIO_DEV_ERROR_PROFILE == DIO_DEV_ERROR_PROFILE_ALL)
+#define DIO_DEV_ERROR_INIT             (STD_ON)
+#define DIO_DEV_ERROR_READ_CHANNEL     (STD_ON)
+#define DIO_DEV_ERROR_WRITE_CHANNEL    (STD_ON)
+#define DIO_DEV_ERROR_FLIP_CHANNEL     (STD_ON)
+#define DIO_DEV_ERROR_VERSION_INFO     (STD_ON)
+#elif (DIO_DEV_ERROR_PROFILE == DIO_DEV_ERROR_PROFILE_CONFIG)
+#define DIO_DEV_ERROR_INIT             (STD_ON)
+#define DIO_DEV_ERROR_READ_CHANNEL     (STD_OFF)
+#define DIO_DEV_ERROR_WRITE_CHANNEL    (STD_OFF)
+#define DIO_DEV_ERROR_FLIP_CHANNEL     (STD_OFF)
+#define DIO_DEV_ERROR_VERSION_INFO     (STD_ON)
+#elif (DIO_DEV_ERROR_PROFILE == DIO_DEV_ERROR_PROFILE_CUSTOM)
+#define DIO_DEV_ERROR_INIT             (DIO_DEV_ERROR_CUSTOM_INIT)
+#define DIO_DEV_ERROR_READ_CHANNEL     (DIO_DEV_ERROR_CUSTOM_READ_CHANNEL)
+#define DIO_DEV_ERROR_WRITE_CHANNEL    (DIO_DEV_ERROR_CUSTOM_WRITE_CHANNEL)
+#define DIO_DEV_ERROR_FLIP_CHANNEL     (DIO_DEV_ERROR_CUSTOM_FLIP_CHANNEL)
+#define DIO_DEV_ERROR_VERSION_INFO     (DIO_DEV_ERROR_CUSTOM_VERSION_INFO)
+#else
+  #error "DIO_DEV_ERROR_PROFILE shall be one of the DIO_DEV_ERROR_PROFILE_xxx values"
+#endif
+
+/* STD_ON if the API checks the class of errors ... to be evaluated by #if */
+#define DIO_DEV_ERROR_CHECK(API, CLASS) \
+    ((DIO_DEV_ERROR_DETECT == STD_ON) && ((API) == STD_ON) && ((CLASS) == STD_ON))
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
@@ -14,11 +14,12 @@
 
 #include "Std_Types.h"
 
-#define GPIO_PORTA_DATA_REG       (*((volatile uint32 *)0x400043FC))
-#define GPIO_PORTB_DATA_REG       (*((volatile uint32 *)0x400053FC))
-#define GPIO_PORTC_DATA_REG       (*((volatile uint32 *)0x400063FC))
-#define GPIO_PORTD_DATA_REG       (*((volatile uint32 *)0x400073FC))
-#define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)0x400243FC))
-#define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)0x400253FC))
+/* GPIODATA registers addresses with all the 8 bits of the address mask set */
+#define GPIO_PORTA_DATA_ADDRESS   0x400043FC
+#define GPIO_PORTB_DATA_ADDRESS   0x400053FC
+#define GPIO_PORTC_DATA_ADDRESS   0x400063FC
+#define GPIO_PORTD_DATA_ADDRESS   0x400073FC
+#define GPIO_PORTE_DATA_ADDRESS   0x400243FC
+#define GPIO_PORTF_DATA_ADDRESS   0x400253FC
 
 #endif /* DIO_REGS_H */
@@ -4,21 +4,47 @@
  *
  * File Name: Gpt.c
  *
- * Description: Source file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Source file for TM4C123GH6PM Microcontroller - Gpt Driver.
  *
  * Author: Mohamed Tarek
  ******************************************************************************/
 
 #include "Gpt.h"
-#include "tm4c123gh6pm_registers.h"
+#include "Gpt_Regs.h"
+#include "Gpt_Timestamp.h"
+#include "Cpu.h"
+#include "Mcu.h"
+#include "Reg_Access.h"
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Gpt Modules */
+#if ((DET_AR_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
 
 #define SYSTICK_PRIORITY_MASK  0x1FFFFFFF
 #define SYSTICK_INTERRUPT_PRIORITY  3
 #define SYSTICK_PRIORITY_BITS_POS   29
 
-/* Global pointer to function used to point upper layer functions
- * to be used in Call Back */
-static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
+/* Entry of the subscriber table used by SysTick_SetCallBack */
+#define SYSTICK_SET_CALL_BACK_INDEX  0
+
+/* Description: Entry of the SysTick subscriber table */
+typedef struct
+{
+    SysTick_CallBackType call_back;  /* Upper layer function, NULL_PTR for a free entry */
+    uint16 divisor;                  /* Ticks between two calls */
+    uint16 countdown;                /* Ticks left to the next call ... no division in the ISR */
+}SysTick_SubscriberType;
+
+/* Global array of the upper layer functions called by the SysTick ISR */
+static volatile SysTick_SubscriberType g_SysTick_Subscriber[SYSTICK_SUBSCRIBERS_NUM];
 
 /************************************************************************************
 * Service Name: SysTick_Handler
@@ -26,10 +52,16 @@ static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
 ************************************************************************************/
 void SysTick_Handler(void)
 {
-    /* Check if the Timer0_setCallBack is already called */
-    if(g_SysTick_Call_Back_Ptr != NULL_PTR)
+    uint8 index;
+
+    for(index = 0; index < SYSTICK_SUBSCRIBERS_NUM; index++)
     {
-        (*g_SysTick_Call_Back_Ptr)(); /* call the function in the scheduler using call-back concept */
+        /* Check if the entry is subscribed and its divisor elapsed */
+        if((g_SysTick_Subscriber[index].call_back != NULL_PTR) && (--g_SysTick_Subscriber[index].countdown == 0))
+        {
+            g_SysTick_Subscriber[index].countdown = g_SysTick_Subscriber[index].divisor;
+            (*g_SysTick_Subscriber[index].call_back)(); /* call the upper layer function using call-back concept */
+        }
     }
     /* No need to clear the trigger flag (COUNT) bit ... it cleared automatically by the HW */
 }
@@ -44,21 +76,24 @@ void SysTick_Handler(void)
 * Return value: None
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
 *              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Enable SysTick Timer with the System clock of Mcu_GetSysClockFrequency,
+*                up to 209 miliseconds at 80Mhz (24-bit reload value)
 *              - Enable SysTick Timer Interrupt and set its priority
 ************************************************************************************/
 void SysTick_Start(uint16 Tick_Time)
 {
-    SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * Tick_Time;         /* Set the Reload value to count n miliseconds */
-    SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
+    REG_ACCESS_API(GPT_MODULE_ID, SYSTICK_START_SID);
+
+    REG_WRITE32(SYSTICK_CTRL_ADDRESS, 0);                /* Disable the SysTick Timer by Clear the ENABLE Bit */
+    REG_WRITE32(SYSTICK_RELOAD_ADDRESS, ((Mcu_GetSysClockFrequency() / 1000) * Tick_Time) - 1); /* Set the Reload value to count n miliseconds */
+    REG_WRITE32(SYSTICK_CURRENT_ADDRESS, 0);             /* Clear the Current Register value */
     /* Configure the SysTick Control Register 
      * Enable the SysTick Timer (ENABLE = 1)
      * Enable SysTick Interrupt (INTEN = 1)
      * Choose the clock source to be System Clock (CLK_SRC = 1) */
-    SYSTICK_CTRL_REG   |= 0x07;
+    REG_SET_MASK32(SYSTICK_CTRL_ADDRESS, 0x07);
     /* Assign priority level 3 to the SysTick Interrupt */
-    NVIC_SYSTEM_PRI3_REG =  (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS);
+    REG_WRITE32(NVIC_SYSTEM_PRI3_ADDRESS, (REG_READ32(NVIC_SYSTEM_PRI3_ADDRESS) & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS));
 }
 
 /************************************************************************************
@@ -73,7 +108,8 @@ void SysTick_Start(uint16 Tick_Time)
 ************************************************************************************/
 void SysTick_Stop(void)
 {
-    SYSTICK_CTRL_REG = 0; /* Disable the SysTick Timer by Clear the ENABLE Bit */
+    REG_ACCESS_API(GPT_MODULE_ID, SYSTICK_STOP_SID);
+    REG_WRITE32(SYSTICK_CTRL_ADDRESS, 0); /* Disable the SysTick Timer by Clear the ENABLE Bit */
 }
 
 /************************************************************************************
@@ -84,9 +120,788 @@ void SysTick_Stop(void)
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the SysTick Timer call back
+* Description: Function to Setup the SysTick Timer call back, called every tick
+*              from the entry of the subscriber table reserved for it.
 ************************************************************************************/
 void SysTick_SetCallBack(void(*Ptr2Func)(void))
 {
-    g_SysTick_Call_Back_Ptr = Ptr2Func;
-}
\ No newline at end of file
+    g_SysTick_Subscriber[SYSTICK_SET_CALL_BACK_INDEX].divisor   = 1;
+    g_SysTick_Subscriber[SYSTICK_SET_CALL_BACK_INDEX].countdown = 1;
+    g_SysTick_Subscriber[SYSTICK_SET_CALL_BACK_INDEX].call_back = Ptr2Func;
+}
+
+/************************************************************************************
+* Service Name: SysTick_Subscribe
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Ptr2Func - Call Back function address
+*                  Divisor - Call the function every Divisor ticks, at least 1
+*                  Phase - Ticks before the first call minus 1, less than Divisor
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK: invalid parameter or no free entry in the table
+* Description: Function to add a call back to the SysTick subscriber table, the
+*              subscribers with the same Divisor and different Phase values are called
+*              in different ticks.
+************************************************************************************/
+Std_ReturnType SysTick_Subscribe(SysTick_CallBackType Ptr2Func, uint16 Divisor, uint16 Phase)
+{
+    uint8 index;
+
+    if((Ptr2Func == NULL_PTR) || (Divisor == 0) || (Phase >= Divisor))
+    {
+        return E_NOT_OK;
+    }
+
+    for(index = SYSTICK_SET_CALL_BACK_INDEX + 1; index < SYSTICK_SUBSCRIBERS_NUM; index++)
+    {
+        if(g_SysTick_Subscriber[index].call_back == NULL_PTR)
+        {
+            /* The call back is written last ... the ISR never sees a half written entry */
+            g_SysTick_Subscriber[index].divisor   = Divisor;
+            g_SysTick_Subscriber[index].countdown = Phase + 1;
+            g_SysTick_Subscriber[index].call_back = Ptr2Func;
+            return E_OK;
+        }
+    }
+    return E_NOT_OK;
+}
+
+/************************************************************************************
+* Service Name: SysTick_Unsubscribe
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Ptr2Func - Call Back function address
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK: the function is not subscribed
+* Description: Function to remove a call back added by SysTick_Subscribe.
+************************************************************************************/
+Std_ReturnType SysTick_Unsubscribe(SysTick_CallBackType Ptr2Func)
+{
+    uint8 index;
+
+    for(index = SYSTICK_SET_CALL_BACK_INDEX + 1; index < SYSTICK_SUBSCRIBERS_NUM; index++)
+    {
+        if((Ptr2Func != NULL_PTR) && (g_SysTick_Subscriber[index].call_back == Ptr2Func))
+        {
+            g_SysTick_Subscriber[index].call_back = NULL_PTR;
+            return E_OK;
+        }
+    }
+    return E_NOT_OK;
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetCurrentValue
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current value of the SysTick down counter
+* Description: Function to read the SysTick Timer counter, it counts down from the
+*              reload value to zero every tick.
+************************************************************************************/
+uint32 SysTick_GetCurrentValue(void)
+{
+    REG_ACCESS_API(GPT_MODULE_ID, SYSTICK_GET_CURRENT_VALUE_SID);
+    return REG_READ32(SYSTICK_CURRENT_ADDRESS);
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetReloadValue
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Reload value of the SysTick Timer
+* Description: Function to read the SysTick Timer reload value, one tick lasts
+*              (reload value + 1) System clock cycles.
+************************************************************************************/
+uint32 SysTick_GetReloadValue(void)
+{
+    REG_ACCESS_API(GPT_MODULE_ID, SYSTICK_GET_RELOAD_VALUE_SID);
+    return REG_READ32(SYSTICK_RELOAD_ADDRESS);
+}
+
+/*******************************************************************************
+ *                      General-Purpose Timers                                 *
+ *******************************************************************************/
+
+/* Timer configuration values ... the 16/32-bit timers concatenate A and B, the wide timers use A alone */
+#define GPT_CFG_32_BIT_TIMER         0x0
+#define GPT_CFG_32_BIT_WIDE_TIMER    0x4
+#define GPT_TAMR_ONE_SHOT            0x1
+#define GPT_TAMR_PERIODIC            0x2
+#define GPT_TAMR_COUNT_UP            0x10
+#define GPT_CTL_TAEN_MASK            0x00000001
+#define GPT_TATO_INTERRUPT_MASK      0x00000001
+
+#define GPT_INTERRUPT_PRIORITY_BITS_POS  5
+
+/* Hardware timer without a channel */
+#define GPT_NO_CHANNEL               (0xFFU)
+
+/* Address of a register of a hardware timer */
+#define GPT_REG_ADDRESS(TIMER, OFFSET)  (Gpt_HwTimer[(TIMER)].base_address + (OFFSET))
+
+/* Description: Run time state of a channel */
+typedef enum
+{
+    GPT_CH_STATE_INITIALIZED,
+    GPT_CH_STATE_RUNNING,
+    GPT_CH_STATE_STOPPED,
+    GPT_CH_STATE_EXPIRED
+}Gpt_ChannelStateType;
+
+/* Description: Registers and interrupt of a hardware timer */
+typedef struct
+{
+    uint32 base_address;
+    uint8 irq;
+}Gpt_HwTimerInfoType;
+
+/* Hardware timers in the order of Gpt_HwTimerType */
+static const Gpt_HwTimerInfoType Gpt_HwTimer[GPT_HW_TIMERS_NUM] = {
+    {GPT_TIMER0_BASE_ADDRESS, GPT_TIMER0A_IRQ_NUM},
+    {GPT_TIMER1_BASE_ADDRESS, GPT_TIMER1A_IRQ_NUM},
+    {GPT_TIMER2_BASE_ADDRESS, GPT_TIMER2A_IRQ_NUM},
+    {GPT_TIMER3_BASE_ADDRESS, GPT_TIMER3A_IRQ_NUM},
+    {GPT_TIMER4_BASE_ADDRESS, GPT_TIMER4A_IRQ_NUM},
+    {GPT_TIMER5_BASE_ADDRESS, GPT_TIMER5A_IRQ_NUM},
+    {GPT_WIDE_TIMER0_BASE_ADDRESS, GPT_WIDE_TIMER0A_IRQ_NUM},
+    {GPT_WIDE_TIMER1_BASE_ADDRESS, GPT_WIDE_TIMER1A_IRQ_NUM},
+    {GPT_WIDE_TIMER2_BASE_ADDRESS, GPT_WIDE_TIMER2A_IRQ_NUM},
+    {GPT_WIDE_TIMER3_BASE_ADDRESS, GPT_WIDE_TIMER3A_IRQ_NUM},
+    {GPT_WIDE_TIMER4_BASE_ADDRESS, GPT_WIDE_TIMER4A_IRQ_NUM},
+    {GPT_WIDE_TIMER5_BASE_ADDRESS, GPT_WIDE_TIMER5A_IRQ_NUM}
+};
+
+STATIC const Gpt_ConfigChannel * Gpt_Channels = NULL_PTR;
+STATIC uint8 Gpt_Status = GPT_NOT_INITIALIZED;
+
+/* Run time state and notification switch of every channel */
+STATIC volatile Gpt_ChannelStateType Gpt_ChannelState[GPT_CONFIGURED_CHANNELS];
+STATIC volatile boolean Gpt_NotificationEnabled[GPT_CONFIGURED_CHANNELS];
+
+/* Channel of every hardware timer used by its ISR, GPT_NO_CHANNEL for a free timer */
+STATIC Gpt_ChannelType Gpt_HwChannel[GPT_HW_TIMERS_NUM];
+
+/* Call back of every hardware timer lent to another driver by Gpt_SetHwTimerCallBack */
+STATIC Gpt_HwTimerCallBackType Gpt_HwTimerCallBack[GPT_HW_TIMERS_NUM];
+
+/*********************************************************************************************/
+static boolean Gpt_IsWideTimer(Gpt_HwTimerType Timer)
+{
+    return (boolean)(Timer >= GPT_WIDE_TIMER0);
+}
+
+/*********************************************************************************************/
+static void Gpt_EnableTimerClock(Gpt_HwTimerType Timer)
+{
+    if(Gpt_IsWideTimer(Timer))
+    {
+        REG_SET_BIT32(SYSCTL_RCGCWTIMER_ADDRESS, Timer - GPT_WIDE_TIMER0);
+        while(!REG_BIT_IS_SET32(SYSCTL_PRWTIMER_ADDRESS, Timer - GPT_WIDE_TIMER0)); /* Wait until the timer is ready */
+    }
+    else
+    {
+        REG_SET_BIT32(SYSCTL_RCGCTIMER_ADDRESS, Timer);
+        while(!REG_BIT_IS_SET32(SYSCTL_PRTIMER_ADDRESS, Timer));
+    }
+}
+
+/*********************************************************************************************/
+static void Gpt_DisableTimerClock(Gpt_HwTimerType Timer)
+{
+    if(Gpt_IsWideTimer(Timer))
+    {
+        REG_CLEAR_BIT32(SYSCTL_RCGCWTIMER_ADDRESS, Timer - GPT_WIDE_TIMER0);
+    }
+    else
+    {
+        REG_CLEAR_BIT32(SYSCTL_RCGCTIMER_ADDRESS, Timer);
+    }
+}
+
+/*********************************************************************************************/
+static Gpt_ChannelStateType Gpt_GetChannelState(Gpt_ChannelType Channel)
+{
+    /* The hardware clears the enable bit once a one-shot timer expires ... no interrupt is needed to see it */
+    if((Gpt_ChannelState[Channel] == GPT_CH_STATE_RUNNING) && (Gpt_Channels[Channel].mode == GPT_CH_MODE_ONESHOT) &&
+       !(REG_READ32(GPT_REG_ADDRESS(Gpt_Channels[Channel].timer, GPT_CTL_REG_OFFSET)) & GPT_CTL_TAEN_MASK))
+    {
+        Gpt_ChannelState[Channel] = GPT_CH_STATE_EXPIRED;
+    }
+    return Gpt_ChannelState[Channel];
+}
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+/*********************************************************************************************/
+static boolean Gpt_CheckChannel(Gpt_ChannelType Channel, uint8 ApiId)
+{
+    boolean error = FALSE;
+
+    /* Check if the Driver is initialized before using this function */
+    if(GPT_NOT_INITIALIZED == Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ApiId, GPT_E_UNINIT);
+        error = TRUE;
+    }
+    /* Check if the used channel is within the valid range */
+    else if(GPT_CONFIGURED_CHANNELS <= Channel)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ApiId, GPT_E_PARAM_CHANNEL);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return error;
+}
+#endif
+
+/*********************************************************************************************/
+static void Gpt_TimerIsr(Gpt_HwTimerType Timer)
+{
+    Gpt_ChannelType channel = Gpt_HwChannel[Timer];
+
+    if(Gpt_HwTimerCallBack[Timer] != NULL_PTR)
+    {
+        Gpt_HwTimerCallBack[Timer](Timer); /* The timer is used by another driver */
+        return;
+    }
+
+    REG_ACCESS_ISR_ENTER(GPT_MODULE_ID);
+    REG_WRITE32(GPT_REG_ADDRESS(Timer, GPT_ICR_REG_OFFSET), GPT_TATO_INTERRUPT_MASK); /* Clear the time-out flag */
+    REG_ACCESS_ISR_EXIT();
+
+    if(channel != GPT_NO_CHANNEL)
+    {
+        if(Gpt_Channels[channel].mode == GPT_CH_MODE_ONESHOT)
+        {
+            Gpt_ChannelState[channel] = GPT_CH_STATE_EXPIRED;
+        }
+        if(Gpt_NotificationEnabled[channel])
+        {
+            Gpt_Channels[channel].notification(); /* call the upper layer function using call-back concept */
+        }
+    }
+}
+
+/************************************************************************************
+* Service Name: Timer0A_Handler ... WideTimer5A_Handler
+* Description: Timer A ISR of every hardware timer
+************************************************************************************/
+void Timer0A_Handler(void)     { Gpt_TimerIsr(GPT_TIMER0); }
+void Timer1A_Handler(void)     { Gpt_TimerIsr(GPT_TIMER1); }
+void Timer2A_Handler(void)     { Gpt_TimerIsr(GPT_TIMER2); }
+void Timer3A_Handler(void)     { Gpt_TimerIsr(GPT_TIMER3); }
+void Timer4A_Handler(void)     { Gpt_TimerIsr(GPT_TIMER4); }
+void Timer5A_Handler(void)     { Gpt_TimerIsr(GPT_TIMER5); }
+void WideTimer0A_Handler(void) { Gpt_TimerIsr(GPT_WIDE_TIMER0); }
+void WideTimer1A_Handler(void) { Gpt_TimerIsr(GPT_WIDE_TIMER1); }
+void WideTimer2A_Handler(void) { Gpt_TimerIsr(GPT_WIDE_TIMER2); }
+void WideTimer3A_Handler(void) { Gpt_TimerIsr(GPT_WIDE_TIMER3); }
+void WideTimer4A_Handler(void) { Gpt_TimerIsr(GPT_WIDE_TIMER4); }
+#if (GPT_TIMESTAMP_API == STD_OFF)
+void WideTimer5A_Handler(void) { Gpt_TimerIsr(GPT_WIDE_TIMER5); }
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_Init
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Gpt Driver module:
+*              - Enable the clock of the timer of every channel
+*              - Setup the timer as a 32-bit down counter in the channel mode
+*              - Enable the timer interrupt, all the notifications start disabled
+************************************************************************************/
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr)
+{
+    Gpt_ChannelType channel;
+    Gpt_HwTimerType timer;
+    uint8 irq;
+
+    REG_ACCESS_API(GPT_MODULE_ID, GPT_INIT_SID);
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(GPT_INITIALIZED == Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_ALREADY_INITIALIZED);
+        return;
+    }
+    /* check if the input configuration pointer is not a NULL_PTR */
+    if(NULL_PTR == ConfigPtr)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_CONFIG);
+        return;
+    }
+#if (GPT_TIMESTAMP_API == STD_ON)
+    /* check if a channel uses the timer reserved for the timestamp or lent to another driver */
+    for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+    {
+        if((GPT_TIMESTAMP_TIMER == ConfigPtr->Channels[channel].timer) ||
+           (NULL_PTR != Gpt_HwTimerCallBack[ConfigPtr->Channels[channel].timer]))
+        {
+            Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_CONFIG);
+            return;
+        }
+    }
+#endif
+#endif
+
+    Gpt_Channels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+    for(timer = GPT_TIMER0; timer < GPT_HW_TIMERS_NUM; timer++)
+    {
+        Gpt_HwChannel[timer] = GPT_NO_CHANNEL;
+    }
+
+    for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+    {
+        timer = Gpt_Channels[channel].timer;
+        irq   = Gpt_HwTimer[timer].irq;
+
+        Gpt_EnableTimerClock(timer);
+        REG_WRITE32(GPT_REG_ADDRESS(timer, GPT_CTL_REG_OFFSET), 0); /* Disable the timer while it is configured */
+        REG_WRITE32(GPT_REG_ADDRESS(timer, GPT_CFG_REG_OFFSET), Gpt_IsWideTimer(timer) ? GPT_CFG_32_BIT_WIDE_TIMER : GPT_CFG_32_BIT_TIMER);
+        REG_WRITE32(GPT_REG_ADDRESS(timer, GPT_TAMR_REG_OFFSET), (Gpt_Channels[channel].mode == GPT_CH_MODE_ONESHOT) ?
+                                                                 GPT_TAMR_ONE_SHOT : GPT_TAMR_PERIODIC); /* Count down */
+        REG_WRITE32(GPT_REG_ADDRESS(timer, GPT_TAPR_REG_OFFSET), Gpt_IsWideTimer(timer) ? Gpt_Channels[channel].prescaler : 0);
+        REG_WRITE32(GPT_REG_ADDRESS(timer, GPT_IMR_REG_OFFSET), 0);
+        REG_WRITE32(GPT_REG_ADDRESS(timer, GPT_ICR_REG_OFFSET), GPT_TATO_INTERRUPT_MASK);
+
+        /* Assign the interrupt priority and enable the interrupt in the NVIC */
+        REG_WRITE8(NVIC_PRI0_ADDRESS + irq, (uint8)(GPT_INTERRUPT_PRIORITY << GPT_INTERRUPT_PRIORITY_BITS_POS));
+        REG_WRITE32(NVIC_EN0_ADDRESS + 4 * (irq / 32), 1UL << (irq % 32));
+
+        Gpt_HwChannel[timer]             = channel;
+        Gpt_ChannelState[channel]        = GPT_CH_STATE_INITIALIZED;
+        Gpt_NotificationEnabled[channel] = FALSE;
+    }
+
+    Gpt_Status = GPT_INITIALIZED;
+}
+
+/************************************************************************************
+* Service Name: Gpt_DeInit
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the timers and disable their interrupts and clocks.
+************************************************************************************/
+#if (GPT_DEINIT_API == STD_ON)
+void Gpt_DeInit(void)
+{
+    Gpt_ChannelType channel;
+    Gpt_HwTimerType timer;
+    uint8 irq;
+
+    REG_ACCESS_API(GPT_MODULE_ID, GPT_DEINIT_SID);
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if(GPT_NOT_INITIALIZED == Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEINIT_SID, GPT_E_UNINIT);
+        return;
+    }
+    for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+    {
+        if(GPT_CH_STATE_RUNNING == Gpt_GetChannelState(channel))
+        {
+            Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEINIT_SID, GPT_E_BUSY);
+            return;
+        }
+    }
+#endif
+
+    for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+    {
+        timer = Gpt_Channels[channel].timer;
+        irq   = Gpt_HwTimer[timer].irq;
+
+        REG_WRITE32(GPT_REG_ADDRESS(timer, GPT_CTL_REG_OFFSET), 0);
+        REG_WRITE32(GPT_REG_ADDRESS(timer, GPT_IMR_REG_OFFSET), 0);
+        REG_WRITE32(NVIC_DIS0_ADDRESS + 4 * (irq / 32), 1UL << (irq % 32));
+        Gpt_DisableTimerClock(timer);
+        Gpt_HwChannel[timer] = GPT_NO_CHANNEL;
+    }
+
+    Gpt_Status = GPT_NOT_INITIALIZED;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetTimeElapsed
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks since the channel was started or restarted,
+*                               the start value once a one-shot channel expired
+* Description: Function to read the time already elapsed.
+************************************************************************************/
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel)
+{
+    Gpt_ValueType elapsed = 0;
+    Gpt_HwTimerType timer;
+
+    REG_ACCESS_API(GPT_MODULE_ID, GPT_GET_TIME_ELAPSED_SID);
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(Gpt_CheckChannel(Channel, GPT_GET_TIME_ELAPSED_SID))
+    {
+        return 0;
+    }
+#endif
+    timer = Gpt_Channels[Channel].timer;
+
+    switch(Gpt_GetChannelState(Channel))
+    {
+    case GPT_CH_STATE_RUNNING:
+    case GPT_CH_STATE_STOPPED:
+        /* The counter runs down from the start value - 1 to 0 */
+        elapsed = REG_READ32(GPT_REG_ADDRESS(timer, GPT_TAILR_REG_OFFSET)) - REG_READ32(GPT_REG_ADDRESS(timer, GPT_TAV_REG_OFFSET));
+        break;
+    case GPT_CH_STATE_EXPIRED:
+        elapsed = REG_READ32(GPT_REG_ADDRESS(timer, GPT_TAILR_REG_OFFSET)) + 1;
+        break;
+    default:
+        /* Channel not started yet */
+        break;
+    }
+    return elapsed;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetTimeRemaining
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks to the next expiry, 0 once a one-shot channel expired
+* Description: Function to read the time remaining until the target time is reached.
+************************************************************************************/
+#if (GPT_TIME_REMAINING_API == STD_ON)
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel)
+{
+    Gpt_ValueType remaining = 0;
+    Gpt_ChannelStateType state;
+
+    REG_ACCESS_API(GPT_MODULE_ID, GPT_GET_TIME_REMAINING_SID);
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(Gpt_CheckChannel(Channel, GPT_GET_TIME_REMAINING_SID))
+    {
+        return 0;
+    }
+#endif
+    state = Gpt_GetChannelState(Channel);
+
+    if((GPT_CH_STATE_RUNNING == state) || (GPT_CH_STATE_STOPPED == state))
+    {
+        remaining = REG_READ32(GPT_REG_ADDRESS(Gpt_Channels[Channel].timer, GPT_TAV_REG_OFFSET)) + 1;
+    }
+    return remaining;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_StartTimer
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+*                  Value - Target time in ticks, from 1 to 0xFFFFFFFF
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start a timer channel.
+************************************************************************************/
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value)
+{
+    Gpt_HwTimerType timer;
+
+    REG_ACCESS_API(GPT_MODULE_ID, GPT_START_TIMER_SID);
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(Gpt_CheckChannel(Channel, GPT_START_TIMER_SID))
+    {
+        return;
+    }
+    if(0 == Value)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_PARAM_VALUE);
+        return;
+    }
+    if(GPT_CH_STATE_RUNNING == Gpt_GetChannelState(Channel))
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_BUSY);
+        return;
+    }
+#endif
+    timer = Gpt_Channels[Channel].timer;
+
+    REG_CLEAR_MASK32(GPT_REG_ADDRESS(timer, GPT_CTL_REG_OFFSET), GPT_CTL_TAEN_MASK);
+    REG_WRITE32(GPT_REG_ADDRESS(timer, GPT_TAILR_REG_OFFSET), Value - 1); /* Time-out once the counter reaches 0 */
+    REG_WRITE32(GPT_REG_ADDRESS(timer, GPT_ICR_REG_OFFSET), GPT_TATO_INTERRUPT_MASK);
+    Gpt_ChannelState[Channel] = GPT_CH_STATE_RUNNING;
+    REG_SET_MASK32(GPT_REG_ADDRESS(timer, GPT_CTL_REG_OFFSET), GPT_CTL_TAEN_MASK);
+}
+
+/************************************************************************************
+* Service Name: Gpt_StopTimer
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a timer channel.
+************************************************************************************/
+void Gpt_StopTimer(Gpt_ChannelType Channel)
+{
+    REG_ACCESS_API(GPT_MODULE_ID, GPT_STOP_TIMER_SID);
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(Gpt_CheckChannel(Channel, GPT_STOP_TIMER_SID))
+    {
+        return;
+    }
+#endif
+    /* Nothing happens in case the channel is not running */
+    if(GPT_CH_STATE_RUNNING == Gpt_GetChannelState(Channel))
+    {
+        REG_CLEAR_MASK32(GPT_REG_ADDRESS(Gpt_Channels[Channel].timer, GPT_CTL_REG_OFFSET), GPT_CTL_TAEN_MASK);
+        Gpt_ChannelState[Channel] = GPT_CH_STATE_STOPPED;
+    }
+}
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/*********************************************************************************************/
+static void Gpt_SetNotification(Gpt_ChannelType Channel, boolean Enable, uint8 ApiId)
+{
+    Gpt_HwTimerType timer;
+
+    REG_ACCESS_API(GPT_MODULE_ID, ApiId);
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(Gpt_CheckChannel(Channel, ApiId))
+    {
+        return;
+    }
+    /* Check if the channel has a notification function */
+    if(NULL_PTR == Gpt_Channels[Channel].notification)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ApiId, GPT_E_PARAM_CHANNEL);
+        return;
+    }
+#else
+    (void)ApiId;
+#endif
+    timer = Gpt_Channels[Channel].timer;
+
+    Gpt_NotificationEnabled[Channel] = Enable;
+    if(Enable)
+    {
+        REG_SET_MASK32(GPT_REG_ADDRESS(timer, GPT_IMR_REG_OFFSET), GPT_TATO_INTERRUPT_MASK);
+    }
+    else
+    {
+        REG_CLEAR_MASK32(GPT_REG_ADDRESS(timer, GPT_IMR_REG_OFFSET), GPT_TATO_INTERRUPT_MASK);
+    }
+}
+
+/************************************************************************************
+* Service Name: Gpt_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the notification of a channel.
+************************************************************************************/
+void Gpt_EnableNotification(Gpt_ChannelType Channel)
+{
+    Gpt_SetNotification(Channel, TRUE, GPT_ENABLE_NOTIFICATION_SID);
+}
+
+/************************************************************************************
+* Service Name: Gpt_DisableNotification
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the notification of a channel.
+************************************************************************************/
+void Gpt_DisableNotification(Gpt_ChannelType Channel)
+{
+    Gpt_SetNotification(Channel, FALSE, GPT_DISABLE_NOTIFICATION_SID);
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetVersionInfo
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (GPT_VERSION_INFO_API == STD_ON)
+void Gpt_GetVersionInfo(Std_VersionInfoType * versioninfo)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if input pointer is not Null pointer */
+    if(NULL_PTR == versioninfo)
+    {
+        /* Report to DET  */
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID,
+                GPT_GET_VERSION_INFO_SID, GPT_E_PARAM_POINTER);
+    }
+    else
+#endif /* (GPT_DEV_ERROR_DETECT == STD_ON) */
+    {
+        /* Copy the vendor Id */
+        versioninfo->vendorID = (uint16)GPT_VENDOR_ID;
+        /* Copy the module Id */
+        versioninfo->moduleID = (uint16)GPT_MODULE_ID;
+        /* Copy Software Major Version */
+        versioninfo->sw_major_version = (uint8)GPT_SW_MAJOR_VERSION;
+        /* Copy Software Minor Version */
+        versioninfo->sw_minor_version = (uint8)GPT_SW_MINOR_VERSION;
+        /* Copy Software Patch Version */
+        versioninfo->sw_patch_version = (uint8)GPT_SW_PATCH_VERSION;
+    }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_SetHwTimerCallBack
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Timer - Hardware timer not used by a Gpt channel nor by the timestamp
+*                  Ptr2Func - Function called by the Timer A ISR of the timer, NULL_PTR to remove it
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the call back is set
+*                                E_NOT_OK: invalid timer or timer owned by the Gpt driver
+* Description: Function to lend a hardware timer to another driver.
+************************************************************************************/
+Std_ReturnType Gpt_SetHwTimerCallBack(Gpt_HwTimerType Timer, Gpt_HwTimerCallBackType Ptr2Func)
+{
+    if(Timer >= GPT_HW_TIMERS_NUM)
+    {
+        return E_NOT_OK;
+    }
+#if (GPT_TIMESTAMP_API == STD_ON)
+    if(GPT_TIMESTAMP_TIMER == Timer)
+    {
+        return E_NOT_OK;
+    }
+#endif
+    if((GPT_INITIALIZED == Gpt_Status) && (GPT_NO_CHANNEL != Gpt_HwChannel[Timer]))
+    {
+        return E_NOT_OK;
+    }
+    Gpt_HwTimerCallBack[Timer] = Ptr2Func;
+    if(NULL_PTR != Ptr2Func)
+    {
+        Gpt_EnableTimerClock(Timer);
+        REG_WRITE8(NVIC_PRI0_ADDRESS + Gpt_HwTimer[Timer].irq, (uint8)(GPT_INTERRUPT_PRIORITY << GPT_INTERRUPT_PRIORITY_BITS_POS));
+        REG_WRITE32(NVIC_EN0_ADDRESS + 4 * (Gpt_HwTimer[Timer].irq / 32), 1UL << (Gpt_HwTimer[Timer].irq % 32));
+    }
+    else
+    {
+        REG_WRITE32(NVIC_DIS0_ADDRESS + 4 * (Gpt_HwTimer[Timer].irq / 32), 1UL << (Gpt_HwTimer[Timer].irq % 32));
+    }
+    return E_OK;
+}
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+/*******************************************************************************
+ *                      Timestamp Service                                      *
+ *******************************************************************************/
+
+/* Wraps of the timestamp counter */
+volatile uint32 g_Gpt_Timestamp_High = 0;
+
+/************************************************************************************
+* Service Name: WideTimer5A_Handler
+* Description: Timestamp overflow ISR, counts a wrap of the timestamp counter
+************************************************************************************/
+void WideTimer5A_Handler(void)
+{
+    /* A higher priority reader shall see either the pending flag or the new high word, never both */
+    Cpu_StateType state = Cpu_EnterCritical();
+
+    REG_ACCESS_ISR_ENTER(GPT_MODULE_ID);
+    REG_WRITE32(GPT_REG_ADDRESS(GPT_TIMESTAMP_TIMER, GPT_ICR_REG_OFFSET), GPT_TATO_INTERRUPT_MASK);
+    (void)REG_READ32(GPT_REG_ADDRESS(GPT_TIMESTAMP_TIMER, GPT_RIS_REG_OFFSET)); /* Wait until the flag is cleared on the peripheral bus */
+    REG_ACCESS_ISR_EXIT();
+    g_Gpt_Timestamp_High++;
+
+    Cpu_ExitCritical(state);
+}
+
+/************************************************************************************
+* Service Name: Gpt_TimestampInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the timestamp from 0.
+************************************************************************************/
+void Gpt_TimestampInit(void)
+{
+    uint8 irq = Gpt_HwTimer[GPT_TIMESTAMP_TIMER].irq;
+
+    REG_ACCESS_API(GPT_MODULE_ID, GPT_TIMESTAMP_INIT_SID);
+
+    Gpt_EnableTimerClock(GPT_TIMESTAMP_TIMER);
+    REG_WRITE32(GPT_REG_ADDRESS(GPT_TIMESTAMP_TIMER, GPT_CTL_REG_OFFSET), 0);
+    REG_WRITE32(GPT_REG_ADDRESS(GPT_TIMESTAMP_TIMER, GPT_CFG_REG_OFFSET), GPT_CFG_32_BIT_WIDE_TIMER);
+    REG_WRITE32(GPT_REG_ADDRESS(GPT_TIMESTAMP_TIMER, GPT_TAMR_REG_OFFSET), GPT_TAMR_PERIODIC | GPT_TAMR_COUNT_UP);
+    REG_WRITE32(GPT_REG_ADDRESS(GPT_TIMESTAMP_TIMER, GPT_TAPR_REG_OFFSET), 0);
+    REG_WRITE32(GPT_REG_ADDRESS(GPT_TIMESTAMP_TIMER, GPT_TAILR_REG_OFFSET), 0xFFFFFFFF); /* Count the full 32-bit range */
+    REG_WRITE32(GPT_REG_ADDRESS(GPT_TIMESTAMP_TIMER, GPT_ICR_REG_OFFSET), GPT_TATO_INTERRUPT_MASK);
+    REG_WRITE32(GPT_REG_ADDRESS(GPT_TIMESTAMP_TIMER, GPT_IMR_REG_OFFSET), GPT_TATO_INTERRUPT_MASK);
+    g_Gpt_Timestamp_High = 0;
+
+    REG_WRITE8(NVIC_PRI0_ADDRESS + irq, (uint8)(GPT_TIMESTAMP_INTERRUPT_PRIORITY << GPT_INTERRUPT_PRIORITY_BITS_POS));
+    REG_WRITE32(NVIC_EN0_ADDRESS + 4 * (irq / 32), 1UL << (irq % 32));
+
+    REG_SET_MASK32(GPT_REG_ADDRESS(GPT_TIMESTAMP_TIMER, GPT_CTL_REG_OFFSET), GPT_CTL_TAEN_MASK);
+}
+#endif
@@ -4,7 +4,7 @@
  *
  * File Name: Gpt.h
  *
- * Description: Header file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver.
  *
  * Author: Mohamed Tarek
  ******************************************************************************/
@@ -12,8 +12,179 @@
 #ifndef GPT_H
 #define GPT_H
 
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define GPT_VENDOR_ID    (1000U)
+
+/* Gpt Module Id */
+#define GPT_MODULE_ID    (100U)
+
+/* Gpt Instance Id */
+#define GPT_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_SW_MAJOR_VERSION           (1U)
+#define GPT_SW_MINOR_VERSION           (0U)
+#define GPT_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_AR_RELEASE_MAJOR_VERSION   (4U)
+#define GPT_AR_RELEASE_MINOR_VERSION   (0U)
+#define GPT_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Gpt Status
+ */
+#define GPT_INITIALIZED                (1U)
+#define GPT_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
 #include "Std_Types.h"
 
+/* AUTOSAR checking between Std Types and Gpt Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Gpt Pre-Compile Configuration Header file */
+#include "Gpt_Cfg.h"
+
+/* AUTOSAR Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_SW_MAJOR_VERSION != GPT_SW_MAJOR_VERSION)\
+ ||  (GPT_CFG_SW_MINOR_VERSION != GPT_SW_MINOR_VERSION)\
+ ||  (GPT_CFG_SW_PATCH_VERSION != GPT_SW_PATCH_VERSION))
+  #error "The SW version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Gpt_GetVersionInfo */
+#define GPT_GET_VERSION_INFO_SID            ((uint8)0x00)
+
+/* Service ID for Gpt_Init */
+#define GPT_INIT_SID                        ((uint8)0x01)
+
+/* Service ID for Gpt_DeInit */
+#define GPT_DEINIT_SID                      ((uint8)0x02)
+
+/* Service ID for Gpt_GetTimeElapsed */
+#define GPT_GET_TIME_ELAPSED_SID            ((uint8)0x03)
+
+/* Service ID for Gpt_GetTimeRemaining */
+#define GPT_GET_TIME_REMAINING_SID          ((uint8)0x04)
+
+/* Service ID for Gpt_StartTimer */
+#define GPT_START_TIMER_SID                 ((uint8)0x05)
+
+/* Service ID for Gpt_StopTimer */
+#define GPT_STOP_TIMER_SID                  ((uint8)0x06)
+
+/* Service ID for Gpt_EnableNotification */
+#define GPT_ENABLE_NOTIFICATION_SID         ((uint8)0x07)
+
+/* Service ID for Gpt_DisableNotification */
+#define GPT_DISABLE_NOTIFICATION_SID        ((uint8)0x08)
+
+/* Ids of the SysTick and timestamp services, not reported to Det, for the register access statistics */
+#define SYSTICK_START_SID                   ((uint8)0x20)
+#define SYSTICK_STOP_SID                    ((uint8)0x21)
+#define SYSTICK_GET_CURRENT_VALUE_SID       ((uint8)0x22)
+#define SYSTICK_GET_RELOAD_VALUE_SID        ((uint8)0x23)
+#define GPT_TIMESTAMP_INIT_SID              ((uint8)0x24)
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API service called without module initialization */
+#define GPT_E_UNINIT                        ((uint8)0x0A)
+
+/* API Gpt_StartTimer called while the timer is running */
+#define GPT_E_BUSY                          ((uint8)0x0B)
+
+/* API Gpt_Init called while the module is already initialized */
+#define GPT_E_ALREADY_INITIALIZED           ((uint8)0x0D)
+
+/* API Gpt_Init service called with wrong parameter */
+#define GPT_E_PARAM_CONFIG                  ((uint8)0x0E)
+
+/* API service called with an invalid channel or a channel without notification */
+#define GPT_E_PARAM_CHANNEL                 ((uint8)0x14)
+
+/* API Gpt_StartTimer called with a zero value */
+#define GPT_E_PARAM_VALUE                   ((uint8)0x15)
+
+/* APIs called with a Null Pointer */
+#define GPT_E_PARAM_POINTER                 ((uint8)0x16)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Type definition for the functions called by the SysTick ISR */
+typedef void (*SysTick_CallBackType)(void);
+
+/* Description: Numeric ID of a Gpt channel */
+typedef uint8 Gpt_ChannelType;
+
+/* Description: Time in ticks of the channel, system clock / (prescaler + 1) */
+typedef uint32 Gpt_ValueType;
+
+/* Description: Function called by the timer ISR once the channel expires */
+typedef void (*Gpt_NotificationType)(void);
+
+/* Description: Hardware timer of a channel, its Timer A counts as one 32-bit timer */
+typedef enum
+{
+    GPT_TIMER0, GPT_TIMER1, GPT_TIMER2, GPT_TIMER3, GPT_TIMER4, GPT_TIMER5,
+    GPT_WIDE_TIMER0, GPT_WIDE_TIMER1, GPT_WIDE_TIMER2, GPT_WIDE_TIMER3, GPT_WIDE_TIMER4, GPT_WIDE_TIMER5
+}Gpt_HwTimerType;
+
+/* Number of the hardware timers */
+#define GPT_HW_TIMERS_NUM              (12U)
+
+/* Description: Function called by the Timer A ISR of a hardware timer lent to another driver */
+typedef void (*Gpt_HwTimerCallBackType)(Gpt_HwTimerType Timer);
+
+/* Description: Behaviour of a channel once it expires */
+typedef enum
+{
+    GPT_CH_MODE_CONTINUOUS,    /* Restart with the same value */
+    GPT_CH_MODE_ONESHOT        /* Stop */
+}Gpt_ChannelModeType;
+
+/* Description: Structure to configure each individual channel:
+ *	1. the hardware timer
+ *	2. the channel mode --> continuous or one-shot
+ *	3. the clock divider minus 1, only the wide timers have a prescaler (16-bit), 0 for the 16/32-bit timers
+ *	4. the notification function, NULL_PTR for none
+ */
+typedef struct
+{
+    Gpt_HwTimerType timer;
+    Gpt_ChannelModeType mode;
+    uint16 prescaler;
+    Gpt_NotificationType notification;
+}Gpt_ConfigChannel;
+
+/* Array of Gpt_ConfigChannel */
+typedef struct
+{
+    Gpt_ConfigChannel Channels[GPT_CONFIGURED_CHANNELS];
+}Gpt_ConfigType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -28,7 +199,8 @@
 * Return value: None
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
 *              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Enable SysTick Timer with the System clock of Mcu_GetSysClockFrequency,
+*                up to 209 miliseconds at 80Mhz (24-bit reload value)
 *              - Enable SysTick Timer Interrupt and set its priority
 ************************************************************************************/	
 void SysTick_Start(uint16 Tick_Time);
@@ -53,8 +225,219 @@ void SysTick_Stop(void);
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the SysTick Timer call back
+* Description: Function to Setup the SysTick Timer call back, called every tick
+*              from the entry of the subscriber table reserved for it.
 ************************************************************************************/
 void SysTick_SetCallBack(void (*Ptr2Func)(void));
 
+/************************************************************************************
+* Service Name: SysTick_Subscribe
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Ptr2Func - Call Back function address
+*                  Divisor - Call the function every Divisor ticks, at least 1
+*                  Phase - Ticks before the first call minus 1, less than Divisor
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK: invalid parameter or no free entry in the table
+* Description: Function to add a call back to the SysTick subscriber table, the
+*              subscribers with the same Divisor and different Phase values are called
+*              in different ticks.
+************************************************************************************/
+Std_ReturnType SysTick_Subscribe(SysTick_CallBackType Ptr2Func, uint16 Divisor, uint16 Phase);
+
+/************************************************************************************
+* Service Name: SysTick_Unsubscribe
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Ptr2Func - Call Back function address
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK: the function is not subscribed
+* Description: Function to remove a call back added by SysTick_Subscribe.
+************************************************************************************/
+Std_ReturnType SysTick_Unsubscribe(SysTick_CallBackType Ptr2Func);
+
+/************************************************************************************
+* Service Name: SysTick_GetCurrentValue
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current value of the SysTick down counter
+* Description: Function to read the SysTick Timer counter, it counts down from the
+*              reload value to zero every tick.
+************************************************************************************/
+uint32 SysTick_GetCurrentValue(void);
+
+/************************************************************************************
+* Service Name: SysTick_GetReloadValue
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Reload value of the SysTick Timer
+* Description: Function to read the SysTick Timer reload value, one tick lasts
+*              (reload value + 1) System clock cycles.
+************************************************************************************/
+uint32 SysTick_GetReloadValue(void);
+
+/************************************************************************************
+* Service Name: Gpt_Init
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to configuration set
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Gpt Driver module:
+*              - Enable the clock of the timer of every channel
+*              - Setup the timer as a 32-bit down counter in the channel mode
+*              - Enable the timer interrupt, all the notifications start disabled
+************************************************************************************/
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr);
+
+/************************************************************************************
+* Service Name: Gpt_DeInit
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the timers and disable their interrupts and clocks.
+************************************************************************************/
+#if (GPT_DEINIT_API == STD_ON)
+void Gpt_DeInit(void);
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetTimeElapsed
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks since the channel was started or restarted,
+*                               the start value once a one-shot channel expired
+* Description: Function to read the time already elapsed.
+************************************************************************************/
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel);
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetTimeRemaining
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks to the next expiry, 0 once a one-shot channel expired
+* Description: Function to read the time remaining until the target time is reached.
+************************************************************************************/
+#if (GPT_TIME_REMAINING_API == STD_ON)
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel);
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_StartTimer
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+*                  Value - Target time in ticks, from 1 to 0xFFFFFFFF
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start a timer channel.
+************************************************************************************/
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value);
+
+/************************************************************************************
+* Service Name: Gpt_StopTimer
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a timer channel.
+************************************************************************************/
+void Gpt_StopTimer(Gpt_ChannelType Channel);
+
+/************************************************************************************
+* Service Name: Gpt_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the notification of a channel.
+************************************************************************************/
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+void Gpt_EnableNotification(Gpt_ChannelType Channel);
+
+/************************************************************************************
+* Service Name: Gpt_DisableNotification
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the notification of a channel.
+************************************************************************************/
+void Gpt_DisableNotification(Gpt_ChannelType Channel);
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetVersionInfo
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (GPT_VERSION_INFO_API == STD_ON)
+void Gpt_GetVersionInfo(Std_VersionInfoType * versioninfo);
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_SetHwTimerCallBack
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Timer - Hardware timer not used by a Gpt channel nor by the timestamp
+*                  Ptr2Func - Function called by the Timer A ISR of the timer, NULL_PTR to remove it
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the call back is set
+*                                E_NOT_OK: invalid timer or timer owned by the Gpt driver
+* Description: Function to lend a hardware timer to another driver (e.g. Icu):
+*              - Enable the clock of the timer
+*              - Enable its interrupt with the priority of the Gpt timers
+*              The call back handles the interrupt and clears its flags.
+************************************************************************************/
+Std_ReturnType Gpt_SetHwTimerCallBack(Gpt_HwTimerType Timer, Gpt_HwTimerCallBackType Ptr2Func);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Post build structure used with Gpt_Init API */
+extern const Gpt_ConfigType Gpt_Configuration;
+
 #endif /* GPT_H */
@@ -0,0 +1,73 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Gpt Driver.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef GPT_CFG_H
+#define GPT_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_CFG_SW_MAJOR_VERSION              (1U)
+#define GPT_CFG_SW_MINOR_VERSION              (0U)
+#define GPT_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define GPT_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define GPT_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define GPT_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define GPT_VERSION_INFO_API                (STD_OFF)
+
+/* Pre-compile option for presence of Gpt_DeInit API */
+#define GPT_DEINIT_API                      (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeElapsed API */
+#define GPT_TIME_ELAPSED_API                (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeRemaining API */
+#define GPT_TIME_REMAINING_API              (STD_ON)
+
+/* Pre-compile option for presence of Gpt_EnableNotification and Gpt_DisableNotification APIs */
+#define GPT_ENABLE_DISABLE_NOTIFICATION_API (STD_ON)
+
+/* Pre-compile option for the 64-bit timestamp of Gpt_Timestamp.h, it reserves WideTimer5 */
+#define GPT_TIMESTAMP_API                   (STD_ON)
+
+/* Priority of the timestamp overflow interrupt, the highest so a wrap is counted before most readers run */
+#define GPT_TIMESTAMP_INTERRUPT_PRIORITY    (0U)
+
+/* Priority of the timer interrupts, above the SysTick one (3) */
+#define GPT_INTERRUPT_PRIORITY              (2U)
+
+/* Number of the configured Gpt Channels */
+#define GPT_CONFIGURED_CHANNELS             (2U)
+
+/* Channel Index in the array of structures in Gpt_PBcfg.c */
+#define GptConf_IO_TIMER_CHANNEL_ID         (Gpt_ChannelType)0
+#define GptConf_HEARTBEAT_CHANNEL_ID        (Gpt_ChannelType)1
+
+/* Hardware timer of every channel, its number in Gpt_HwTimerType ... the preprocessor checks the reserved timers */
+#define GptConf_IO_TIMER_HW_TIMER           (0U)    /* GPT_TIMER0 */
+#define GptConf_HEARTBEAT_HW_TIMER          (1U)    /* GPT_TIMER1 */
+
+/*
+ * Number of the entries of the SysTick subscriber table, including the one
+ * reserved for SysTick_SetCallBack ... the SysTick ISR checks every entry
+ */
+#define SYSTICK_SUBSCRIBERS_NUM             (4U)
+
+#endif /* GPT_CFG_H */
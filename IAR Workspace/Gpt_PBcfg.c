@@ -0,0 +1,63 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Gpt Driver
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "Gpt.h"
+#include "Gpt_Timestamp.h"
+#include "App.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_PBCFG_SW_MAJOR_VERSION              (1U)
+#define GPT_PBCFG_SW_MINOR_VERSION              (0U)
+#define GPT_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define GPT_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define GPT_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Gpt_PBcfg.c and Gpt.h files */
+#if ((GPT_PBCFG_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (GPT_PBCFG_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (GPT_PBCFG_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Gpt_PBcfg.c and Gpt.h files */
+#if ((GPT_PBCFG_SW_MAJOR_VERSION != GPT_SW_MAJOR_VERSION)\
+ ||  (GPT_PBCFG_SW_MINOR_VERSION != GPT_SW_MINOR_VERSION)\
+ ||  (GPT_PBCFG_SW_PATCH_VERSION != GPT_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* Every channel owns its hardware timer */
+#if (GptConf_IO_TIMER_HW_TIMER == GptConf_HEARTBEAT_HW_TIMER)
+  #error "Two Gpt channels use the same hardware timer"
+#endif
+
+/* The timestamp timer counts from the startup ... a channel on it would stop it */
+#if ((GPT_TIMESTAMP_API == STD_ON) && ((GptConf_IO_TIMER_HW_TIMER == GPT_TIMESTAMP_HW_TIMER)\
+ ||  (GptConf_HEARTBEAT_HW_TIMER == GPT_TIMESTAMP_HW_TIMER)))
+  #error "A Gpt channel uses the hardware timer reserved for the timestamp"
+#endif
+
+/* PB structure used with Gpt_Init API ... WideTimer5 is reserved for the timestamp when GPT_TIMESTAMP_API is enabled */
+const Gpt_ConfigType Gpt_Configuration = {
+    {
+        /* System clock ticks (12.5 ns at 80 MHz) for the sub-millisecond timing of the I/O drivers */
+        {(Gpt_HwTimerType)GptConf_IO_TIMER_HW_TIMER, GPT_CH_MODE_ONESHOT, 0, NULL_PTR},
+        /* Continuous 1 s period counting the uptime of the application */
+        {(Gpt_HwTimerType)GptConf_HEARTBEAT_HW_TIMER, GPT_CH_MODE_CONTINUOUS, 0, App_HeartbeatNotification}
+    }
+};
@@ -0,0 +1,81 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver Registers
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef GPT_REGS_H_
+#define GPT_REGS_H_
+
+#include "Std_Types.h"
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* 16/32-bit Timers Registers base addresses */
+#define GPT_TIMER0_BASE_ADDRESS           0x40030000
+#define GPT_TIMER1_BASE_ADDRESS           0x40031000
+#define GPT_TIMER2_BASE_ADDRESS           0x40032000
+#define GPT_TIMER3_BASE_ADDRESS           0x40033000
+#define GPT_TIMER4_BASE_ADDRESS           0x40034000
+#define GPT_TIMER5_BASE_ADDRESS           0x40035000
+
+/* 32/64-bit Wide Timers Registers base addresses */
+#define GPT_WIDE_TIMER0_BASE_ADDRESS      0x40036000
+#define GPT_WIDE_TIMER1_BASE_ADDRESS      0x40037000
+#define GPT_WIDE_TIMER2_BASE_ADDRESS      0x4004C000
+#define GPT_WIDE_TIMER3_BASE_ADDRESS      0x4004D000
+#define GPT_WIDE_TIMER4_BASE_ADDRESS      0x4004E000
+#define GPT_WIDE_TIMER5_BASE_ADDRESS      0x4004F000
+
+/* Timers Registers offset addresses */
+#define GPT_CFG_REG_OFFSET                0x000
+#define GPT_TAMR_REG_OFFSET               0x004
+#define GPT_CTL_REG_OFFSET                0x00C
+#define GPT_IMR_REG_OFFSET                0x018
+#define GPT_RIS_REG_OFFSET                0x01C
+#define GPT_MIS_REG_OFFSET                0x020
+#define GPT_ICR_REG_OFFSET                0x024
+#define GPT_TAILR_REG_OFFSET              0x028
+#define GPT_TAPR_REG_OFFSET               0x038
+#define GPT_TAR_REG_OFFSET                0x048
+#define GPT_TAV_REG_OFFSET                0x050
+
+/* Interrupt numbers of the Timer A of each timer */
+#define GPT_TIMER0A_IRQ_NUM               19
+#define GPT_TIMER1A_IRQ_NUM               21
+#define GPT_TIMER2A_IRQ_NUM               23
+#define GPT_TIMER3A_IRQ_NUM               35
+#define GPT_TIMER4A_IRQ_NUM               70
+#define GPT_TIMER5A_IRQ_NUM               92
+#define GPT_WIDE_TIMER0A_IRQ_NUM          94
+#define GPT_WIDE_TIMER1A_IRQ_NUM          96
+#define GPT_WIDE_TIMER2A_IRQ_NUM          98
+#define GPT_WIDE_TIMER3A_IRQ_NUM          100
+#define GPT_WIDE_TIMER4A_IRQ_NUM          102
+#define GPT_WIDE_TIMER5A_IRQ_NUM          104
+
+/* Clock gating registers addresses of the timers in the System Control */
+#define SYSCTL_RCGCTIMER_ADDRESS          0x400FE604
+#define SYSCTL_RCGCWTIMER_ADDRESS         0x400FE65C
+#define SYSCTL_PRTIMER_ADDRESS            0x400FEA04
+#define SYSCTL_PRWTIMER_ADDRESS           0x400FEA5C
+
+/* SysTick Timer registers addresses */
+#define SYSTICK_CTRL_ADDRESS              0xE000E010
+#define SYSTICK_RELOAD_ADDRESS            0xE000E014
+#define SYSTICK_CURRENT_ADDRESS           0xE000E018
+
+/* NVIC registers addresses ... one bit per IRQ in the EN and DIS registers, one byte per IRQ in the PRI registers */
+#define NVIC_EN0_ADDRESS                  0xE000E100
+#define NVIC_DIS0_ADDRESS                 0xE000E180
+#define NVIC_PRI0_ADDRESS                 0xE000E400
+#define NVIC_SYSTEM_PRI3_ADDRESS          0xE000ED20
+
+#endif /* GPT_REGS_H_ */
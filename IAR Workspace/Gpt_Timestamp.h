@@ -0,0 +1,211 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Timestamp.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Timestamp Service.
+ *
+ *              WideTimer5 Timer A counts up the core clock cycles from 0 to 0xFFFFFFFF,
+ *              its time-out interrupt counts the wraps in the high 32 bits so the
+ *              timestamp is a 64-bit monotonic count of core clock cycles (12.5 ns
+ *              at 80 MHz) which wraps after 7311 years at 80 MHz, its conversion
+ *              to ns fits 64 bits for 584 years.
+ *
+ *              A read costs three loads and no critical section: the high word is read
+ *              again after the counter and the sequence is retried if the ISR ran in
+ *              between. A wrap not counted yet (read with the interrupts masked or from
+ *              a higher priority ISR) is found by the raw interrupt status, as long as
+ *              the overflow ISR is not held off for half a wrap (26 s at 80 MHz).
+ *
+ *              The busy-waits poll the same counter so their length does not depend on
+ *              the optimization level or the flash wait states. A bit-banged protocol
+ *              keeps its edges on a fixed grid by moving a deadline instead of delaying:
+ *
+ *                  uint32 deadline = Gpt_GetTicks32();
+ *                  for(bit = 0; bit < 8; bit++)
+ *                  {
+ *                      Dio_WriteChannel(DioConf_SCL_CHANNEL_ID_INDEX, STD_LOW);
+ *                      deadline += GPT_US_TO_TICKS(5);
+ *                      Gpt_WaitUntil(deadline);
+ *                      ...
+ *                  }
+ *
+ *              Host builds (HOST_BUILD defined) read the counter of Gpt_Sim.c instead.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef GPT_TIMESTAMP_H_
+#define GPT_TIMESTAMP_H_
+
+#include "Gpt.h"
+#include "Mcu_Cfg.h"
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Hardware timer reserved for the timestamp, it shall not be used by a channel in Gpt_PBcfg.c nor by the Icu */
+#define GPT_TIMESTAMP_HW_TIMER              (11U)   /* GPT_WIDE_TIMER5, its number for the preprocessor */
+#define GPT_TIMESTAMP_TIMER                 ((Gpt_HwTimerType)GPT_TIMESTAMP_HW_TIMER)
+
+/* Frequency of the timestamp in Hz ... the timer counts the core clock without prescaler */
+#define GPT_TIMESTAMP_FREQUENCY             (McuConf_CORE_CLOCK_FREQUENCY)
+
+#if ((GPT_TIMESTAMP_FREQUENCY % 1000000U) != 0)
+  #error "The timestamp conversions need a core clock frequency multiple of 1 MHz"
+#endif
+
+/* Timestamp ticks in 1 us */
+#define GPT_TIMESTAMP_TICKS_PER_US          (GPT_TIMESTAMP_FREQUENCY / 1000000U)
+
+/* Convert a constant time to timestamp ticks for the deadlines of Gpt_WaitUntil, a time in ns is rounded up */
+#define GPT_US_TO_TICKS(US)                 ((uint32)(US) * GPT_TIMESTAMP_TICKS_PER_US)
+#define GPT_NS_TO_TICKS(NS)                 ((((uint32)(NS) * GPT_TIMESTAMP_TICKS_PER_US) + 999U) / 1000U)
+
+/* Longest busy-wait in us ... Gpt_WaitUntil compares the 32-bit ticks as a signed difference */
+#define GPT_DELAY_MAX_US                    (0x7FFFFFFFU / GPT_TIMESTAMP_TICKS_PER_US)
+
+#define GPT_TIMESTAMP_OVERFLOW_MASK         0x00000001
+
+#ifdef HOST_BUILD
+
+/* Description: Read the simulated counter and the simulated raw time-out status ... every read advances the virtual time */
+uint32 Gpt_SimTimestampReadCounter(void);
+uint32 Gpt_SimTimestampReadOverflow(void);
+
+#define GPT_TIMESTAMP_COUNTER()             Gpt_SimTimestampReadCounter()
+#define GPT_TIMESTAMP_OVERFLOW()            Gpt_SimTimestampReadOverflow()
+#define GPT_TIMESTAMP_RUNNING()             (TRUE)
+
+#else
+
+#include "Gpt_Regs.h"
+#include "tm4c123gh6pm_registers.h"
+
+#define GPT_TIMESTAMP_COUNTER()             (*(volatile uint32 *)(GPT_WIDE_TIMER5_BASE_ADDRESS + GPT_TAV_REG_OFFSET))
+#define GPT_TIMESTAMP_OVERFLOW()            ((*(volatile uint32 *)(GPT_WIDE_TIMER5_BASE_ADDRESS + GPT_RIS_REG_OFFSET)) & GPT_TIMESTAMP_OVERFLOW_MASK)
+
+/* The registers of the timer are read only once its clock is ready, an access before faults */
+#define GPT_TIMESTAMP_RUNNING()             ((SYSCTL_PRWTIMER_REG & (1UL << (GPT_TIMESTAMP_TIMER - GPT_WIDE_TIMER0))) &&\
+                                             ((*(volatile uint32 *)(GPT_WIDE_TIMER5_BASE_ADDRESS + GPT_CTL_REG_OFFSET)) & 0x1))
+
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Description: 64-bit timestamp in core clock cycles */
+typedef uint64 Gpt_TimestampType;
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Wraps of the timestamp counter, incremented by the overflow ISR ... do not use it directly */
+extern volatile uint32 g_Gpt_Timestamp_High;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Gpt_TimestampInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the timestamp and the busy-waits from 0:
+*              - Enable the clock of WideTimer5
+*              - Setup Timer A as a 32-bit periodic up counter of the core clock
+*              - Enable its time-out interrupt to count the wraps
+*              It shall be called after the core clock is set by Mcu_DistributePllClock.
+************************************************************************************/
+void Gpt_TimestampInit(void);
+
+/* Description: Return the 64-bit timestamp in core clock cycles */
+LOCAL_INLINE Gpt_TimestampType Gpt_GetTicks(void)
+{
+    uint32 high;
+    uint32 low;
+    uint32 overflow;
+
+    do
+    {
+        high     = g_Gpt_Timestamp_High;
+        low      = GPT_TIMESTAMP_COUNTER();
+        overflow = GPT_TIMESTAMP_OVERFLOW();
+    } while(high != g_Gpt_Timestamp_High); /* Retry if the overflow ISR ran during the reads */
+
+    /* A pending wrap belongs to this read only if the counter was read after it */
+    if((overflow != 0) && (low < 0x80000000U))
+    {
+        high++;
+    }
+    return ((Gpt_TimestampType)high << 32) | low;
+}
+
+/* Description: Return TRUE once Gpt_TimestampInit started the timestamp ... for the modules which may
+ *              run before it, like Det, to avoid reading the timer before its clock is enabled */
+LOCAL_INLINE boolean Gpt_TimestampIsRunning(void)
+{
+    return GPT_TIMESTAMP_RUNNING() ? TRUE : FALSE;
+}
+
+/* Description: Return the low 32 bits of the timestamp, a single load enough to measure intervals below
+ *              53 s at 80 MHz with unsigned subtraction */
+LOCAL_INLINE uint32 Gpt_GetTicks32(void)
+{
+    return GPT_TIMESTAMP_COUNTER();
+}
+
+/* Description: Busy-wait until the low 32 bits of the timestamp reach Deadline.
+ *              It returns at once for a deadline passed up to 26 s ago (at 80 MHz) */
+LOCAL_INLINE void Gpt_WaitUntil(uint32 Deadline)
+{
+    while((sint32)(Gpt_GetTicks32() - Deadline) < 0)
+    {
+        /* Busy-wait */
+    }
+}
+
+/* Description: Busy-wait for at least Us, up to GPT_DELAY_MAX_US ... it returns within a few cycles after it */
+LOCAL_INLINE void Gpt_DelayUs(uint32 Us)
+{
+    Gpt_WaitUntil(Gpt_GetTicks32() + GPT_US_TO_TICKS(Us));
+}
+
+/* Description: Convert timestamp ticks to ns, rounded down ... the us are converted apart from the ticks
+ *              left so the product does not overflow, the ns fit 64 bits for 584 years */
+LOCAL_INLINE uint64 Gpt_TicksToNs(Gpt_TimestampType Ticks)
+{
+    return ((Ticks / GPT_TIMESTAMP_TICKS_PER_US) * 1000U) + (((Ticks % GPT_TIMESTAMP_TICKS_PER_US) * 1000U) / GPT_TIMESTAMP_TICKS_PER_US);
+}
+
+/* Description: Convert timestamp ticks to us, rounded down */
+LOCAL_INLINE uint64 Gpt_TicksToUs(Gpt_TimestampType Ticks)
+{
+    return Ticks / GPT_TIMESTAMP_TICKS_PER_US;
+}
+
+/* Description: Convert a time in us to timestamp ticks */
+LOCAL_INLINE Gpt_TimestampType Gpt_UsToTicks(uint64 Us)
+{
+    return Us * GPT_TIMESTAMP_TICKS_PER_US;
+}
+
+/* Description: Convert a time in ns to timestamp ticks, rounded up so a wait lasts at least the time ...
+ *              the whole us are converted apart like in Gpt_TicksToNs */
+LOCAL_INLINE Gpt_TimestampType Gpt_NsToTicks(uint64 Ns)
+{
+    return ((Ns / 1000U) * GPT_TIMESTAMP_TICKS_PER_US) + ((((Ns % 1000U) * GPT_TIMESTAMP_TICKS_PER_US) + 999U) / 1000U);
+}
+
+#endif /* (GPT_TIMESTAMP_API == STD_ON) */
+
+#endif /* GPT_TIMESTAMP_H_ */
@@ -0,0 +1,529 @@
+ /******************************************************************************
+ *
+ * Module: Icu
+ *
+ * File Name: Icu.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Icu Driver.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "Icu.h"
+#include "Gpt_Regs.h"
+#include "Port_Regs.h"
+#include "Mcu_Cfg.h"
+#include "Cpu.h"
+#include "Reg_Access.h"
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Icu Modules */
+#if ((DET_AR_MAJOR_VERSION != ICU_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != ICU_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != ICU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+#if ((ICU_BUFFER_SIZE & (ICU_BUFFER_SIZE - 1U)) != 0)
+  #error "ICU_BUFFER_SIZE shall be a power of two"
+#endif
+
+/* Frequency of the captured times ... the timers count the system clock */
+#define ICU_CLOCK_FREQUENCY             (McuConf_CORE_CLOCK_FREQUENCY)
+
+/* Timer configuration ... a wide timer counts 32 bits, a 16/32-bit timer 16 bits with its 8-bit prescaler on top */
+#define ICU_CFG_SPLIT_TIMER             0x4
+#define ICU_TAMR_EDGE_TIME_COUNT_UP     0x17  /* Capture mode, edge-time, count up */
+#define ICU_CTL_TAEN_MASK               0x00000001
+#define ICU_CTL_TAEVENT_MASK            0x0000000C
+#define ICU_CTL_TAEVENT_RISING_EDGE     0x00000000
+#define ICU_CTL_TAEVENT_FALLING_EDGE    0x00000004
+#define ICU_CAE_INTERRUPT_MASK          0x00000004
+#define ICU_TAPR_TIMER_EXTENSION        0xFF
+#define ICU_WIDE_TIMER_COUNTER_MASK     0xFFFFFFFF
+#define ICU_TIMER_COUNTER_MASK          0x00FFFFFF
+
+/* Edges seen since the last period start */
+#define ICU_PHASE_NONE                  (0U)  /* No period start yet */
+#define ICU_PHASE_ACTIVE                (1U)  /* Period started, waiting for the end of the active time */
+#define ICU_PHASE_INACTIVE              (2U)  /* Active time ended, waiting for the next period start */
+
+/* Timer not used by a channel */
+#define ICU_NO_CHANNEL                  (0xFFU)
+
+/* Description: Run time data of a channel. The ring buffer has a single producer (the capture ISR)
+ *              and a single consumer (Icu_GetStatistics), each index is written by one side only */
+typedef struct
+{
+	uint32 base_address;                      /* Registers of the timer */
+	uint32 counter_mask;                      /* Valid bits of the captured times */
+	uint32 gpio_data_address;                 /* GPIODATA address masking the pin alone */
+	uint32 active_event;                      /* TAEVENT of the edge which starts a period */
+	uint32 inactive_event;                    /* TAEVENT of the edge which ends the active time */
+	uint32 period_start;                      /* Capture of the last period start */
+	uint32 active_end;                        /* Capture of the last end of the active time */
+	uint8 phase;
+	boolean running;
+	Icu_DutyCycleType last;                   /* Last complete period for Icu_GetDutyCycleValues */
+	Icu_DutyCycleType buffer[ICU_BUFFER_SIZE];
+	volatile uint32 head;                     /* Written by the ISR */
+	volatile uint32 tail;                     /* Written by Icu_GetStatistics */
+	volatile uint32 lost;                     /* Written by the ISR */
+	uint32 lost_reported;                     /* Written by Icu_GetStatistics */
+}Icu_ChannelStateType;
+
+/* Registers base address of each Gpt_HwTimerType */
+static const uint32 Icu_TimerBaseAddress[GPT_HW_TIMERS_NUM] = {
+	GPT_TIMER0_BASE_ADDRESS, GPT_TIMER1_BASE_ADDRESS, GPT_TIMER2_BASE_ADDRESS,
+	GPT_TIMER3_BASE_ADDRESS, GPT_TIMER4_BASE_ADDRESS, GPT_TIMER5_BASE_ADDRESS,
+	GPT_WIDE_TIMER0_BASE_ADDRESS, GPT_WIDE_TIMER1_BASE_ADDRESS, GPT_WIDE_TIMER2_BASE_ADDRESS,
+	GPT_WIDE_TIMER3_BASE_ADDRESS, GPT_WIDE_TIMER4_BASE_ADDRESS, GPT_WIDE_TIMER5_BASE_ADDRESS
+};
+
+/* Registers base address of each port */
+static const uint32 Icu_GpioBaseAddress[] = {
+	GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+	GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS
+};
+
+STATIC const Icu_ConfigChannel * Icu_Channels = NULL_PTR;
+STATIC uint8 Icu_Status = ICU_NOT_INITIALIZED;
+
+STATIC Icu_ChannelStateType Icu_ChannelState[ICU_CONFIGURED_CHANNELS];
+
+/* Channel of every hardware timer used by the capture ISR */
+STATIC Icu_ChannelType Icu_HwChannel[GPT_HW_TIMERS_NUM];
+
+/*********************************************************************************************/
+static void Icu_PushPeriod(Icu_ChannelStateType * State, Icu_ValueType Active, Icu_ValueType Period)
+{
+	uint32 head = State->head;
+
+	State->last.ActiveTime = Active;
+	State->last.PeriodTime = Period;
+
+	if((head - State->tail) >= ICU_BUFFER_SIZE)
+	{
+		State->lost++; /* Buffer full ... keep the oldest periods */
+		return;
+	}
+	State->buffer[head & (ICU_BUFFER_SIZE - 1U)].ActiveTime = Active;
+	State->buffer[head & (ICU_BUFFER_SIZE - 1U)].PeriodTime = Period;
+	Cpu_DataMemoryBarrier(); /* The period is written before the consumer sees the new head */
+	State->head = head + 1U;
+}
+
+/*********************************************************************************************/
+/* Description: Capture the next edge of a channel alone, the other edge is ignored until the next call */
+static void Icu_SetEvent(const Icu_ChannelStateType * State, uint32 Event)
+{
+	REG_WRITE32(State->base_address + GPT_CTL_REG_OFFSET,
+	            (REG_READ32(State->base_address + GPT_CTL_REG_OFFSET) & ~ICU_CTL_TAEVENT_MASK) | Event);
+}
+
+/************************************************************************************
+* Service Name: Icu_CaptureIsr
+* Description: Capture ISR of the timer of a channel, called by the Gpt Driver ISR.
+*              The timer captures one edge at a time, so the phase tells which edge
+*              was captured however short the pulse is. The pin is read only once the
+*              other edge is selected: already at the level after it, that edge came
+*              before the selection and was missed.
+************************************************************************************/
+static void Icu_CaptureIsr(Gpt_HwTimerType Timer)
+{
+	Icu_ChannelType channel = Icu_HwChannel[Timer];
+	Icu_ChannelStateType * state;
+	uint32 capture;
+	boolean active;
+
+	if(ICU_NO_CHANNEL == channel)
+	{
+		return;
+	}
+	state = &Icu_ChannelState[channel];
+
+	REG_ACCESS_ISR_ENTER(ICU_MODULE_ID);
+	capture = REG_READ32(state->base_address + GPT_TAR_REG_OFFSET) & state->counter_mask;
+	REG_WRITE32(state->base_address + GPT_ICR_REG_OFFSET, ICU_CAE_INTERRUPT_MASK);
+
+	if(ICU_PHASE_ACTIVE != state->phase)
+	{
+		/* Period start */
+		if(ICU_PHASE_INACTIVE == state->phase)
+		{
+			/* Unsigned differences of the masked captures are right across the counter wrap */
+			Icu_PushPeriod(state, (state->active_end - state->period_start) & state->counter_mask,
+			               (capture - state->period_start) & state->counter_mask);
+		}
+		state->period_start = capture;
+		state->phase        = ICU_PHASE_ACTIVE;
+		Icu_SetEvent(state, state->inactive_event);
+	}
+	else
+	{
+		state->active_end = capture;
+		state->phase      = ICU_PHASE_INACTIVE;
+		Icu_SetEvent(state, state->active_event);
+	}
+
+	active = (boolean)((REG_READ32(state->gpio_data_address) != 0) == (Icu_Channels[channel].active_level == ICU_ACTIVE_HIGH));
+	if(active == (boolean)(ICU_PHASE_INACTIVE == state->phase))
+	{
+		/* The edge after the capture was missed ... wait for the next period start */
+		state->lost++;
+		state->phase = ICU_PHASE_NONE;
+		Icu_SetEvent(state, state->active_event);
+		REG_WRITE32(state->base_address + GPT_ICR_REG_OFFSET, ICU_CAE_INTERRUPT_MASK); /* Drop the capture of the other edge */
+	}
+	REG_ACCESS_ISR_EXIT();
+}
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+/*********************************************************************************************/
+static boolean Icu_CheckChannel(Icu_ChannelType Channel, uint8 ApiId)
+{
+	boolean error = FALSE;
+
+	/* Check if the Driver is initialized before using this function */
+	if(ICU_NOT_INITIALIZED == Icu_Status)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ApiId, ICU_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if(ICU_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ApiId, ICU_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return error;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Icu_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Icu Driver module.
+************************************************************************************/
+void Icu_Init(const Icu_ConfigType * ConfigPtr)
+{
+	Icu_ChannelType channel;
+	Gpt_HwTimerType timer;
+	uint32 base;
+
+	REG_ACCESS_API(ICU_MODULE_ID, ICU_INIT_SID);
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	if(ICU_INITIALIZED == Icu_Status)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_INIT_SID, ICU_E_ALREADY_INITIALIZED);
+		return;
+	}
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if(NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_INIT_SID, ICU_E_PARAM_CONFIG);
+		return;
+	}
+#endif
+
+	Icu_Channels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+	for(timer = GPT_TIMER0; timer < GPT_HW_TIMERS_NUM; timer++)
+	{
+		Icu_HwChannel[timer] = ICU_NO_CHANNEL;
+	}
+
+	for(channel = 0; channel < ICU_CONFIGURED_CHANNELS; channel++)
+	{
+		timer = Icu_Channels[channel].timer;
+		base  = Icu_TimerBaseAddress[timer];
+
+		Icu_HwChannel[timer] = channel;
+		if(E_OK != Gpt_SetHwTimerCallBack(timer, Icu_CaptureIsr))
+		{
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+			/* The timer is used by the Gpt Driver */
+			Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_INIT_SID, ICU_E_PARAM_CONFIG);
+#endif
+			Icu_HwChannel[timer] = ICU_NO_CHANNEL;
+			continue;
+		}
+
+		Icu_ChannelState[channel].base_address      = base;
+		Icu_ChannelState[channel].gpio_data_address = Icu_GpioBaseAddress[Icu_Channels[channel].port_num] +
+		                                              ((1UL << Icu_Channels[channel].pin_num) << 2);
+		Icu_ChannelState[channel].running           = FALSE;
+		if(ICU_ACTIVE_HIGH == Icu_Channels[channel].active_level)
+		{
+			Icu_ChannelState[channel].active_event   = ICU_CTL_TAEVENT_RISING_EDGE;
+			Icu_ChannelState[channel].inactive_event = ICU_CTL_TAEVENT_FALLING_EDGE;
+		}
+		else
+		{
+			Icu_ChannelState[channel].active_event   = ICU_CTL_TAEVENT_FALLING_EDGE;
+			Icu_ChannelState[channel].inactive_event = ICU_CTL_TAEVENT_RISING_EDGE;
+		}
+
+		REG_WRITE32(base + GPT_CTL_REG_OFFSET, 0);                 /* Disable the timer while it is configured */
+		REG_WRITE32(base + GPT_CFG_REG_OFFSET, ICU_CFG_SPLIT_TIMER);
+		REG_WRITE32(base + GPT_TAMR_REG_OFFSET, ICU_TAMR_EDGE_TIME_COUNT_UP);
+		REG_WRITE32(base + GPT_CTL_REG_OFFSET, Icu_ChannelState[channel].active_event);
+		if(timer >= GPT_WIDE_TIMER0)
+		{
+			REG_WRITE32(base + GPT_TAILR_REG_OFFSET, ICU_WIDE_TIMER_COUNTER_MASK);
+			REG_WRITE32(base + GPT_TAPR_REG_OFFSET, 0);
+			Icu_ChannelState[channel].counter_mask = ICU_WIDE_TIMER_COUNTER_MASK;
+		}
+		else
+		{
+			REG_WRITE32(base + GPT_TAILR_REG_OFFSET, 0xFFFF);
+			REG_WRITE32(base + GPT_TAPR_REG_OFFSET, ICU_TAPR_TIMER_EXTENSION);
+			Icu_ChannelState[channel].counter_mask = ICU_TIMER_COUNTER_MASK;
+		}
+		REG_WRITE32(base + GPT_IMR_REG_OFFSET, 0);
+		REG_WRITE32(base + GPT_ICR_REG_OFFSET, ICU_CAE_INTERRUPT_MASK);
+	}
+
+	Icu_Status = ICU_INITIALIZED;
+}
+
+/************************************************************************************
+* Service Name: Icu_StartSignalMeasurement
+* Service ID[hex]: 0x13
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the ICU channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start capturing the edges of a channel.
+************************************************************************************/
+void Icu_StartSignalMeasurement(Icu_ChannelType Channel)
+{
+	Icu_ChannelStateType * state;
+
+	REG_ACCESS_API(ICU_MODULE_ID, ICU_START_SIGNAL_MEASUREMENT_SID);
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	if(Icu_CheckChannel(Channel, ICU_START_SIGNAL_MEASUREMENT_SID))
+	{
+		return;
+	}
+#endif
+	state = &Icu_ChannelState[Channel];
+
+	REG_CLEAR_MASK32(state->base_address + GPT_CTL_REG_OFFSET, ICU_CTL_TAEN_MASK);
+	Icu_SetEvent(state, state->active_event); /* The first capture is a period start */
+	state->phase           = ICU_PHASE_NONE;
+	state->last.ActiveTime = 0;
+	state->last.PeriodTime = 0;
+	state->tail            = state->head; /* Empty the buffer, the ISR is stopped */
+	state->lost_reported   = state->lost;
+	state->running         = TRUE;
+
+	REG_WRITE32(state->base_address + GPT_ICR_REG_OFFSET, ICU_CAE_INTERRUPT_MASK);
+	REG_SET_MASK32(state->base_address + GPT_IMR_REG_OFFSET, ICU_CAE_INTERRUPT_MASK);
+	REG_SET_MASK32(state->base_address + GPT_CTL_REG_OFFSET, ICU_CTL_TAEN_MASK);
+}
+
+/************************************************************************************
+* Service Name: Icu_StopSignalMeasurement
+* Service ID[hex]: 0x14
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the ICU channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop capturing the edges of a channel.
+************************************************************************************/
+void Icu_StopSignalMeasurement(Icu_ChannelType Channel)
+{
+	Icu_ChannelStateType * state;
+
+	REG_ACCESS_API(ICU_MODULE_ID, ICU_STOP_SIGNAL_MEASUREMENT_SID);
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	if(Icu_CheckChannel(Channel, ICU_STOP_SIGNAL_MEASUREMENT_SID))
+	{
+		return;
+	}
+	if(FALSE == Icu_ChannelState[Channel].running)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_STOP_SIGNAL_MEASUREMENT_SID, ICU_E_NOT_STARTED);
+		return;
+	}
+#endif
+	state = &Icu_ChannelState[Channel];
+
+	REG_CLEAR_MASK32(state->base_address + GPT_CTL_REG_OFFSET, ICU_CTL_TAEN_MASK);
+	REG_CLEAR_MASK32(state->base_address + GPT_IMR_REG_OFFSET, ICU_CAE_INTERRUPT_MASK);
+	state->running = FALSE;
+}
+
+/************************************************************************************
+* Service Name: Icu_GetDutyCycleValues
+* Service ID[hex]: 0x11
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the ICU channel
+* Parameters (inout): None
+* Parameters (out): DutyCycleValues - Active time and period of the last complete period
+* Return value: None
+* Description: Function to read the last period of a channel.
+************************************************************************************/
+void Icu_GetDutyCycleValues(Icu_ChannelType Channel, Icu_DutyCycleType * DutyCycleValues)
+{
+	Cpu_StateType cpu_state;
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	if(Icu_CheckChannel(Channel, ICU_GET_DUTY_CYCLE_VALUES_SID))
+	{
+		return;
+	}
+	if(NULL_PTR == DutyCycleValues)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_GET_DUTY_CYCLE_VALUES_SID, ICU_E_PARAM_BUFFER_PTR);
+		return;
+	}
+#endif
+
+	/* Both values of the same period ... the ISR cannot update them in between */
+	cpu_state = Cpu_EnterCritical();
+	*DutyCycleValues = Icu_ChannelState[Channel].last;
+	Icu_ChannelState[Channel].last.ActiveTime = 0;
+	Icu_ChannelState[Channel].last.PeriodTime = 0;
+	Cpu_ExitCritical(cpu_state);
+}
+
+/************************************************************************************
+* Service Name: Icu_GetStatistics
+* Service ID[hex]: 0x20
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Channel - Numeric identifier of the ICU channel
+* Parameters (inout): None
+* Parameters (out): Statistics - Statistics of the periods queued since the previous call
+* Return value: Std_ReturnType - E_OK: at least one period in the batch
+*                                E_NOT_OK: no period or invalid parameter
+* Description: Function to drain the buffer of a channel and average its periods.
+************************************************************************************/
+Std_ReturnType Icu_GetStatistics(Icu_ChannelType Channel, Icu_StatisticsType * Statistics)
+{
+	Icu_ChannelStateType * state;
+	const Icu_DutyCycleType * sample;
+	uint64 period_sum = 0;
+	uint64 active_sum = 0;
+	uint32 head;
+	uint32 tail;
+	uint32 lost;
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	if(Icu_CheckChannel(Channel, ICU_GET_STATISTICS_SID))
+	{
+		return E_NOT_OK;
+	}
+	if(NULL_PTR == Statistics)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_GET_STATISTICS_SID, ICU_E_PARAM_BUFFER_PTR);
+		return E_NOT_OK;
+	}
+#endif
+	state = &Icu_ChannelState[Channel];
+
+	head = state->head;
+	Cpu_DataMemoryBarrier(); /* The periods are read after the head which published them */
+
+	Statistics->samples    = head - state->tail;
+	Statistics->period_min = 0xFFFFFFFF;
+	Statistics->period_max = 0;
+	for(tail = state->tail; tail != head; tail++)
+	{
+		sample = &state->buffer[tail & (ICU_BUFFER_SIZE - 1U)];
+		period_sum += sample->PeriodTime;
+		active_sum += sample->ActiveTime;
+		if(sample->PeriodTime < Statistics->period_min)
+		{
+			Statistics->period_min = sample->PeriodTime;
+		}
+		if(sample->PeriodTime > Statistics->period_max)
+		{
+			Statistics->period_max = sample->PeriodTime;
+		}
+	}
+	Cpu_DataMemoryBarrier(); /* The periods are read before the ISR can reuse their slots */
+	state->tail = head;
+
+	lost = state->lost;
+	Statistics->lost     = lost - state->lost_reported;
+	state->lost_reported = lost;
+
+	if((0 == Statistics->samples) || (0 == period_sum))
+	{
+		Statistics->period_mean = 0;
+		Statistics->period_min  = 0;
+		Statistics->active_mean = 0;
+		Statistics->duty_cycle  = 0;
+		Statistics->frequency   = 0;
+		return E_NOT_OK;
+	}
+	Statistics->period_mean = (Icu_ValueType)(period_sum / Statistics->samples);
+	Statistics->active_mean = (Icu_ValueType)(active_sum / Statistics->samples);
+	Statistics->duty_cycle  = (uint16)((active_sum * 1000U) / period_sum);
+	Statistics->frequency   = (uint32)(((uint64)ICU_CLOCK_FREQUENCY * 1000U * Statistics->samples) / period_sum);
+	return E_OK;
+}
+
+/************************************************************************************
+* Service Name: Icu_GetVersionInfo
+* Service ID[hex]: 0x12
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (ICU_VERSION_INFO_API == STD_ON)
+void Icu_GetVersionInfo(Std_VersionInfoType * versioninfo)
+{
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if(NULL_PTR == versioninfo)
+	{
+		/* Report to DET  */
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID,
+				ICU_GET_VERSION_INFO_SID, ICU_E_PARAM_VINFO);
+	}
+	else
+#endif /* (ICU_DEV_ERROR_DETECT == STD_ON) */
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)ICU_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)ICU_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)ICU_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)ICU_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)ICU_SW_PATCH_VERSION;
+	}
+}
+#endif
@@ -0,0 +1,283 @@
+ /******************************************************************************
+ *
+ * Module: Icu
+ *
+ * File Name: Icu.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Icu Driver.
+ *
+ *              Every channel runs Timer A of a general-purpose timer in edge-time
+ *              mode on its CCP pin (PORT_PIN_MODE_ALTx in Port_PBcfg.c, e.g. ALT7
+ *              for the WTnCCP0 pins), capturing the two edges in turn so a pulse
+ *              shorter than the ISR latency is counted lost, never misread. The
+ *              capture ISR turns the edges into periods queued in a ring buffer,
+ *              Icu_GetStatistics drains it in batches.
+ *              Times are in system clock ticks (12.5 ns at 80 MHz).
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef ICU_H
+#define ICU_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define ICU_VENDOR_ID    (1000U)
+
+/* Icu Module Id */
+#define ICU_MODULE_ID    (122U)
+
+/* Icu Instance Id */
+#define ICU_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define ICU_SW_MAJOR_VERSION           (1U)
+#define ICU_SW_MINOR_VERSION           (0U)
+#define ICU_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define ICU_AR_RELEASE_MAJOR_VERSION   (4U)
+#define ICU_AR_RELEASE_MINOR_VERSION   (0U)
+#define ICU_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Icu Status
+ */
+#define ICU_INITIALIZED                (1U)
+#define ICU_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Icu Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != ICU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != ICU_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != ICU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Icu Pre-Compile Configuration Header file */
+#include "Icu_Cfg.h"
+
+/* AUTOSAR Version checking between Icu_Cfg.h and Icu.h files */
+#if ((ICU_CFG_AR_RELEASE_MAJOR_VERSION != ICU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (ICU_CFG_AR_RELEASE_MINOR_VERSION != ICU_AR_RELEASE_MINOR_VERSION)\
+ ||  (ICU_CFG_AR_RELEASE_PATCH_VERSION != ICU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Icu_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Icu_Cfg.h and Icu.h files */
+#if ((ICU_CFG_SW_MAJOR_VERSION != ICU_SW_MAJOR_VERSION)\
+ ||  (ICU_CFG_SW_MINOR_VERSION != ICU_SW_MINOR_VERSION)\
+ ||  (ICU_CFG_SW_PATCH_VERSION != ICU_SW_PATCH_VERSION))
+  #error "The SW version of Icu_Cfg.h does not match the expected version"
+#endif
+
+/* Hardware timers of the Gpt Driver */
+#include "Gpt.h"
+
+/* Port and pin IDs of the capture pins */
+#include "Port.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Icu_Init */
+#define ICU_INIT_SID                        ((uint8)0x00)
+
+/* Service ID for Icu_GetDutyCycleValues */
+#define ICU_GET_DUTY_CYCLE_VALUES_SID       ((uint8)0x11)
+
+/* Service ID for Icu_GetVersionInfo */
+#define ICU_GET_VERSION_INFO_SID            ((uint8)0x12)
+
+/* Service ID for Icu_StartSignalMeasurement */
+#define ICU_START_SIGNAL_MEASUREMENT_SID    ((uint8)0x13)
+
+/* Service ID for Icu_StopSignalMeasurement */
+#define ICU_STOP_SIGNAL_MEASUREMENT_SID     ((uint8)0x14)
+
+/* Service ID for Icu_GetStatistics */
+#define ICU_GET_STATISTICS_SID              ((uint8)0x20)
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API Icu_Init service called with wrong parameter */
+#define ICU_E_PARAM_CONFIG                  ((uint8)0x0A)
+
+/* API service called with an invalid channel */
+#define ICU_E_PARAM_CHANNEL                 ((uint8)0x0B)
+
+/* API service called with a Null Pointer for the results */
+#define ICU_E_PARAM_BUFFER_PTR              ((uint8)0x0D)
+
+/* API service called without module initialization */
+#define ICU_E_UNINIT                        ((uint8)0x14)
+
+/* API Icu_StopSignalMeasurement called on a channel not started */
+#define ICU_E_NOT_STARTED                   ((uint8)0x15)
+
+/* API Icu_Init called while the module is already initialized */
+#define ICU_E_ALREADY_INITIALIZED           ((uint8)0x17)
+
+/* API Icu_GetVersionInfo called with a Null Pointer */
+#define ICU_E_PARAM_VINFO                   ((uint8)0x19)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Description: Numeric identifier of an Icu channel */
+typedef uint8 Icu_ChannelType;
+
+/* Description: Time in system clock ticks */
+typedef uint32 Icu_ValueType;
+
+/* Description: Level of the signal which starts a period and is measured as the active time */
+typedef enum
+{
+    ICU_ACTIVE_LOW,
+    ICU_ACTIVE_HIGH
+}Icu_ActivationType;
+
+/* Description: Active time and period of one period of the signal */
+typedef struct
+{
+    Icu_ValueType ActiveTime;
+    Icu_ValueType PeriodTime;
+}Icu_DutyCycleType;
+
+/* Description: Statistics of the periods measured since the previous call of Icu_GetStatistics */
+typedef struct
+{
+    uint32 samples;              /* Periods in the batch, the other fields are 0 without any */
+    Icu_ValueType period_mean;
+    Icu_ValueType period_min;
+    Icu_ValueType period_max;
+    Icu_ValueType active_mean;
+    uint16 duty_cycle;           /* Active time of the batch in per-mille of its periods */
+    uint32 frequency;            /* Mean frequency in mHz */
+    uint32 lost;                 /* Periods lost to a full buffer or to a missed edge */
+}Icu_StatisticsType;
+
+/* Description: Structure to configure each individual channel:
+ *	1. the hardware timer, a wide timer counts 32 bits, a 16/32-bit timer counts 24 bits (0.2 s at 80 MHz)
+ *	2. the port and the pin of the CCP0 input of the timer, read by the ISR to find a missed edge
+ *	3. the level which starts a period
+ */
+typedef struct
+{
+    Gpt_HwTimerType timer;
+    uint8 port_num;
+    Port_PinType pin_num;
+    Icu_ActivationType active_level;
+}Icu_ConfigChannel;
+
+/* Array of Icu_ConfigChannel */
+typedef struct
+{
+    Icu_ConfigChannel Channels[ICU_CONFIGURED_CHANNELS];
+}Icu_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Icu_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to configuration set
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Icu Driver module:
+*              - Take the timer of every channel from the Gpt Driver
+*              - Setup Timer A as an up counter capturing the edge which starts a period
+*              - Enable its capture interrupt, the channels start stopped
+************************************************************************************/
+void Icu_Init(const Icu_ConfigType * ConfigPtr);
+
+/************************************************************************************
+* Service Name: Icu_StartSignalMeasurement
+* Service ID[hex]: 0x13
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the ICU channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start capturing the edges of a channel, the buffer is emptied.
+************************************************************************************/
+void Icu_StartSignalMeasurement(Icu_ChannelType Channel);
+
+/************************************************************************************
+* Service Name: Icu_StopSignalMeasurement
+* Service ID[hex]: 0x14
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the ICU channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop capturing the edges of a channel, the queued periods are kept.
+************************************************************************************/
+void Icu_StopSignalMeasurement(Icu_ChannelType Channel);
+
+/************************************************************************************
+* Service Name: Icu_GetDutyCycleValues
+* Service ID[hex]: 0x11
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the ICU channel
+* Parameters (inout): None
+* Parameters (out): DutyCycleValues - Active time and period of the last complete period,
+*                                     0 if none was completed since the previous call
+* Return value: None
+* Description: Function to read the last period without draining the buffer.
+************************************************************************************/
+void Icu_GetDutyCycleValues(Icu_ChannelType Channel, Icu_DutyCycleType * DutyCycleValues);
+
+/************************************************************************************
+* Service Name: Icu_GetStatistics
+* Service ID[hex]: 0x20
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Channel - Numeric identifier of the ICU channel
+* Parameters (inout): None
+* Parameters (out): Statistics - Statistics of the periods queued since the previous call
+* Return value: Std_ReturnType - E_OK: at least one period in the batch
+*                                E_NOT_OK: no period or invalid parameter
+* Description: Function to drain the buffer of a channel and average its periods,
+*              called by a single task.
+************************************************************************************/
+Std_ReturnType Icu_GetStatistics(Icu_ChannelType Channel, Icu_StatisticsType * Statistics);
+
+/************************************************************************************
+* Service Name: Icu_GetVersionInfo
+* Service ID[hex]: 0x12
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (ICU_VERSION_INFO_API == STD_ON)
+void Icu_GetVersionInfo(Std_VersionInfoType * versioninfo);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Post build structure used with Icu_Init API */
+extern const Icu_ConfigType Icu_Configuration;
+
+#endif /* ICU_H */
@@ -0,0 +1,47 @@
+ /******************************************************************************
+ *
+ * Module: Icu
+ *
+ * File Name: Icu_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Icu Driver
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef ICU_CFG_H
+#define ICU_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define ICU_CFG_SW_MAJOR_VERSION              (1U)
+#define ICU_CFG_SW_MINOR_VERSION              (0U)
+#define ICU_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define ICU_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define ICU_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define ICU_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define ICU_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define ICU_VERSION_INFO_API                (STD_OFF)
+
+/* Periods queued by the capture ISR between two calls of Icu_GetStatistics, a power of two */
+#define ICU_BUFFER_SIZE                     (32U)
+
+/* Number of the configured Icu Channels */
+#define ICU_CONFIGURED_CHANNELS             (1U)
+
+/* Channel Index in the array of structures in Icu_PBcfg.c */
+#define IcuConf_PULSE_IN_CHANNEL_ID         (Icu_ChannelType)0
+
+/* Hardware timer of every channel, its number in Gpt_HwTimerType ... the preprocessor checks it against the Gpt */
+#define IcuConf_PULSE_IN_HW_TIMER           (7U)    /* GPT_WIDE_TIMER1 */
+
+#endif /* ICU_CFG_H */
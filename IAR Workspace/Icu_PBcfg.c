@@ -0,0 +1,58 @@
+ /******************************************************************************
+ *
+ * Module: Icu
+ *
+ * File Name: Icu_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Icu Driver
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "Icu.h"
+#include "Gpt_Timestamp.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define ICU_PBCFG_SW_MAJOR_VERSION              (1U)
+#define ICU_PBCFG_SW_MINOR_VERSION              (0U)
+#define ICU_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define ICU_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define ICU_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define ICU_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Icu_PBcfg.c and Icu.h files */
+#if ((ICU_PBCFG_AR_RELEASE_MAJOR_VERSION != ICU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (ICU_PBCFG_AR_RELEASE_MINOR_VERSION != ICU_AR_RELEASE_MINOR_VERSION)\
+ ||  (ICU_PBCFG_AR_RELEASE_PATCH_VERSION != ICU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Icu_PBcfg.c and Icu.h files */
+#if ((ICU_PBCFG_SW_MAJOR_VERSION != ICU_SW_MAJOR_VERSION)\
+ ||  (ICU_PBCFG_SW_MINOR_VERSION != ICU_SW_MINOR_VERSION)\
+ ||  (ICU_PBCFG_SW_PATCH_VERSION != ICU_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* The Icu borrows its timer from the Gpt ... a timer of a Gpt channel or of the timestamp is not free */
+#if ((IcuConf_PULSE_IN_HW_TIMER == GptConf_IO_TIMER_HW_TIMER) || (IcuConf_PULSE_IN_HW_TIMER == GptConf_HEARTBEAT_HW_TIMER))
+  #error "An Icu channel uses the hardware timer of a Gpt channel"
+#endif
+
+#if ((GPT_TIMESTAMP_API == STD_ON) && (IcuConf_PULSE_IN_HW_TIMER == GPT_TIMESTAMP_HW_TIMER))
+  #error "An Icu channel uses the hardware timer reserved for the timestamp"
+#endif
+
+/* PB structure used with Icu_Init API */
+const Icu_ConfigType Icu_Configuration = {
+    {
+        /* Pulse input on PC6 (WT1CCP0), a period starts on the rising edge */
+        {(Gpt_HwTimerType)IcuConf_PULSE_IN_HW_TIMER, PORT_PORTC_ID, PORT_PIN6_ID, ICU_ACTIVE_HIGH}
+    }
+};
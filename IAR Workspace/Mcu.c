@@ -0,0 +1,302 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Mcu Driver.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "Mcu.h"
+#include "tm4c123gh6pm_registers.h"
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Mcu Modules */
+#if ((DET_AR_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* RCC register bits */
+#define MCU_RCC_MOSCDIS_MASK            0x00000001
+#define MCU_RCC_XTAL_MASK               0x000007C0
+#define MCU_RCC_XTAL_BITS_POS           6
+#define MCU_RCC_USESYSDIV_MASK          0x00400000
+
+/* RCC2 register bits ... SYSDIV2 and SYSDIV2LSB form one 7-bit divider once DIV400 is set */
+#define MCU_RCC2_USERCC2_MASK           0x80000000
+#define MCU_RCC2_DIV400_MASK            0x40000000
+#define MCU_RCC2_SYSDIV2_MASK           0x1FC00000
+#define MCU_RCC2_SYSDIV2_BITS_POS       23
+#define MCU_RCC2_SYSDIV2LSB_BITS_POS    22
+#define MCU_RCC2_PWRDN2_MASK            0x00002000
+#define MCU_RCC2_BYPASS2_MASK           0x00000800
+#define MCU_RCC2_OSCSRC2_MASK           0x00000070
+
+/* Raw interrupt status bits, cleared by writing 1 to the same bit of the MISC register */
+#define MCU_RIS_PLLLRIS_MASK            0x00000040
+#define MCU_RIS_MOSCPUPRIS_MASK         0x00000100
+
+/* Frequency of the precision internal oscillator running the core after the reset */
+#define MCU_PIOSC_FREQUENCY             (16000000U)
+
+STATIC const Mcu_ClockConfigType * Mcu_ClockSettings = NULL_PTR;
+STATIC uint8 Mcu_Status = MCU_NOT_INITIALIZED;
+
+/* Clock setting applied by the last successful Mcu_InitClock, NULL_PTR before */
+STATIC const Mcu_ClockConfigType * Mcu_CurrentClock = NULL_PTR;
+
+/* System clock frequency in Hz ... updated every time the clock source or divider changes */
+STATIC uint32 Mcu_SysClockFrequency = MCU_PIOSC_FREQUENCY;
+
+/************************************************************************************
+* Service Name: Mcu_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Mcu Driver module.
+************************************************************************************/
+void Mcu_Init(const Mcu_ConfigType * ConfigPtr)
+{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_SID,
+		     MCU_E_PARAM_CONFIG);
+	}
+	else
+#endif
+	{
+		Mcu_Status        = MCU_INITIALIZED;
+		Mcu_ClockSettings = ConfigPtr->ClockSetting; /* address of the first clock setting --> ClockSetting[0] */
+	}
+}
+
+/************************************************************************************
+* Service Name: Mcu_InitClock
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ClockSetting - Clock setting index in the configuration set
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the clock setting is applied or the PLL is starting
+*                                E_NOT_OK: invalid clock setting, module not initialized
+*                                          or the main oscillator did not start
+* Description: Function to apply a clock setting:
+*              - Run the system clock from the oscillator without divider
+*              - Start the main oscillator and select its crystal
+*              - Power up the PLL or apply the oscillator divider
+************************************************************************************/
+Std_ReturnType Mcu_InitClock(Mcu_ClockType ClockSetting)
+{
+	const Mcu_ClockConfigType * clock = NULL_PTR;
+	uint32 timeout = MCU_MOSC_STARTUP_TIMEOUT;
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (MCU_NOT_INITIALIZED == Mcu_Status)
+	{
+		Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+				MCU_INIT_CLOCK_SID, MCU_E_UNINIT);
+		return E_NOT_OK;
+	}
+	/* Check if the used clock setting is within the valid range */
+	if (MCU_CLOCK_SETTINGS_NUM <= ClockSetting)
+	{
+		Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+				MCU_INIT_CLOCK_SID, MCU_E_PARAM_CLOCK);
+		return E_NOT_OK;
+	}
+#endif
+	clock = &Mcu_ClockSettings[ClockSetting];
+
+	/* Bypass the PLL and the divider ... the clock keeps running from the current oscillator while it changes */
+	SYSCTL_RCC2_REG |= MCU_RCC2_USERCC2_MASK | MCU_RCC2_BYPASS2_MASK;
+	SYSCTL_RCC_REG  &= ~MCU_RCC_USESYSDIV_MASK;
+	SYSCTL_RCC2_REG &= ~(MCU_RCC2_DIV400_MASK | MCU_RCC2_SYSDIV2_MASK);
+
+	/* Start the main oscillator with the configured crystal and wait until it is stable */
+	SYSCTL_MISC_REG = MCU_RIS_MOSCPUPRIS_MASK;
+	SYSCTL_RCC_REG  = (SYSCTL_RCC_REG & ~(MCU_RCC_MOSCDIS_MASK | MCU_RCC_XTAL_MASK)) |
+	                  ((uint32)MCU_MOSC_XTAL << MCU_RCC_XTAL_BITS_POS);
+	while (((SYSCTL_RIS_REG & MCU_RIS_MOSCPUPRIS_MASK) == 0) && (timeout > 0))
+	{
+		timeout--;
+	}
+	if (timeout == 0)
+	{
+		/* No crystal ... stay on the internal oscillator */
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+				MCU_INIT_CLOCK_SID, MCU_E_CLOCK_FAILURE);
+#endif
+		return E_NOT_OK;
+	}
+
+	/* Run from the main oscillator */
+	SYSCTL_RCC2_REG &= ~MCU_RCC2_OSCSRC2_MASK;
+	Mcu_SysClockFrequency = MCU_MOSC_FREQUENCY;
+
+	if (clock->pll)
+	{
+		/* Power up the PLL ... Mcu_DistributePllClock selects it once Mcu_GetPllStatus reports the lock */
+		SYSCTL_MISC_REG  = MCU_RIS_PLLLRIS_MASK;
+		SYSCTL_RCC2_REG &= ~MCU_RCC2_PWRDN2_MASK;
+	}
+	else
+	{
+		SYSCTL_RCC2_REG |= MCU_RCC2_PWRDN2_MASK;
+		if (clock->sysdiv != 0)
+		{
+			SYSCTL_RCC2_REG |= (uint32)clock->sysdiv << MCU_RCC2_SYSDIV2_BITS_POS;
+			SYSCTL_RCC_REG  |= MCU_RCC_USESYSDIV_MASK;
+		}
+		Mcu_SysClockFrequency = clock->frequency;
+	}
+	Mcu_CurrentClock = clock;
+	return E_OK;
+}
+
+/************************************************************************************
+* Service Name: Mcu_DistributePllClock
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to switch the system clock to the locked PLL, nothing happens
+*              in case the current clock setting does not use the PLL or the PLL is
+*              not locked yet.
+************************************************************************************/
+void Mcu_DistributePllClock(void)
+{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (MCU_NOT_INITIALIZED == Mcu_Status)
+	{
+		Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+				MCU_DISTRIBUTE_PLL_CLOCK_SID, MCU_E_UNINIT);
+		return;
+	}
+#endif
+	/* The core shall not run from the PLL before it is locked ... it keeps the main oscillator */
+	if (MCU_PLL_UNLOCKED == Mcu_GetPllStatus())
+	{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+				MCU_DISTRIBUTE_PLL_CLOCK_SID, MCU_E_PLL_NOT_LOCKED);
+#endif
+		return;
+	}
+	if ((NULL_PTR != Mcu_CurrentClock) && (Mcu_CurrentClock->pll))
+	{
+		/* Divide the 400 MHz PLL output then stop bypassing it */
+		SYSCTL_RCC2_REG = (SYSCTL_RCC2_REG & ~MCU_RCC2_SYSDIV2_MASK) | MCU_RCC2_DIV400_MASK |
+		                  ((uint32)Mcu_CurrentClock->sysdiv << MCU_RCC2_SYSDIV2LSB_BITS_POS);
+		SYSCTL_RCC_REG  |= MCU_RCC_USESYSDIV_MASK;
+		SYSCTL_RCC2_REG &= ~MCU_RCC2_BYPASS2_MASK;
+		Mcu_SysClockFrequency = Mcu_CurrentClock->frequency;
+	}
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetPllStatus
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Mcu_PllStatusType - Lock state of the PLL
+* Description: Function to read the lock state of the PLL, MCU_PLL_STATUS_UNDEFINED
+*              before the module is initialized or when the clock setting does not use the PLL.
+************************************************************************************/
+Mcu_PllStatusType Mcu_GetPllStatus(void)
+{
+	Mcu_PllStatusType status = MCU_PLL_STATUS_UNDEFINED;
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (MCU_NOT_INITIALIZED == Mcu_Status)
+	{
+		Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+				MCU_GET_PLL_STATUS_SID, MCU_E_UNINIT);
+	}
+	else
+#endif
+	if ((NULL_PTR != Mcu_CurrentClock) && (Mcu_CurrentClock->pll))
+	{
+		status = (SYSCTL_RIS_REG & MCU_RIS_PLLLRIS_MASK) ? MCU_PLL_LOCKED : MCU_PLL_UNLOCKED;
+	}
+	return status;
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetSysClockFrequency
+* Service ID[hex]: 0x20
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - System clock frequency in Hz
+* Description: Function to read the frequency the system clock currently runs at.
+************************************************************************************/
+uint32 Mcu_GetSysClockFrequency(void)
+{
+	return Mcu_SysClockFrequency;
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetVersionInfo
+* Service ID[hex]: 0x09
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (MCU_VERSION_INFO_API == STD_ON)
+void Mcu_GetVersionInfo(Std_VersionInfoType * versioninfo)
+{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if(NULL_PTR == versioninfo)
+	{
+		/* Report to DET  */
+		Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID,
+				MCU_GET_VERSION_INFO_SID, MCU_E_PARAM_POINTER);
+	}
+	else
+#endif /* (MCU_DEV_ERROR_DETECT == STD_ON) */
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)MCU_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)MCU_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)MCU_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)MCU_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)MCU_SW_PATCH_VERSION;
+	}
+}
+#endif
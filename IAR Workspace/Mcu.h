@@ -0,0 +1,242 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Mcu Driver.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef MCU_H
+#define MCU_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define MCU_VENDOR_ID    (1000U)
+
+/* Mcu Module Id */
+#define MCU_MODULE_ID    (101U)
+
+/* Mcu Instance Id */
+#define MCU_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_SW_MAJOR_VERSION           (1U)
+#define MCU_SW_MINOR_VERSION           (0U)
+#define MCU_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_AR_RELEASE_MAJOR_VERSION   (4U)
+#define MCU_AR_RELEASE_MINOR_VERSION   (0U)
+#define MCU_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Mcu Status
+ */
+#define MCU_INITIALIZED                (1U)
+#define MCU_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Mcu Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Mcu Pre-Compile Configuration Header file */
+#include "Mcu_Cfg.h"
+
+/* AUTOSAR Version checking between Mcu_Cfg.h and Mcu.h files */
+#if ((MCU_CFG_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (MCU_CFG_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (MCU_CFG_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Mcu_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Mcu_Cfg.h and Mcu.h files */
+#if ((MCU_CFG_SW_MAJOR_VERSION != MCU_SW_MAJOR_VERSION)\
+ ||  (MCU_CFG_SW_MINOR_VERSION != MCU_SW_MINOR_VERSION)\
+ ||  (MCU_CFG_SW_PATCH_VERSION != MCU_SW_PATCH_VERSION))
+  #error "The SW version of Mcu_Cfg.h does not match the expected version"
+#endif
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Mcu_Init */
+#define MCU_INIT_SID                        ((uint8)0x00)
+
+/* Service ID for Mcu_InitClock */
+#define MCU_INIT_CLOCK_SID                  ((uint8)0x02)
+
+/* Service ID for Mcu_DistributePllClock */
+#define MCU_DISTRIBUTE_PLL_CLOCK_SID        ((uint8)0x03)
+
+/* Service ID for Mcu_GetPllStatus */
+#define MCU_GET_PLL_STATUS_SID              ((uint8)0x04)
+
+/* Service ID for Mcu_GetVersionInfo */
+#define MCU_GET_VERSION_INFO_SID            ((uint8)0x09)
+
+/* Service ID for Mcu_GetSysClockFrequency */
+#define MCU_GET_SYS_CLOCK_FREQUENCY_SID     ((uint8)0x20)
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API Mcu_Init service called with wrong parameter */
+#define MCU_E_PARAM_CONFIG                  ((uint8)0x0A)
+
+/* API Mcu_InitClock service called with an invalid clock setting */
+#define MCU_E_PARAM_CLOCK                   ((uint8)0x0B)
+
+/* API Mcu_DistributePllClock called before the PLL is locked */
+#define MCU_E_PLL_NOT_LOCKED                ((uint8)0x0E)
+
+/* API service called without module initialization */
+#define MCU_E_UNINIT                        ((uint8)0x0F)
+
+/* API Mcu_InitClock: the main oscillator did not start within MCU_MOSC_STARTUP_TIMEOUT */
+#define MCU_E_CLOCK_FAILURE                 ((uint8)0x11)
+
+/* APIs called with a Null Pointer */
+#define MCU_E_PARAM_POINTER                 ((uint8)0x10)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Description: Index of a clock setting in Mcu_ConfigType */
+typedef uint8 Mcu_ClockType;
+
+/* Description: Lock state of the PLL returned by Mcu_GetPllStatus */
+typedef enum
+{
+    MCU_PLL_LOCKED,
+    MCU_PLL_UNLOCKED,
+    MCU_PLL_STATUS_UNDEFINED
+}Mcu_PllStatusType;
+
+/* Description: Structure to configure each clock setting:
+ *	1. TRUE to run the system clock from the 400 MHz PLL output, FALSE to run it from the main oscillator
+ *	2. the system clock divider minus 1, it divides the 400 MHz PLL output or the main oscillator,
+ *	   0 for no divider ... a PLL clock setting shall divide by at least 5 (80 MHz)
+ *	3. the resulting system clock frequency in Hz
+ */
+typedef struct
+{
+    boolean pll;
+    uint8 sysdiv;
+    uint32 frequency;
+}Mcu_ClockConfigType;
+
+/* Array of Mcu_ClockConfigType */
+typedef struct
+{
+    Mcu_ClockConfigType ClockSetting[MCU_CLOCK_SETTINGS_NUM];
+}Mcu_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Mcu_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to configuration set
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Mcu Driver module.
+************************************************************************************/
+void Mcu_Init(const Mcu_ConfigType * ConfigPtr);
+
+/************************************************************************************
+* Service Name: Mcu_InitClock
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ClockSetting - Clock setting index in the configuration set
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the clock setting is applied or the PLL is starting
+*                                E_NOT_OK: invalid clock setting or module not initialized
+* Description: Function to apply a clock setting. For a PLL clock setting the system
+*              keeps running from the main oscillator until Mcu_DistributePllClock.
+************************************************************************************/
+Std_ReturnType Mcu_InitClock(Mcu_ClockType ClockSetting);
+
+/************************************************************************************
+* Service Name: Mcu_DistributePllClock
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to switch the system clock to the locked PLL, the system
+*              keeps running from the main oscillator while the PLL is not locked.
+************************************************************************************/
+void Mcu_DistributePllClock(void);
+
+/************************************************************************************
+* Service Name: Mcu_GetPllStatus
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Mcu_PllStatusType - Lock state of the PLL
+* Description: Function to read the lock state of the PLL.
+************************************************************************************/
+Mcu_PllStatusType Mcu_GetPllStatus(void);
+
+/************************************************************************************
+* Service Name: Mcu_GetSysClockFrequency
+* Service ID[hex]: 0x20
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - System clock frequency in Hz
+* Description: Function to read the frequency the system clock currently runs at,
+*              16 MHz from the reset until a clock setting is applied.
+************************************************************************************/
+uint32 Mcu_GetSysClockFrequency(void);
+
+/************************************************************************************
+* Service Name: Mcu_GetVersionInfo
+* Service ID[hex]: 0x09
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (MCU_VERSION_INFO_API == STD_ON)
+void Mcu_GetVersionInfo(Std_VersionInfoType * versioninfo);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Post build structure used with Mcu_Init API */
+extern const Mcu_ConfigType Mcu_Configuration;
+
+#endif /* MCU_H */
@@ -0,0 +1,64 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef MCU_CFG_H
+#define MCU_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_CFG_SW_MAJOR_VERSION              (1U)
+#define MCU_CFG_SW_MINOR_VERSION              (0U)
+#define MCU_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define MCU_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define MCU_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define MCU_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define MCU_VERSION_INFO_API                (STD_OFF)
+
+/* Crystal of the main oscillator ... value of the XTAL field of the RCC register and frequency in Hz */
+#define MCU_MOSC_XTAL                       (0x15U)
+#define MCU_MOSC_FREQUENCY                  (16000000U)
+
+/* Number of polls of the raw interrupt status while waiting for the main oscillator to start */
+#define MCU_MOSC_STARTUP_TIMEOUT            (100000U)
+
+/* Number of polls of Mcu_GetPllStatus by main while waiting for the PLL to lock */
+#define MCU_PLL_LOCK_TIMEOUT                (100000U)
+
+/* Number of the clock settings in Mcu_PBcfg.c */
+#define MCU_CLOCK_SETTINGS_NUM              (2U)
+
+/* Clock setting Index in the array of structures in Mcu_PBcfg.c */
+#define McuConf_CLOCK_PLL_80MHZ             (Mcu_ClockType)0
+#define McuConf_CLOCK_MOSC_16MHZ            (Mcu_ClockType)1
+
+/* System clock frequency of each clock setting in Hz */
+#define McuConf_CLOCK_PLL_80MHZ_FREQUENCY   (80000000U)
+#define McuConf_CLOCK_MOSC_16MHZ_FREQUENCY  (16000000U)
+
+/*
+ * Clock setting applied by main before the Os starts, its frequency is also used
+ * at compile time by the modules which convert times to core clock cycles (Cpu.h),
+ * so main does not start the Os when the clock setting fails
+ */
+#define McuConf_CORE_CLOCK_SETTING          McuConf_CLOCK_PLL_80MHZ
+#define McuConf_CORE_CLOCK_FREQUENCY        McuConf_CLOCK_PLL_80MHZ_FREQUENCY
+
+#endif /* MCU_CFG_H */
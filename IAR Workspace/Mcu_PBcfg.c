@@ -0,0 +1,48 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "Mcu.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_PBCFG_SW_MAJOR_VERSION              (1U)
+#define MCU_PBCFG_SW_MINOR_VERSION              (0U)
+#define MCU_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define MCU_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define MCU_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Mcu_PBcfg.c and Mcu.h files */
+#if ((MCU_PBCFG_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (MCU_PBCFG_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (MCU_PBCFG_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Mcu_PBcfg.c and Mcu.h files */
+#if ((MCU_PBCFG_SW_MAJOR_VERSION != MCU_SW_MAJOR_VERSION)\
+ ||  (MCU_PBCFG_SW_MINOR_VERSION != MCU_SW_MINOR_VERSION)\
+ ||  (MCU_PBCFG_SW_PATCH_VERSION != MCU_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* PB structure used with Mcu_Init API */
+const Mcu_ConfigType Mcu_Configuration = {
+        /* 400 MHz PLL divided by 5 */
+        TRUE,  4, McuConf_CLOCK_PLL_80MHZ_FREQUENCY,
+        /* 16 MHz main oscillator without divider */
+        FALSE, 0, McuConf_CLOCK_MOSC_16MHZ_FREQUENCY
+};
@@ -11,25 +11,337 @@
 
 #include "Os.h"
 #include "App.h"
-#include "Button.h"
-#include "Led.h"
 #include "Gpt.h"
+#include "Cpu.h"
+#include "Os_Trace.h"
+#include "Os_Timer.h"
+#if (OS_PREEMPTIVE == STD_ON)
+#include "tm4c123gh6pm_registers.h"
+#endif
 
+#ifdef HOST_BUILD
+/* The host simulation calls the timer ISR synchronously from Os_IdleHook ... no interrupts to mask */
+#define Enable_Interrupts()
+#define Disable_Interrupts()
+#else
 /* Enable IRQ Interrupts ... This Macro enables IRQ interrupts by clearing the I-bit in the PRIMASK. */
 #define Enable_Interrupts()    __asm("CPSIE I")
 
 /* Disable IRQ Interrupts ... This Macro disables IRQ interrupts by setting the I-bit in the PRIMASK. */
 #define Disable_Interrupts()   __asm("CPSID I")
+#endif
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+/* Global variable store the Os Time in ticks ... only written by the timer ISR */
+static volatile Os_TickType g_Time_Tick_Count = 0;
 
-/* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+/* Global variable store how many times g_Time_Tick_Count wrapped around ... only written by the timer ISR */
+static volatile uint32 g_Time_Tick_Epoch = 0;
+
+/* Global variable store the number of ticks already dispatched by the scheduler */
+static Os_TickType g_Dispatched_Tick_Count = 0;
+
+/* Global variable store the number of ticks dispatched late or dropped by the scheduler */
+static volatile uint32 g_Missed_Tick_Count = 0;
+
+/* Global variable set by Os_Shutdown to make Os_Scheduler return */
+static volatile boolean g_Shutdown_Request = FALSE;
+
+/* Description: Run time data of each Os task */
+typedef struct
+{
+    Os_TickType countdown;     /* Ticks left to the next activation */
+    Os_TickType period_ticks;  /* Activation period in ticks, 0 for a task activated only by events */
+#if (OS_EVENT_API == STD_ON)
+    volatile Os_EventMaskType events; /* Events set and not cleared yet */
+#endif
+#if (OS_BUDGET_MONITOR == STD_ON)
+    Os_TickType budget_ticks;  /* Budget rounded up to whole ticks plus the partial tick of the start */
+    volatile uint32 budget_overruns; /* Activations found running after their budget */
+#if (OS_PREEMPTIVE == STD_ON)
+    Os_TickType deadline;      /* Budget end of the current activation, restored when the task is switched in */
+#endif
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_SKIP_NEXT)
+    volatile boolean skip_next; /* Drop the next periodic activation after an overrun */
+#endif
+#endif
+#if (OS_PROFILING_API == STD_ON)
+    uint32 budget_cycles;      /* Execution time budget in profiling clock counts */
+    uint64 total_cycles;       /* Sum of the execution times of all the timed activations */
+    Os_TaskStatsType stats;
+#endif
+}Os_TaskStateType;
+
+/* Global array store the run time data of each Os task */
+static Os_TaskStateType g_Task_State[OS_TASKS_NUM];
+
+#if (OS_EVENT_API == STD_ON)
+/* Tasks activated by Os_SetEvent and not started yet ... bit n for the task id n */
+static volatile uint32 g_Event_Pending = 0;
+
+#define OS_TASK_BIT(TASK_ID)            (1UL << (TASK_ID))
+#endif
+
+#if (OS_BUDGET_MONITOR == STD_ON)
+/* Budget end of the running task ... compared with g_Time_Tick_Count by the timer ISR */
+static volatile Os_TickType g_Budget_Deadline = 0xFFFFFFFF;
+
+/* Task owning g_Budget_Deadline */
+static volatile Os_TaskType g_Budget_Task = 0;
+
+/* Deadline of no task ... the tick counter reaches it only after wrapping around, 2^32 ticks later */
+#define OS_BUDGET_DISARMED()            (g_Time_Tick_Count - 1U)
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* PendSV gets the lowest priority so the context switch runs once all the ISRs are completed */
+#define OS_PENDSV_PRIORITY_MASK         0xFF1FFFFF
+#define OS_PENDSV_INTERRUPT_PRIORITY    7
+#define OS_PENDSV_PRIORITY_BITS_POS     21
+
+/* PENDSVSET bit in the Interrupt Control and State Register */
+#define OS_PENDSV_SET_MASK              0x10000000
+
+/* Initial xPSR of a new thread ... only the Thumb bit is set */
+#define OS_INITIAL_XPSR                 0x01000000
+
+/* Initial EXC_RETURN of a new thread ... return to Thread mode on the PSP without FPU context */
+#define OS_INITIAL_EXC_RETURN           0xFFFFFFFD
+
+/* Request a context switch ... PendSV_Handler runs once no other ISR is active */
+#define Os_RequestSwitch()              (NVIC_INT_CTRL_REG = OS_PENDSV_SET_MASK)
+
+/* Description: Control block of a thread in the preemptive kernel */
+typedef struct
+{
+    uint32 * sp;               /* Saved stack pointer ... must stay the first member, PendSV_Handler uses offset 0 */
+    Os_TaskType task_id;       /* Task index in Os_Configuration, OS_TASKS_NUM for the idle thread */
+    uint8 priority;            /* Rate monotonic priority, 0 is the highest one */
+}Os_TcbType;
+
+/* Bit of a priority in g_Ready_Bitmap ... priority 0 is bit 31 so the leading zeros count is the priority */
+#define OS_PRIORITY_BIT(PRIORITY)       (0x80000000U >> (PRIORITY))
+
+/* Control blocks of the tasks and of the idle thread */
+static Os_TcbType g_Task_Tcb[OS_TASKS_NUM];
+static Os_TcbType g_Idle_Tcb;
+
+/* Task ids sorted by priority ... g_Priority_Order[0] is the highest priority task */
+static Os_TaskType g_Priority_Order[OS_TASKS_NUM];
+
+/* Ready set ... one bit for every task activated and not completed yet, see OS_PRIORITY_BIT */
+static volatile uint32 g_Ready_Bitmap = 0;
+
+/* Set by Os_Scheduler once the Init Task completed and cleared on the return after Os_Shutdown ...
+ * no task is activated and no context switch is requested while it is FALSE */
+static volatile boolean g_Os_Started = FALSE;
+
+/* Thread stacks ... the uint64 elements keep them 8-byte aligned as required by the AAPCS */
+static uint64 g_Task_Stack[OS_TASKS_NUM][OS_TASK_STACK_SIZE / 8];
+static uint64 g_Idle_Stack[OS_IDLE_STACK_SIZE / 8];
+
+/* Running thread and thread to be switched in ... used by PendSV_Handler in Os_Switch.s */
+Os_TcbType * volatile Os_CurrentTcb = NULL_PTR;
+Os_TcbType * volatile Os_NextTcb = NULL_PTR;
+
+static void Os_InitThreads(void);
+static void Os_ActivateTasks(void);
+static void Os_Schedule(void);
+#endif /* (OS_PREEMPTIVE == STD_ON) */
+
+#if (OS_CPU_LOAD_API == STD_ON)
+/* Number of the ticks in one hyperperiod */
+#define OS_HYPERPERIOD_TICKS        (OS_HYPERPERIOD / OS_BASE_TIME)
+
+/* Number of the cycle counter counts in one tick */
+#define OS_TICK_CYCLES              ((CPU_CYCLE_COUNTER_FREQUENCY_HZ / 1000U) * OS_BASE_TIME)
+
+/* Description: Measurement data of the CPU load monitor ... only accessed by the scheduler */
+typedef struct
+{
+    uint32 window_start;       /* Cycle counter value at the start of the current hyperperiod */
+    uint32 busy_start;         /* Cycle counter value when the scheduler left the idle loop */
+    uint32 idle_start;         /* Cycle counter value when the scheduler entered the idle loop */
+    uint32 idle_cycles;        /* Idle time accumulated in the current hyperperiod */
+    uint32 peak_tick_cycles;   /* Longest tick dispatch in the current hyperperiod */
+#if (OS_PREEMPTIVE == STD_ON)
+    uint32 tick_start;         /* Cycle counter value at the last timer tick */
+    uint32 tick_idle_cycles;   /* Idle time accumulated since the last timer tick */
+    boolean idle;              /* The idle thread is selected to run */
+#endif
+    Os_TickType window_ticks;  /* Ticks dispatched in the current hyperperiod */
+    uint16 history[OS_CPU_LOAD_WINDOW]; /* Load of the last hyperperiods for the sliding average */
+    uint32 history_sum;
+    uint8 history_index;
+    Os_CpuLoadType result;     /* Latest figures, copied to g_Cpu_Load_Published at the end of every hyperperiod */
+}Os_CpuLoadStateType;
+
+static Os_CpuLoadStateType g_Cpu_Load;
+
+/*
+ * Double buffer of the published figures: the scheduler writes the buffer not selected by
+ * g_Cpu_Load_Sequence then increments it. A reader retries in case the sequence changed while copying,
+ * so a reader never waits for the scheduler and a higher priority reader never blocks it.
+ */
+static Os_CpuLoadType g_Cpu_Load_Published[2];
+static volatile uint32 g_Cpu_Load_Sequence = 0;
+#endif /* (OS_CPU_LOAD_API == STD_ON) */
+
+#if (OS_PROFILING_API == STD_ON)
+#if (OS_PROFILING_CLOCK == OS_PROFILING_CLOCK_SYSTICK)
+#ifdef HOST_BUILD
+  #error "The SysTick profiling clock is not available in HOST_BUILD"
+#endif
+
+/* PENDSTSET bit in the Interrupt Control and State Register ... the SysTick interrupt is pending */
+#define OS_PENDSTSET_MASK               0x04000000
+
+/* Profiling clock in System clock cycles built from the Os ticks and the SysTick down counter */
+static uint32 Os_GetProfilingTime(void)
+{
+    Os_TickType ticks;
+    uint32 current;
+    uint32 pending;
+    uint32 reload = SysTick_GetReloadValue();
+
+    /* Read again in case the timer ISR counted a new tick between the reads */
+    do
+    {
+        ticks   = g_Time_Tick_Count;
+        current = SysTick_GetCurrentValue();
+        pending = NVIC_INT_CTRL_REG & OS_PENDSTSET_MASK;
+    } while(ticks != g_Time_Tick_Count);
+
+    /* The counter wrapped but its ISR has not counted the tick yet, it is masked or still being entered.
+     * The wrap belongs to this read only if the counter was read after it, right after its reload */
+    if((pending != 0) && (current > (reload / 2U)))
+    {
+        ticks++;
+    }
+
+    return (ticks * (reload + 1)) + (reload - current);
+}
+#else
+/* Profiling clock in core clock cycles */
+#define Os_GetProfilingTime()    Cpu_GetCycleCount()
+#endif
+#endif /* (OS_PROFILING_API == STD_ON) */
+
+#if (OS_BUDGET_MONITOR == STD_ON)
+/*********************************************************************************************/
+static void Os_BudgetOverrun(void)
+{
+    Os_TaskType task_id = g_Budget_Task;
+
+    /* Counted once per activation ... the deadline is reached again only after the tick counter wraps */
+    g_Task_State[task_id].budget_overruns++;
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_SKIP_NEXT)
+    /* The task cannot be stopped ... give its next period to the other tasks */
+    g_Task_State[task_id].skip_next = TRUE;
+#elif (OS_OVERRUN_POLICY == OS_OVERRUN_HOOK)
+    Os_OverrunHook(task_id);
+#endif
+}
+
+/*********************************************************************************************/
+static void Os_BudgetStart(Os_TaskType TaskId)
+{
+    Cpu_StateType state;
+    Os_TickType deadline;
+
+    /* The task id and its deadline change together for the timer ISR */
+    state = Cpu_EnterCritical();
+    deadline = g_Time_Tick_Count + g_Task_State[TaskId].budget_ticks;
+#if (OS_PREEMPTIVE == STD_ON)
+    g_Task_State[TaskId].deadline = deadline;
+#endif
+    g_Budget_Task     = TaskId;
+    g_Budget_Deadline = deadline;
+    Cpu_ExitCritical(state);
+}
+
+/*********************************************************************************************/
+static void Os_BudgetStop(Os_TaskType TaskId)
+{
+    Cpu_StateType state;
+
+    state = Cpu_EnterCritical();
+#if (OS_PREEMPTIVE == STD_ON)
+    g_Task_State[TaskId].deadline = OS_BUDGET_DISARMED();
+#else
+    (void)TaskId;
+#endif
+    g_Budget_Deadline = OS_BUDGET_DISARMED();
+    Cpu_ExitCritical(state);
+}
+
+/*********************************************************************************************/
+uint32 Os_GetBudgetOverruns(Os_TaskType TaskId)
+{
+    uint32 overruns = 0;
+
+    if(TaskId < OS_TASKS_NUM)
+    {
+        overruns = g_Task_State[TaskId].budget_overruns;
+    }
+    return overruns;
+}
+#endif /* (OS_BUDGET_MONITOR == STD_ON) */
 
 /*********************************************************************************************/
 void Os_start(void)
 {
+    Os_TaskType task_id;
+
+    /* Every task is activated for the first time after one period */
+    for(task_id = 0; task_id < OS_TASKS_NUM; task_id++)
+    {
+        g_Task_State[task_id].period_ticks = Os_Configuration.Task[task_id].period / OS_BASE_TIME;
+        g_Task_State[task_id].countdown    = g_Task_State[task_id].period_ticks;
+#if (OS_EVENT_API == STD_ON)
+        g_Task_State[task_id].events       = 0;
+#endif
+#if (OS_BUDGET_MONITOR == STD_ON)
+        /* A task starts anywhere in a tick ... one more tick so it always gets its full budget */
+        g_Task_State[task_id].budget_ticks = ((Os_Configuration.Task[task_id].budget + (OS_BASE_TIME * 1000U) - 1U) /
+                                              (OS_BASE_TIME * 1000U)) + 1U;
+        g_Task_State[task_id].budget_overruns = 0;
+#if (OS_PREEMPTIVE == STD_ON)
+        g_Task_State[task_id].deadline     = 0xFFFFFFFF;
+#endif
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_SKIP_NEXT)
+        g_Task_State[task_id].skip_next    = FALSE;
+#endif
+#endif
+#if (OS_PROFILING_API == STD_ON)
+        g_Task_State[task_id].budget_cycles = CPU_US_TO_CYCLES(Os_Configuration.Task[task_id].budget);
+#endif
+    }
+
+#if (OS_PREEMPTIVE == STD_ON)
+    Os_InitThreads();
+
+    /* Assign the lowest priority to PendSV before the first tick can request a context switch */
+    NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG & OS_PENDSV_PRIORITY_MASK) | (OS_PENDSV_INTERRUPT_PRIORITY << OS_PENDSV_PRIORITY_BITS_POS);
+#endif
+
+#if (((OS_PROFILING_API == STD_ON) && (OS_PROFILING_CLOCK == OS_PROFILING_CLOCK_DWT)) || \
+     (OS_TRACE_API == STD_ON) || (OS_CPU_LOAD_API == STD_ON))
+    Cpu_InitCycleCounter();
+#endif
+
+#if (OS_PROFILING_API == STD_ON)
+    Os_ResetTaskStats();
+#endif
+
+#if (OS_TRACE_API == STD_ON)
+    Os_TraceInit();
+#endif
+
+#if (OS_TIMER_API == STD_ON)
+    Os_TimerInit();
+#endif
+
     /* Global Interrupts Enable */
     Enable_Interrupts();
     
@@ -42,9 +354,18 @@ void Os_start(void)
     /* Start SysTickTimer to generate interrupt every 20ms */
     SysTick_Start(OS_BASE_TIME);
 
-    /* Execute the Init Task */
+    /* Execute the Init Task ... the ticks counted meanwhile activate no task */
     Init_Task();
 
+#if (OS_CPU_LOAD_API == STD_ON)
+    /* The first hyperperiod is measured from here, the Init Task is not counted */
+    g_Cpu_Load.window_start = Cpu_GetCycleCount();
+    g_Cpu_Load.idle_start   = g_Cpu_Load.window_start;
+#if (OS_PREEMPTIVE == STD_ON)
+    g_Cpu_Load.tick_start   = g_Cpu_Load.window_start;
+#endif
+#endif
+
     /* Start the Os Scheduler */
     Os_Scheduler();
 }
@@ -52,49 +373,783 @@ void Os_start(void)
 /*********************************************************************************************/
 void Os_NewTimerTick(void)
 {
-    /* Increment the Os time by OS_BASE_TIME */
-    g_Time_Tick_Count   += OS_BASE_TIME;
+    OS_TRACE_TICK_ISR();
 
-    /* Set the flag to 1 to indicate that there is a new timer tick */
-    g_New_Time_Tick_Flag = 1;
+    /* Count the new tick ... the scheduler dispatches all the pending ticks */
+    g_Time_Tick_Count++;
+
+    /* Extend the time base once the tick counter wraps around */
+    if(g_Time_Tick_Count == 0)
+    {
+        g_Time_Tick_Epoch++;
+    }
+
+#if (OS_BUDGET_MONITOR == STD_ON)
+    /* The running task reached the tick of its budget end */
+    if(g_Time_Tick_Count == g_Budget_Deadline)
+    {
+        Os_BudgetOverrun();
+    }
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Activate the tasks in the ISR ... the switch to a higher priority task happens on exit */
+    if(g_Os_Started)
+    {
+        Os_ActivateTasks();
+    }
+#endif
 }
 
 /*********************************************************************************************/
-void Os_Scheduler(void)
+void Os_Shutdown(void)
+{
+#if (OS_PREEMPTIVE == STD_ON)
+    Cpu_StateType state = Cpu_EnterCritical();
+
+    /* Return to Os_Scheduler at once if no task is ready, else once the ready tasks completed */
+    g_Shutdown_Request = TRUE;
+    Os_Schedule();
+    Cpu_ExitCritical(state);
+#else
+    g_Shutdown_Request = TRUE;
+#endif
+}
+
+/*********************************************************************************************/
+Os_TickType Os_GetTickCount(void)
+{
+    return g_Time_Tick_Count;
+}
+
+/*********************************************************************************************/
+Os_TimeType Os_GetTime(void)
+{
+    uint32 epoch;
+    Os_TickType ticks;
+
+    /* Read again in case the timer ISR wrapped the tick counter between the two reads */
+    do
+    {
+        epoch = g_Time_Tick_Epoch;
+        ticks = g_Time_Tick_Count;
+    } while(epoch != g_Time_Tick_Epoch);
+
+    return ((((Os_TimeType)epoch) << 32) | ticks) * OS_BASE_TIME;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetMissedTicks(void)
+{
+    return g_Missed_Tick_Count;
+}
+
+#if (OS_PROFILING_API == STD_ON)
+/*********************************************************************************************/
+Std_ReturnType Os_GetTaskStats(Os_TaskType TaskId, Os_TaskStatsType * Stats)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((TaskId < OS_TASKS_NUM) && (NULL_PTR != Stats))
+    {
+        *Stats = g_Task_State[TaskId].stats;
+        if(Stats->activations > 0)
+        {
+            Stats->mean = (uint32)(g_Task_State[TaskId].total_cycles / Stats->activations);
+        }
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+void Os_ResetTaskStats(void)
+{
+    Os_TaskType task_id;
+
+    for(task_id = 0; task_id < OS_TASKS_NUM; task_id++)
+    {
+        g_Task_State[task_id].total_cycles      = 0;
+        g_Task_State[task_id].stats.min         = 0xFFFFFFFF;
+        g_Task_State[task_id].stats.max         = 0;
+        g_Task_State[task_id].stats.mean        = 0;
+        g_Task_State[task_id].stats.last        = 0;
+        g_Task_State[task_id].stats.activations = 0;
+        g_Task_State[task_id].stats.overruns    = 0;
+    }
+}
+
+/*********************************************************************************************/
+static void Os_UpdateTaskStats(Os_TaskType TaskId, uint32 Cycles)
+{
+    Os_TaskStateType * task = &g_Task_State[TaskId];
+
+    task->stats.last = Cycles;
+    task->stats.activations++;
+    task->total_cycles += Cycles;
+    if(Cycles < task->stats.min)
+    {
+        task->stats.min = Cycles;
+    }
+    if(Cycles > task->stats.max)
+    {
+        task->stats.max = Cycles;
+    }
+    if(Cycles > task->budget_cycles)
+    {
+        task->stats.overruns++;
+    }
+}
+#endif /* (OS_PROFILING_API == STD_ON) */
+
+#if (OS_CPU_LOAD_API == STD_ON)
+/*********************************************************************************************/
+Std_ReturnType Os_GetCpuLoad(Os_CpuLoadType * Load)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 sequence;
+
+    if(NULL_PTR != Load)
+    {
+        /* Copy again in case the scheduler published new figures during the copy,
+         * the barriers keep the copy between the two reads of the sequence */
+        do
+        {
+            sequence = g_Cpu_Load_Sequence;
+            Cpu_DataMemoryBarrier();
+            *Load = g_Cpu_Load_Published[sequence & 1U];
+            Cpu_DataMemoryBarrier();
+        } while(sequence != g_Cpu_Load_Sequence);
+        ret = E_OK;
+    }
+    return ret;
+}
+
+#if (OS_PREEMPTIVE == STD_OFF)
+/*********************************************************************************************/
+static void Os_CpuLoadBusyStart(void)
+{
+    g_Cpu_Load.busy_start   = Cpu_GetCycleCount();
+    g_Cpu_Load.idle_cycles += g_Cpu_Load.busy_start - g_Cpu_Load.idle_start;
+}
+#endif
+
+/*********************************************************************************************/
+static void Os_CpuLoadAccount(uint32 Now, uint32 BusyCycles)
+{
+    Os_CpuLoadStateType * monitor = &g_Cpu_Load;
+    uint32 elapsed_cycles;
+    uint32 peak;
+    uint16 load;
+
+    if(BusyCycles > monitor->peak_tick_cycles)
+    {
+        monitor->peak_tick_cycles = BusyCycles;
+    }
+
+    /* Close the measurement once a complete hyperperiod is dispatched */
+    monitor->window_ticks++;
+    if(monitor->window_ticks >= OS_HYPERPERIOD_TICKS)
+    {
+        elapsed_cycles = Now - monitor->window_start;
+        load = 0;
+        if((elapsed_cycles > 0) && (monitor->idle_cycles < elapsed_cycles))
+        {
+            load = (uint16)(((uint64)(elapsed_cycles - monitor->idle_cycles) * 1000U) / elapsed_cycles);
+        }
+
+        /* Sliding average over the last OS_CPU_LOAD_WINDOW hyperperiods */
+        monitor->history_sum -= monitor->history[monitor->history_index];
+        monitor->history_sum += load;
+        monitor->history[monitor->history_index] = load;
+        monitor->history_index = (uint8)((monitor->history_index + 1U) % OS_CPU_LOAD_WINDOW);
+
+        peak = (uint32)(((uint64)monitor->peak_tick_cycles * 1000U) / OS_TICK_CYCLES);
+        if(peak > 0xFFFF)
+        {
+            peak = 0xFFFF;
+        }
+
+        monitor->result.load = load;
+        monitor->result.hyperperiods++;
+        monitor->result.average = (uint16)(monitor->history_sum /
+            ((monitor->result.hyperperiods < OS_CPU_LOAD_WINDOW) ? monitor->result.hyperperiods : OS_CPU_LOAD_WINDOW));
+        monitor->result.peak_tick = (uint16)peak;
+        if(monitor->result.peak_tick > monitor->result.peak_tick_max)
+        {
+            monitor->result.peak_tick_max = monitor->result.peak_tick;
+        }
+
+        /* Publish in the buffer the readers are not using then switch them to it */
+        g_Cpu_Load_Published[(g_Cpu_Load_Sequence + 1U) & 1U] = monitor->result;
+        g_Cpu_Load_Sequence++;
+
+        monitor->window_start     = Now;
+        monitor->idle_cycles      = 0;
+        monitor->peak_tick_cycles = 0;
+        monitor->window_ticks     = 0;
+    }
+}
+
+#if (OS_PREEMPTIVE == STD_ON)
+/*********************************************************************************************/
+static void Os_CpuLoadIdleEnter(void)
+{
+    g_Cpu_Load.idle_start = Cpu_GetCycleCount();
+    g_Cpu_Load.idle       = TRUE;
+}
+
+/*********************************************************************************************/
+static void Os_CpuLoadIdleExit(void)
+{
+    uint32 idle_cycles = Cpu_GetCycleCount() - g_Cpu_Load.idle_start;
+
+    g_Cpu_Load.idle_cycles      += idle_cycles;
+    g_Cpu_Load.tick_idle_cycles += idle_cycles;
+    g_Cpu_Load.idle              = FALSE;
+}
+
+/*********************************************************************************************/
+static void Os_CpuLoadTick(void)
+{
+    Os_CpuLoadStateType * monitor = &g_Cpu_Load;
+    uint32 now = Cpu_GetCycleCount();
+    uint32 busy_cycles;
+
+    /* Account the idle time up to this tick in case the idle thread is running */
+    if(monitor->idle)
+    {
+        monitor->idle_cycles      += now - monitor->idle_start;
+        monitor->tick_idle_cycles += now - monitor->idle_start;
+        monitor->idle_start        = now;
+    }
+
+    /* The busy time of the last tick is its duration less the time spent in the idle thread */
+    busy_cycles = (now - monitor->tick_start) - monitor->tick_idle_cycles;
+    monitor->tick_start       = now;
+    monitor->tick_idle_cycles = 0;
+
+    Os_CpuLoadAccount(now, busy_cycles);
+}
+#else
+/*********************************************************************************************/
+static void Os_CpuLoadBusyEnd(void)
 {
+    uint32 now = Cpu_GetCycleCount();
+
+    g_Cpu_Load.idle_start = now;
+    Os_CpuLoadAccount(now, now - g_Cpu_Load.busy_start);
+}
+#endif /* (OS_PREEMPTIVE == STD_ON) */
+#endif /* (OS_CPU_LOAD_API == STD_ON) */
+
+/*********************************************************************************************/
+static void Os_RunTask(Os_TaskType TaskId)
+{
+#if (OS_PROFILING_API == STD_ON)
+    uint32 start_time;
+#endif
+
+#if (OS_EVENT_API == STD_ON)
+    Cpu_StateType state;
+
+    /* This activation handles all the events set so far ... a new Os_SetEvent activates the task again */
+    state = Cpu_EnterCritical();
+    g_Event_Pending &= ~OS_TASK_BIT(TaskId);
+    Cpu_ExitCritical(state);
+#endif
+
+    OS_TRACE_TASK_START(TaskId);
+
+#if (OS_BUDGET_MONITOR == STD_ON)
+    Os_BudgetStart(TaskId);
+#endif
+
+#if (OS_PROFILING_API == STD_ON)
+    start_time = Os_GetProfilingTime();
+#endif
+
+    Os_Configuration.Task[TaskId].Task_Ptr();
+
+#if (OS_POST_TASK_HOOK == STD_ON)
+    Os_PostTaskHook(TaskId);
+#endif
+
+#if (OS_PROFILING_API == STD_ON)
+    Os_UpdateTaskStats(TaskId, Os_GetProfilingTime() - start_time);
+#endif
+
+#if (OS_BUDGET_MONITOR == STD_ON)
+    Os_BudgetStop(TaskId);
+#endif
+
+    OS_TRACE_TASK_STOP(TaskId);
+}
+
+#if (OS_PREEMPTIVE == STD_ON)
+/*********************************************************************************************/
+static void Os_Schedule(void)
+{
+    Os_TcbType * next = &g_Idle_Tcb;
+    uint8 priority;
+
+    if(FALSE == g_Os_Started)
+    {
+        /* The Init Task is running or the Os is shut down ... no context switch, Os_Scheduler switches to the first thread */
+        return;
+    }
+
+    /* Select the highest priority ready task in constant time, the idle thread runs when no task is ready */
+    priority = Cpu_CountLeadingZeros(g_Ready_Bitmap);
+    if(priority < OS_TASKS_NUM)
+    {
+        next = &g_Task_Tcb[g_Priority_Order[priority]];
+    }
+    else if(g_Shutdown_Request)
+    {
+        /* No task left after Os_Shutdown ... PendSV_Handler returns to Os_Scheduler on the main stack */
+        next = NULL_PTR;
+        g_Os_Started = FALSE;
+    }
+    else
+    {
+        /* No task ready ... the idle thread runs */
+    }
+
+    if(next != Os_NextTcb)
+    {
+#if (OS_CPU_LOAD_API == STD_ON)
+        if((next == &g_Idle_Tcb) || (next == NULL_PTR))
+        {
+            Os_CpuLoadIdleEnter();
+        }
+        else if(Os_NextTcb == &g_Idle_Tcb)
+        {
+            Os_CpuLoadIdleExit();
+        }
+        else
+        {
+            /* Switch between two tasks ... no change in the idle time */
+        }
+#endif
+#if (OS_BUDGET_MONITOR == STD_ON)
+        /* Monitor the budget of the thread switched in ... a preempted task is checked again once it resumes */
+        if((next == &g_Idle_Tcb) || (next == NULL_PTR))
+        {
+            g_Budget_Deadline = OS_BUDGET_DISARMED();
+        }
+        else
+        {
+            g_Budget_Task     = next->task_id;
+            g_Budget_Deadline = g_Task_State[next->task_id].deadline;
+        }
+#endif
+        Os_NextTcb = next;
+    }
+
+    if(next != Os_CurrentTcb)
+    {
+        Os_RequestSwitch();
+    }
+}
+
+/*********************************************************************************************/
+static void Os_ActivateTasks(void)
+{
+    Os_TaskType task_id;
+
+    g_Dispatched_Tick_Count++;
+
+    for(task_id = 0; task_id < OS_TASKS_NUM; task_id++)
+    {
+        if(g_Task_State[task_id].period_ticks == 0)
+        {
+            /* Task activated only by events */
+        }
+        else if(--g_Task_State[task_id].countdown == 0)
+        {
+            g_Task_State[task_id].countdown = g_Task_State[task_id].period_ticks;
+            if(g_Ready_Bitmap & OS_PRIORITY_BIT(g_Task_Tcb[task_id].priority))
+            {
+                /* The previous activation is still running ... drop this one */
+                g_Missed_Tick_Count++;
+            }
+#if ((OS_BUDGET_MONITOR == STD_ON) && (OS_OVERRUN_POLICY == OS_OVERRUN_SKIP_NEXT))
+            else if(g_Task_State[task_id].skip_next)
+            {
+                /* The previous activation overran its budget */
+                g_Task_State[task_id].skip_next = FALSE;
+            }
+#endif
+            else
+            {
+                g_Ready_Bitmap |= OS_PRIORITY_BIT(g_Task_Tcb[task_id].priority);
+            }
+        }
+    }
+
+#if (OS_CPU_LOAD_API == STD_ON)
+    Os_CpuLoadTick();
+#endif
+
+    Os_Schedule();
+}
+
+/*********************************************************************************************/
+static void Os_TaskEntry(uint32 TaskId)
+{
+    Cpu_StateType state;
+
+    for(;;)
+    {
+        Os_RunTask((Os_TaskType)TaskId);
+
+        /* Terminate the activation ... PendSV switches to the next thread once the interrupts are restored */
+        state = Cpu_EnterCritical();
+#if (OS_EVENT_API == STD_ON)
+        /* Stay ready in case an event was set while running */
+        if((g_Event_Pending & OS_TASK_BIT(TaskId)) == 0)
+#endif
+        {
+            g_Ready_Bitmap &= ~OS_PRIORITY_BIT(g_Task_Tcb[TaskId].priority);
+        }
+        Os_Schedule();
+        Cpu_ExitCritical(state);
+    }
+}
+
+/*********************************************************************************************/
+static void Os_IdleThread(uint32 Unused)
+{
+    (void)Unused;
+
+    for(;;)
+    {
+#if (OS_IDLE_HOOK == STD_ON)
+        Os_IdleHook();
+#endif
+    }
+}
+
+/*********************************************************************************************/
+static void Os_ThreadExit(void)
+{
+    /* A thread function never returns ... trap a corrupted stack here */
     while(1)
     {
-	/* Code is only executed in case there is a new timer tick */
-	if(g_New_Time_Tick_Flag == 1)
-	{
-	    switch(g_Time_Tick_Count)
+    }
+}
+
+/*********************************************************************************************/
+static void Os_InitStack(Os_TcbType * Tcb, uint64 * Stack, uint32 Size, void (*Entry)(uint32), uint32 Arg)
+{
+    uint32 * sp = (uint32 *)&Stack[Size / 8];
+    uint8 reg;
+
+    /* Exception frame popped by the hardware on the first exception return to the thread */
+    *(--sp) = OS_INITIAL_XPSR;
+    *(--sp) = ((uint32)Entry) & 0xFFFFFFFE;   /* PC */
+    *(--sp) = (uint32)Os_ThreadExit;         /* LR */
+    *(--sp) = 0;                             /* R12 */
+    *(--sp) = 0;                             /* R3 */
+    *(--sp) = 0;                             /* R2 */
+    *(--sp) = 0;                             /* R1 */
+    *(--sp) = Arg;                           /* R0 */
+
+    /* Frame popped by PendSV_Handler ... EXC_RETURN then R11 down to R4 */
+    *(--sp) = OS_INITIAL_EXC_RETURN;
+    for(reg = 4; reg <= 11; reg++)
+    {
+        *(--sp) = 0;
+    }
+
+    Tcb->sp = sp;
+}
+
+/*********************************************************************************************/
+static boolean Os_TaskPrecedes(Os_TaskType TaskId, Os_TaskType OtherId)
+{
+    uint16 period = Os_Configuration.Task[TaskId].period;
+    uint16 other_period = Os_Configuration.Task[OtherId].period;
+    boolean precedes;
+
+    if(period == other_period)
+    {
+        precedes = (TaskId < OtherId);
+    }
+    else if(period == 0)
+    {
+        precedes = FALSE;
+    }
+    else if(other_period == 0)
+    {
+        precedes = TRUE;
+    }
+    else
+    {
+        precedes = (period < other_period);
+    }
+    return precedes;
+}
+
+/*********************************************************************************************/
+static void Os_InitThreads(void)
+{
+    Os_TaskType task_id;
+    Os_TaskType other_id;
+    uint8 priority;
+
+    for(task_id = 0; task_id < OS_TASKS_NUM; task_id++)
+    {
+        /* Rate monotonic order: a shorter period gets a higher priority, equal periods keep the configuration order
+         * and the tasks activated only by events come after the periodic ones */
+        priority = 0;
+        for(other_id = 0; other_id < OS_TASKS_NUM; other_id++)
+        {
+            if(Os_TaskPrecedes(other_id, task_id))
+            {
+                priority++;
+            }
+        }
+
+        g_Task_Tcb[task_id].task_id  = task_id;
+        g_Task_Tcb[task_id].priority = priority;
+        g_Priority_Order[priority]   = task_id;
+        Os_InitStack(&g_Task_Tcb[task_id], g_Task_Stack[task_id], OS_TASK_STACK_SIZE, Os_TaskEntry, task_id);
+    }
+
+    g_Idle_Tcb.task_id  = OS_TASKS_NUM;
+    g_Idle_Tcb.priority = OS_TASKS_NUM;
+    Os_InitStack(&g_Idle_Tcb, g_Idle_Stack, OS_IDLE_STACK_SIZE, Os_IdleThread, 0);
+
+    g_Ready_Bitmap = 0;
+    Os_CurrentTcb  = NULL_PTR;
+    Os_NextTcb     = NULL_PTR;
+}
+#endif /* (OS_PREEMPTIVE == STD_ON) */
+
+#if (OS_PREEMPTIVE == STD_OFF)
+/*********************************************************************************************/
+static void Os_DispatchTick(void)
+{
+    Os_TaskType task_id;
+    boolean activate;
+
+    g_Dispatched_Tick_Count++;
+
+#if (OS_TIMER_API == STD_ON)
+    /* Expire the software timers before the tasks of this tick ... skipped ticks are processed here as well */
+    Os_TimerProcess(g_Dispatched_Tick_Count);
+#endif
+
+    /* Run every task which period elapsed in the configuration order */
+    for(task_id = 0; task_id < OS_TASKS_NUM; task_id++)
+    {
+        activate = FALSE;
+        if(g_Task_State[task_id].period_ticks == 0)
+        {
+            /* Task activated only by events */
+        }
+        else if(--g_Task_State[task_id].countdown == 0)
+        {
+            g_Task_State[task_id].countdown = g_Task_State[task_id].period_ticks;
+            activate = TRUE;
+#if ((OS_BUDGET_MONITOR == STD_ON) && (OS_OVERRUN_POLICY == OS_OVERRUN_SKIP_NEXT))
+            if(g_Task_State[task_id].skip_next)
             {
-		case 20:
-		case 100:
-			    Button_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 40:
-		case 80:
-			    Button_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 60:
-			    Button_Task();
-			    App_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 120:
-			    Button_Task();
-			    App_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    g_Time_Tick_Count = 0;
-			    break;
+                /* The previous activation overran its budget */
+                g_Task_State[task_id].skip_next = FALSE;
+                activate = FALSE;
             }
+#endif
+        }
+#if (OS_EVENT_API == STD_ON)
+        /* An event set by an ISR or by a task earlier in this dispatch activates the task in the same pass */
+        if(g_Event_Pending & OS_TASK_BIT(task_id))
+        {
+            activate = TRUE;
+        }
+#endif
+        if(activate)
+        {
+            Os_RunTask(task_id);
+        }
+    }
+}
+
+#if (OS_EVENT_API == STD_ON)
+/*********************************************************************************************/
+static void Os_DispatchEvents(void)
+{
+    Os_TaskType task_id;
+
+    /* Run every task activated by an event in the configuration order */
+    for(task_id = 0; task_id < OS_TASKS_NUM; task_id++)
+    {
+        if(g_Event_Pending & OS_TASK_BIT(task_id))
+        {
+            Os_RunTask(task_id);
+        }
+    }
+}
+#endif
+#endif /* (OS_PREEMPTIVE == STD_OFF) */
+
+#if (OS_MISSED_TICK_POLICY == OS_MISSED_TICK_SKIP)
+/*********************************************************************************************/
+static void Os_SkipTicks(Os_TickType Ticks)
+{
+    Os_TaskType task_id;
+    Os_TaskStateType * task;
+
+    g_Dispatched_Tick_Count += Ticks;
+
+    /* Move every task countdown as if the skipped ticks were dispatched without running the tasks */
+    for(task_id = 0; task_id < OS_TASKS_NUM; task_id++)
+    {
+        task = &g_Task_State[task_id];
+        if(task->period_ticks == 0)
+        {
+            /* Task activated only by events */
+        }
+        else if(task->countdown > Ticks)
+        {
+            task->countdown -= Ticks;
+        }
+        else
+        {
+            task->countdown = task->period_ticks - ((Ticks - task->countdown) % task->period_ticks);
+        }
+    }
+}
+#endif
+
+#if (OS_EVENT_API == STD_ON)
+/*********************************************************************************************/
+Std_ReturnType Os_SetEvent(Os_TaskType TaskId, Os_EventMaskType Mask)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    Cpu_StateType state;
+
+    if(TaskId < OS_TASKS_NUM)
+    {
+        state = Cpu_EnterCritical();
+        g_Task_State[TaskId].events |= Mask;
+        g_Event_Pending |= OS_TASK_BIT(TaskId);
+#if (OS_PREEMPTIVE == STD_ON)
+        /* Ready the task ... it preempts the caller once the interrupts are restored if it has a higher priority */
+        g_Ready_Bitmap |= OS_PRIORITY_BIT(g_Task_Tcb[TaskId].priority);
+        Os_Schedule();
+#endif
+        Cpu_ExitCritical(state);
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetEvent(Os_TaskType TaskId, Os_EventMaskType * Event)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((TaskId < OS_TASKS_NUM) && (NULL_PTR != Event))
+    {
+        *Event = g_Task_State[TaskId].events;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_ClearEvent(Os_TaskType TaskId, Os_EventMaskType Mask)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    Cpu_StateType state;
+
+    if(TaskId < OS_TASKS_NUM)
+    {
+        state = Cpu_EnterCritical();
+        g_Task_State[TaskId].events &= ~Mask;
+        Cpu_ExitCritical(state);
+        ret = E_OK;
+    }
+    return ret;
+}
+#endif /* (OS_EVENT_API == STD_ON) */
+
+#if (OS_PREEMPTIVE == STD_ON)
+/*********************************************************************************************/
+void Os_Scheduler(void)
+{
+    /* No thread is running yet ... PendSV saves this context on the main stack and switches to the first one */
+    Disable_Interrupts();
+    g_Os_Started = TRUE;
+    Os_Schedule();
+    Enable_Interrupts();
+
+    /* PendSV_Handler returns here once Os_Shutdown was requested and no task is ready */
+    while(g_Os_Started)
+    {
+    }
+}
+#else
+/*********************************************************************************************/
+void Os_Scheduler(void)
+{
+    Os_TickType pending_ticks;
+
+    /* The ticks counted during the Init Task are not dispatched ... the first activations follow one period after this point */
+    g_Dispatched_Tick_Count = g_Time_Tick_Count;
+
+    while(FALSE == g_Shutdown_Request)
+    {
+	/* Number of ticks counted by the timer ISR and not dispatched yet */
+	pending_ticks = g_Time_Tick_Count - g_Dispatched_Tick_Count;
+
+	/* Code is only executed in case there is a new timer tick */
+	if(pending_ticks > 0)
+	{
+#if (OS_CPU_LOAD_API == STD_ON)
+	    Os_CpuLoadBusyStart();
+#endif
+#if (OS_MISSED_TICK_POLICY == OS_MISSED_TICK_SKIP)
+	    /* Drop the late ticks and keep the time base aligned with the latest one */
+	    g_Missed_Tick_Count += (pending_ticks - 1);
+	    Os_SkipTicks(pending_ticks - 1);
+#else
+	    /* The next tick already arrived ... this one is dispatched late and the rest follow in order */
+	    if(pending_ticks > 1)
+	    {
+		g_Missed_Tick_Count++;
+	    }
+#endif
+	    Os_DispatchTick();
+#if (OS_CPU_LOAD_API == STD_ON)
+	    Os_CpuLoadBusyEnd();
+#endif
+	}
+#if (OS_EVENT_API == STD_ON)
+	else if(g_Event_Pending != 0)
+	{
+	    /* No pending tick ... run the tasks activated by events */
+#if (OS_CPU_LOAD_API == STD_ON)
+	    Os_CpuLoadBusyStart();
+#endif
+	    Os_DispatchEvents();
+#if (OS_CPU_LOAD_API == STD_ON)
+	    g_Cpu_Load.idle_start = Cpu_GetCycleCount();
+#endif
+	}
+#endif
+#if (OS_IDLE_HOOK == STD_ON)
+	else
+	{
+	    /* No pending tick ... the scheduler is idle */
+	    Os_IdleHook();
 	}
+#endif
     }
 
 }
+#endif /* (OS_PREEMPTIVE == STD_ON) */
 /*********************************************************************************************/
@@ -14,22 +14,184 @@
 
 #include "Std_Types.h"
 
-/* Timer counting time in ms */
-#define OS_BASE_TIME 20
+/* Macros for the missed tick policies */
+#define OS_MISSED_TICK_CATCH_UP     (0U)
+#define OS_MISSED_TICK_SKIP         (1U)
 
-/* Description: 
+/* Macros for the profiling clocks */
+#define OS_PROFILING_CLOCK_DWT      (0U)
+#define OS_PROFILING_CLOCK_SYSTICK  (1U)
+
+/* Macros for the budget overrun policies */
+#define OS_OVERRUN_LOG              (0U)
+#define OS_OVERRUN_SKIP_NEXT        (1U)
+#define OS_OVERRUN_HOOK             (2U)
+
+/* Os Pre-Compile Configuration Header file */
+#include "Os_Cfg.h"
+
+#if ((OS_HYPERPERIOD % OS_BASE_TIME) != 0)
+  #error "The Os hyperperiod must be a multiple of the Os base time"
+#endif
+
+#if ((OS_EVENT_API == STD_ON) && (OS_TASKS_NUM > 32))
+  #error "The task events support up to 32 tasks, one bit each in the pending event set"
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+#ifdef HOST_BUILD
+  #error "The preemptive kernel needs the PendSV context switch of the target"
+#endif
+#if (OS_MISSED_TICK_POLICY == OS_MISSED_TICK_SKIP)
+  #error "The preemptive kernel activates the tasks from the timer ISR, no tick is dispatched late"
+#endif
+#if (OS_TIMER_API == STD_ON)
+  #error "The software timer callbacks run in the scheduler loop of the run to completion kernel"
+#endif
+#if (OS_TASKS_NUM > 32)
+  #error "The preemptive kernel supports up to 32 tasks, one bit each in the ready bitmap"
+#endif
+#if (((OS_TASK_STACK_SIZE % 8) != 0) || ((OS_IDLE_STACK_SIZE % 8) != 0))
+  #error "The Os stack sizes shall be multiples of 8 bytes"
+#endif
+#endif
+
+/* Type definition for the Os time in ticks */
+typedef uint32 Os_TickType;
+
+/* Type definition for the Os time in ms, it never wraps in the life time of the product */
+typedef uint64 Os_TimeType;
+
+/* Type definition for the Os task identifier, index of the task in Os_Configuration */
+typedef uint8 Os_TaskType;
+
+/* Type definition for the events of a task, one bit per event */
+typedef uint32 Os_EventMaskType;
+
+/* Description: Structure to configure each Os task:
+ *	1. the function executed on every activation of the task
+ *	2. the activation period in ms, it shall be a multiple of OS_BASE_TIME, 0 for a task activated only by events
+ *	3. the execution time budget in us, also enforced by the budget monitor at OS_BASE_TIME resolution
+ */
+typedef struct
+{
+    void (*Task_Ptr)(void);
+    uint16 period;
+    uint32 budget;
+}Os_TaskConfigType;
+
+/* Array of Os_TaskConfigType ... the tasks activated at the same tick run in this order */
+typedef struct
+{
+    Os_TaskConfigType Task[OS_TASKS_NUM];
+}Os_ConfigType;
+
+/* Description: Execution time statistics of one task in profiling clock counts */
+typedef struct
+{
+    uint32 min;          /* Shortest execution time */
+    uint32 max;          /* Longest execution time */
+    uint32 mean;         /* Average execution time over all the activations */
+    uint32 last;         /* Execution time of the last activation */
+    uint32 activations;  /* Number of the timed activations */
+    uint32 overruns;     /* Number of the activations which exceeded the task budget */
+}Os_TaskStatsType;
+
+/* Description: CPU load in per-mille (1000 = fully loaded) reported by the CPU load monitor */
+typedef struct
+{
+    uint16 load;           /* Load of the last complete hyperperiod */
+    uint16 average;        /* Sliding average over the last OS_CPU_LOAD_WINDOW hyperperiods */
+    uint16 peak_tick;      /* Busiest tick of the last hyperperiod relative to OS_BASE_TIME, above 1000 the tick overran */
+    uint16 peak_tick_max;  /* Busiest tick since the Os started */
+    uint32 hyperperiods;   /* Number of the measured hyperperiods */
+}Os_CpuLoadType;
+
+/* Description:
  * Function responsible for:
  * 1. Enable Interrupts
  * 2. Start the Os timer
- * 3. Execute the Init Task
+ * 3. Execute the Init Task ... the ticks counted meanwhile advance the Os time but activate no task
  * 4. Start the Scheduler to run the tasks
  */
 void Os_start(void);
 
-/* Description: The Engine of the Os Scheduler used for switch between different tasks */
+/* Description: The Engine of the Os Scheduler used for switch between different tasks.
+ *              In the preemptive kernel it switches to the first task and returns after Os_Shutdown */
 void Os_Scheduler(void);
 
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
 void Os_NewTimerTick(void);
 
+/* Description: Request Os_Scheduler to return once the current tick is dispatched, in the preemptive
+ *              kernel once no task is ready. It replaces the infinite loop by a clean exit condition
+ *              in the host simulation */
+void Os_Shutdown(void);
+
+#if (OS_IDLE_HOOK == STD_ON)
+/* Description: Function provided by the application and called by Os_Scheduler every time
+ *              it finds no pending tick, or repeatedly by the idle thread of the preemptive kernel */
+void Os_IdleHook(void);
+#endif
+
+#if (OS_POST_TASK_HOOK == STD_ON)
+/* Description: Function provided by the application and called at the end of every task TaskId,
+ *              its time is counted in the execution time of the task */
+void Os_PostTaskHook(Os_TaskType TaskId);
+#endif
+
+/* Description: Return the number of timer ticks since the Os started (wraps every 2^32 ticks) */
+Os_TickType Os_GetTickCount(void);
+
+/* Description: Return the monotonic Os time in ms since the Os started */
+Os_TimeType Os_GetTime(void);
+
+/* Description: Return the number of ticks which were dispatched late or dropped by the scheduler.
+ *              In the preemptive kernel it counts the activations dropped because the task was still running */
+uint32 Os_GetMissedTicks(void);
+
+#if (OS_BUDGET_MONITOR == STD_ON)
+/* Description: Return the number of the activations of the task TaskId found still running by the timer ISR
+ *              after their budget, 0 in case of invalid TaskId */
+uint32 Os_GetBudgetOverruns(Os_TaskType TaskId);
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_HOOK)
+/* Description: Function provided by the application and called by the timer ISR once the task TaskId
+ *              overruns its budget, the task is still running and continues after the hook */
+void Os_OverrunHook(Os_TaskType TaskId);
+#endif
+#endif
+
+#if (OS_PROFILING_API == STD_ON)
+/* Description: Copy the execution time statistics of the task TaskId into Stats.
+ *              Return E_NOT_OK in case of invalid TaskId or NULL_PTR Stats */
+Std_ReturnType Os_GetTaskStats(Os_TaskType TaskId, Os_TaskStatsType * Stats);
+
+/* Description: Clear the execution time statistics of all the tasks */
+void Os_ResetTaskStats(void);
+#endif
+
+#if (OS_CPU_LOAD_API == STD_ON)
+/* Description: Copy the latest CPU load figures into Load, it can be called from any task or ISR.
+ *              Return E_NOT_OK in case of NULL_PTR Load */
+Std_ReturnType Os_GetCpuLoad(Os_CpuLoadType * Load);
+#endif
+
+#if (OS_EVENT_API == STD_ON)
+/* Description: Set the events Mask of the task TaskId and activate it at the next scheduling point,
+ *              it can be called from tasks and ISRs. Return E_NOT_OK in case of invalid TaskId */
+Std_ReturnType Os_SetEvent(Os_TaskType TaskId, Os_EventMaskType Mask);
+
+/* Description: Copy the events set for the task TaskId into Event.
+ *              Return E_NOT_OK in case of invalid TaskId or NULL_PTR Event */
+Std_ReturnType Os_GetEvent(Os_TaskType TaskId, Os_EventMaskType * Event);
+
+/* Description: Clear the events Mask of the task TaskId once they are handled.
+ *              Return E_NOT_OK in case of invalid TaskId */
+Std_ReturnType Os_ClearEvent(Os_TaskType TaskId, Os_EventMaskType Mask);
+#endif
+
+/* Post build structure used by the Os Scheduler */
+extern const Os_ConfigType Os_Configuration;
+
 #endif /* OS_H_ */
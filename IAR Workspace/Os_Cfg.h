@@ -0,0 +1,135 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Os Scheduler.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* Timer counting time in ms */
+#define OS_BASE_TIME                        (20U)
+
+/* Least common multiple of all the task periods in ms */
+#define OS_HYPERPERIOD                      (120U)
+
+/*
+ * Pre-compile option for the handling of ticks that arrive while the scheduler is still busy:
+ * OS_MISSED_TICK_CATCH_UP --> dispatch every missed tick in order
+ * OS_MISSED_TICK_SKIP     --> drop the missed ticks and dispatch only the latest one
+ */
+#define OS_MISSED_TICK_POLICY               (OS_MISSED_TICK_CATCH_UP)
+
+/*
+ * Pre-compile option for calling Os_IdleHook every time the scheduler finds no pending tick,
+ * the host simulation uses it to advance the virtual time as fast as possible
+ */
+#ifdef HOST_BUILD
+#define OS_IDLE_HOOK                        (STD_ON)
+#else
+#define OS_IDLE_HOOK                        (STD_OFF)
+#endif
+
+/*
+ * Pre-compile option for calling Os_PostTaskHook at the end of every task, before its execution time is taken,
+ * the host simulation uses it to give the tasks a known execution time in virtual time
+ */
+#ifdef HOST_BUILD
+#define OS_POST_TASK_HOOK                   (STD_ON)
+#else
+#define OS_POST_TASK_HOOK                   (STD_OFF)
+#endif
+
+/*
+ * Pre-compile option for the preemptive fixed priority kernel:
+ * STD_OFF --> run to completion, the scheduler loop runs the tasks one after another
+ * STD_ON  --> every task runs on its own stack and a higher rate task preempts a lower rate one
+ */
+#define OS_PREEMPTIVE                       (STD_OFF)
+
+/* Stack size in bytes of every task in the preemptive kernel, it shall be a multiple of 8 */
+#define OS_TASK_STACK_SIZE                  (512U)
+
+/* Stack size in bytes of the idle thread in the preemptive kernel, it shall be a multiple of 8 */
+#define OS_IDLE_STACK_SIZE                  (256U)
+
+/* Pre-compile option for the task execution time profiling */
+#define OS_PROFILING_API                    (STD_ON)
+
+/*
+ * Pre-compile option for the clock used to time the tasks:
+ * OS_PROFILING_CLOCK_DWT     --> core cycle counter of the DWT unit (host monotonic clock in HOST_BUILD)
+ * OS_PROFILING_CLOCK_SYSTICK --> SysTick counter extended by the Os ticks, for cores without the DWT unit
+ */
+#define OS_PROFILING_CLOCK                  (OS_PROFILING_CLOCK_DWT)
+
+/*
+ * Pre-compile option for the budget monitor: the timer ISR checks with one comparison per tick whether
+ * the running task is still running after its budget rounded up to the next tick boundary
+ */
+#define OS_BUDGET_MONITOR                   (STD_ON)
+
+/*
+ * Pre-compile option for the handling of a task found running after its budget:
+ * OS_OVERRUN_LOG       --> only count the overrun
+ * OS_OVERRUN_SKIP_NEXT --> count it and drop the next periodic activation of the task
+ * OS_OVERRUN_HOOK      --> count it and call Os_OverrunHook from the timer ISR
+ */
+#define OS_OVERRUN_POLICY                   (OS_OVERRUN_SKIP_NEXT)
+
+/* Pre-compile option for the binary trace recorder of the scheduler events */
+#define OS_TRACE_API                        (STD_ON)
+
+/* Number of the 32-bit records in the trace ring buffer, it shall be a power of 2 */
+#define OS_TRACE_BUFFER_SIZE                (256U)
+
+/* Pre-compile option for the CPU load monitor */
+#define OS_CPU_LOAD_API                     (STD_ON)
+
+/* Number of the hyperperiods averaged by the CPU load monitor */
+#define OS_CPU_LOAD_WINDOW                  (8U)
+
+/* Pre-compile option for the task events ... Os_SetEvent activates a task at the next scheduling point */
+#define OS_EVENT_API                        (STD_ON)
+
+/* Pre-compile option for the software timers */
+#define OS_TIMER_API                        (STD_ON)
+
+/* Number of the software timers in the static pool ... the host tools build it with a bigger pool */
+#ifndef OS_TIMERS_NUM
+#define OS_TIMERS_NUM                       (16U)
+#endif
+
+/* Number of the configured Os tasks */
+#define OS_TASKS_NUM                        (4U)
+
+/* Task Index in the array of structures in Os_PBcfg.c */
+#define OsConf_BUTTON_TASK_ID               (Os_TaskType)0
+#define OsConf_APP_TASK_ID                  (Os_TaskType)1
+#define OsConf_LED_TASK_ID                  (Os_TaskType)2
+#define OsConf_PRESS_TASK_ID                (Os_TaskType)3
+
+/* Os Configured task periods in ms */
+#define OsConf_BUTTON_TASK_PERIOD           (20U)
+#define OsConf_APP_TASK_PERIOD              (60U)
+#define OsConf_LED_TASK_PERIOD              (40U)
+#define OsConf_PRESS_TASK_PERIOD            (60U)
+
+/* Os Configured events of the App task */
+#define OsConf_APP_BUTTON_EVENT             (Os_EventMaskType)0x00000001
+
+/* Os Configured events of the Press task */
+#define OsConf_PRESS_BUTTON_EVENT           (Os_EventMaskType)0x00000001
+
+/* Os Configured task execution budgets in us */
+#define OsConf_BUTTON_TASK_BUDGET           (100U)
+#define OsConf_APP_TASK_BUDGET              (100U)
+#define OsConf_LED_TASK_BUDGET              (100U)
+#define OsConf_PRESS_TASK_BUDGET            (100U)
+
+#endif /* OS_CFG_H_ */
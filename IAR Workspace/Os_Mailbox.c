@@ -0,0 +1,124 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Mailbox.c
+ *
+ * Description: Source file for Os Scheduler - Single Producer Single Consumer Mailboxes.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "Os_Mailbox.h"
+#include "Cpu.h"
+
+/*********************************************************************************************/
+static void Os_MailboxCopy(uint8 * Destination, const uint8 * Source, uint32 Size)
+{
+    uint32 index;
+
+    for(index = 0; index < Size; index++)
+    {
+        Destination[index] = Source[index];
+    }
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_MailboxInit(Os_MailboxType * Mailbox, void * Buffer, uint16 ElementSize, uint16 Capacity)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((NULL_PTR != Mailbox) && (NULL_PTR != Buffer) && (ElementSize != 0) &&
+       (Capacity != 0) && (Capacity <= OS_MAILBOX_MAX_CAPACITY) && ((Capacity & (Capacity - 1U)) == 0))
+    {
+        Mailbox->buffer       = (uint8 *)Buffer;
+        Mailbox->element_size = ElementSize;
+        Mailbox->mask         = (uint16)(Capacity - 1U);
+        Mailbox->head         = 0;
+        Mailbox->tail         = 0;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+uint16 Os_MailboxSend(Os_MailboxType * Mailbox, const void * Data, uint16 Count)
+{
+    uint16 head = Mailbox->head;
+    uint16 free_elements;
+    uint16 first;
+    uint16 index;
+
+    /* The slots released by the consumer ... read them before writing into them */
+    free_elements = (uint16)((Mailbox->mask + 1U) - (uint16)(head - Mailbox->tail));
+    Cpu_DataMemoryBarrier();
+
+    if(Count > free_elements)
+    {
+        Count = free_elements;
+    }
+
+    if(Count > 0)
+    {
+        /* Copy in up to two parts in case the elements wrap around the end of the buffer */
+        index = (uint16)(head & Mailbox->mask);
+        first = (uint16)((Mailbox->mask + 1U) - index);
+        if(first > Count)
+        {
+            first = Count;
+        }
+        Os_MailboxCopy(&Mailbox->buffer[(uint32)index * Mailbox->element_size], (const uint8 *)Data,
+                       (uint32)first * Mailbox->element_size);
+        Os_MailboxCopy(Mailbox->buffer, &((const uint8 *)Data)[(uint32)first * Mailbox->element_size],
+                       (uint32)(Count - first) * Mailbox->element_size);
+
+        /* Publish the elements only once they are completely written */
+        Cpu_DataMemoryBarrier();
+        Mailbox->head = (uint16)(head + Count);
+    }
+    return Count;
+}
+
+/*********************************************************************************************/
+uint16 Os_MailboxReceive(Os_MailboxType * Mailbox, void * Data, uint16 Count)
+{
+    uint16 tail = Mailbox->tail;
+    uint16 used_elements;
+    uint16 first;
+    uint16 index;
+
+    /* The elements published by the producer ... read the index before their content */
+    used_elements = (uint16)(Mailbox->head - tail);
+    Cpu_DataMemoryBarrier();
+
+    if(Count > used_elements)
+    {
+        Count = used_elements;
+    }
+
+    if(Count > 0)
+    {
+        /* Copy in up to two parts in case the elements wrap around the end of the buffer */
+        index = (uint16)(tail & Mailbox->mask);
+        first = (uint16)((Mailbox->mask + 1U) - index);
+        if(first > Count)
+        {
+            first = Count;
+        }
+        Os_MailboxCopy((uint8 *)Data, &Mailbox->buffer[(uint32)index * Mailbox->element_size],
+                       (uint32)first * Mailbox->element_size);
+        Os_MailboxCopy(&((uint8 *)Data)[(uint32)first * Mailbox->element_size], Mailbox->buffer,
+                       (uint32)(Count - first) * Mailbox->element_size);
+
+        /* Release the slots only once their content is read */
+        Cpu_DataMemoryBarrier();
+        Mailbox->tail = (uint16)(tail + Count);
+    }
+    return Count;
+}
+
+/*********************************************************************************************/
+uint16 Os_MailboxCount(const Os_MailboxType * Mailbox)
+{
+    return (uint16)(Mailbox->head - Mailbox->tail);
+}
@@ -0,0 +1,58 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Mailbox.h
+ *
+ * Description: Header file for Os Scheduler - Single Producer Single Consumer Mailboxes.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef OS_MAILBOX_H_
+#define OS_MAILBOX_H_
+
+#include "Os.h"
+
+/* Largest capacity of a mailbox ... the free running uint16 indices shall not wrap past a full mailbox */
+#define OS_MAILBOX_MAX_CAPACITY         (0x8000U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/*
+ * Description: Queue of fixed size elements in a static buffer.
+ * One producer (task or ISR) sends and one consumer (task or ISR) receives without locking:
+ * head is only written by the producer and tail only by the consumer, the elements
+ * between them are owned by the consumer and the rest of the buffer by the producer.
+ */
+typedef struct
+{
+    uint8 * buffer;          /* Capacity * element_size bytes */
+    uint16 element_size;     /* Size of one element in bytes */
+    uint16 mask;             /* Capacity - 1, the capacity is a power of 2 */
+    volatile uint16 head;    /* Number of the elements sent so far, wraps around */
+    volatile uint16 tail;    /* Number of the elements received so far, wraps around */
+}Os_MailboxType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description: Attach Buffer of Capacity elements of ElementSize bytes to an empty Mailbox.
+ *              Return E_NOT_OK in case of NULL_PTR pointers, zero ElementSize or a Capacity
+ *              which is not a power of 2 up to OS_MAILBOX_MAX_CAPACITY */
+Std_ReturnType Os_MailboxInit(Os_MailboxType * Mailbox, void * Buffer, uint16 ElementSize, uint16 Capacity);
+
+/* Description: Copy up to Count elements from Data to the Mailbox, only called by the producer.
+ *              Return the number of the elements sent, less than Count once the Mailbox is full */
+uint16 Os_MailboxSend(Os_MailboxType * Mailbox, const void * Data, uint16 Count);
+
+/* Description: Copy up to Count elements from the Mailbox to Data, only called by the consumer.
+ *              Return the number of the elements received, less than Count once the Mailbox is empty */
+uint16 Os_MailboxReceive(Os_MailboxType * Mailbox, void * Data, uint16 Count);
+
+/* Description: Return the number of the elements waiting in the Mailbox */
+uint16 Os_MailboxCount(const Os_MailboxType * Mailbox);
+
+#endif /* OS_MAILBOX_H_ */
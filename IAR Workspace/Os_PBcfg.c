@@ -0,0 +1,23 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for Os Scheduler.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+/* PB structure used by the Os Scheduler */
+const Os_ConfigType Os_Configuration = {
+    {
+        {Button_Task, OsConf_BUTTON_TASK_PERIOD, OsConf_BUTTON_TASK_BUDGET},
+        {App_Task,    OsConf_APP_TASK_PERIOD,    OsConf_APP_TASK_BUDGET},
+        {Led_Task,    OsConf_LED_TASK_PERIOD,    OsConf_LED_TASK_BUDGET},
+        {Press_Task,  OsConf_PRESS_TASK_PERIOD,  OsConf_PRESS_TASK_BUDGET}
+    }
+};
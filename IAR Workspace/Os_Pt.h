@@ -0,0 +1,147 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Pt.h
+ *
+ * Description: Header file for Os Scheduler - Stackless Protothreads.
+ *
+ *              A protothread is a function which can wait for a delay, a task
+ *              event or a mailbox and continue from the same line on a later
+ *              activation of its task, without a stack of its own:
+ *
+ *                  static OS_PT_THREAD(Eeprom_Thread(Os_PtType * Pt))
+ *                  {
+ *                      OS_PT_BEGIN(Pt);
+ *                      Eeprom_StartWrite();
+ *                      OS_PT_DELAY(Pt, 10);
+ *                      OS_PT_WAIT_UNTIL(Pt, Eeprom_IsReady());
+ *                      OS_PT_END(Pt);
+ *                  }
+ *
+ *                  OS_PT_TASK(Eeprom_Task, Eeprom_Thread)
+ *
+ *              The thread resumes by a switch on the line number (Duff's device) so:
+ *              - its local variables are lost at every wait, keep them static or in a context structure
+ *              - a switch statement shall not contain a wait
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef OS_PT_H_
+#define OS_PT_H_
+
+#include "Os.h"
+#include "Os_Mailbox.h"
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Description: State of a protothread */
+typedef struct
+{
+    uint16 line;           /* Line of the last wait, 0 to start from the beginning */
+    Os_TickType wake_tick; /* End of the current OS_PT_DELAY */
+}Os_PtType;
+
+/* Values returned by a protothread */
+#define OS_PT_WAITING                   (0U)  /* Blocked in a wait */
+#define OS_PT_YIELDED                   (1U)  /* Gave up the CPU by OS_PT_YIELD */
+#define OS_PT_EXITED                    (2U)  /* Stopped by OS_PT_EXIT */
+#define OS_PT_ENDED                     (3U)  /* Reached OS_PT_END */
+
+/*******************************************************************************
+ *                              Protothread Macros                             *
+ *******************************************************************************/
+/* Declare a protothread function */
+#define OS_PT_THREAD(NameArgs)          uint8 NameArgs
+
+/* Restart the protothread from the beginning on its next call */
+#define OS_PT_INIT(Pt)                  ((Pt)->line = 0)
+
+/* Start and end of the body of a protothread */
+#define OS_PT_BEGIN(Pt)                 { uint8 os_pt_yield = 1; (void)os_pt_yield; switch((Pt)->line) { case 0:
+#define OS_PT_END(Pt)                   } OS_PT_INIT(Pt); return OS_PT_ENDED; }
+
+/* Return now and continue from here on the next call */
+#define OS_PT_WAIT_UNTIL(Pt, Condition)                    \
+    do                                                     \
+    {                                                      \
+        (Pt)->line = (uint16)__LINE__;                     \
+        FALLTHROUGH;                                       \
+        case __LINE__:                                     \
+        if(!(Condition))                                   \
+        {                                                  \
+            return OS_PT_WAITING;                          \
+        }                                                  \
+    } while(0)
+
+#define OS_PT_WAIT_WHILE(Pt, Condition) OS_PT_WAIT_UNTIL((Pt), !(Condition))
+
+/* Give up the CPU once ... continue on the next call */
+#define OS_PT_YIELD(Pt)                                    \
+    do                                                     \
+    {                                                      \
+        os_pt_yield = 0;                                   \
+        (Pt)->line = (uint16)__LINE__;                     \
+        FALLTHROUGH;                                       \
+        case __LINE__:                                     \
+        if(os_pt_yield == 0)                               \
+        {                                                  \
+            return OS_PT_YIELDED;                          \
+        }                                                  \
+    } while(0)
+
+/* Stop the protothread, it starts from the beginning on its next call */
+#define OS_PT_EXIT(Pt)                                     \
+    do                                                     \
+    {                                                      \
+        OS_PT_INIT(Pt);                                    \
+        return OS_PT_EXITED;                               \
+    } while(0)
+
+/* Wait for Time ms, rounded up to OS_BASE_TIME ... the thread continues on the first activation after it */
+#define OS_PT_DELAY(Pt, Time)                                                                            \
+    do                                                                                                   \
+    {                                                                                                    \
+        (Pt)->wake_tick = Os_GetTickCount() + (Os_TickType)(((Time) + OS_BASE_TIME - 1U) / OS_BASE_TIME); \
+        OS_PT_WAIT_UNTIL((Pt), (sint32)(Os_GetTickCount() - (Pt)->wake_tick) >= 0);                     \
+    } while(0)
+
+#if (OS_EVENT_API == STD_ON)
+/* Wait for one of the events Mask of the task TaskId ... Os_SetEvent activates the task to continue the thread.
+ * The events are not cleared */
+#define OS_PT_WAIT_EVENT(Pt, TaskId, Mask)                 \
+    OS_PT_WAIT_UNTIL((Pt), (Os_PtGetEvent(TaskId) & (Mask)) != 0)
+#endif
+
+/* Wait for at least one element in the Mailbox */
+#define OS_PT_WAIT_MAILBOX(Pt, Mailbox)                    \
+    OS_PT_WAIT_UNTIL((Pt), Os_MailboxCount(Mailbox) != 0)
+
+/* Wait for at least one free slot in the Mailbox */
+#define OS_PT_WAIT_MAILBOX_SPACE(Pt, Mailbox)              \
+    OS_PT_WAIT_UNTIL((Pt), Os_MailboxCount(Mailbox) <= (Mailbox)->mask)
+
+/*
+ * Define the Os task function TaskName running the protothread Thread,
+ * to be added in Os_PBcfg.c. The thread starts again once it ends.
+ */
+#define OS_PT_TASK(TaskName, Thread)                       \
+    void TaskName(void)                                    \
+    {                                                      \
+        static Os_PtType os_pt_state = {0, 0};             \
+        (void)Thread(&os_pt_state);                        \
+    }
+
+#if (OS_EVENT_API == STD_ON)
+/* Description: Return the events of the task TaskId, 0 in case of invalid TaskId */
+LOCAL_INLINE Os_EventMaskType Os_PtGetEvent(Os_TaskType TaskId)
+{
+    Os_EventMaskType events = 0;
+    (void)Os_GetEvent(TaskId, &events);
+    return events;
+}
+#endif
+
+#endif /* OS_PT_H_ */
@@ -0,0 +1,87 @@
+;******************************************************************************
+;
+; Module: Os
+;
+; File Name: Os_Switch.s
+;
+; Description: PendSV context switch of the preemptive Os kernel (OS_PREEMPTIVE == STD_ON).
+;              Saves R4-R11 and EXC_RETURN of Os_CurrentTcb on its process stack,
+;              and S16-S31 when the thread used the FPU (lazy stacking), then
+;              restores the same frame of Os_NextTcb. The context of Os_Scheduler is
+;              saved on the main stack by the first switch and restored once the
+;              Os is shut down and Os_NextTcb is NULL.
+;
+; Author: Omar Anwar
+;******************************************************************************
+
+; Std_Types.h holds C declarations ... only its switch values are needed here
+#define STD_ON      0x01
+#define STD_OFF     0x00
+
+#include "Os_Cfg.h"
+
+#if (OS_PREEMPTIVE == STD_ON)
+
+        MODULE  Os_Switch
+
+        PUBLIC  PendSV_Handler
+        EXTERN  Os_CurrentTcb
+        EXTERN  Os_NextTcb
+
+        SECTION .text:CODE:REORDER:NOROOT(2)
+        THUMB
+
+PendSV_Handler:
+        CPSID   I
+        LDR     R2, =Os_CurrentTcb
+        LDR     R0, [R2]
+        CBZ     R0, PendSV_SaveKernel   ; First switch ... save the context of Os_Scheduler instead
+
+        MRS     R1, PSP
+#ifdef __ARMVFP__
+        TST     LR, #0x10               ; EXC_RETURN bit 4 is cleared when the hardware stacked an FPU frame
+        IT      EQ
+        VSTMDBEQ R1!, {S16-S31}
+#endif
+        STMDB   R1!, {R4-R11, LR}
+        STR     R1, [R0]                ; Os_CurrentTcb->sp is the first member of the control block
+
+PendSV_Restore:
+        LDR     R3, =Os_NextTcb
+        LDR     R0, [R3]
+        STR     R0, [R2]                ; Os_CurrentTcb = Os_NextTcb
+        CBZ     R0, PendSV_RestoreKernel ; Os shut down ... no thread to switch in
+        LDR     R1, [R0]
+        LDMIA   R1!, {R4-R11, LR}
+#ifdef __ARMVFP__
+        TST     LR, #0x10
+        IT      EQ
+        VLDMIAEQ R1!, {S16-S31}
+#endif
+        MSR     PSP, R1
+        CPSIE   I
+        BX      LR                      ; Return to the thread on the PSP
+
+PendSV_SaveKernel:
+        ; Os_Scheduler runs on the main stack ... its context stays there, above the ISR frames, until the Os is shut down
+#ifdef __ARMVFP__
+        TST     LR, #0x10
+        IT      EQ
+        VSTMDBEQ SP!, {S16-S31}
+#endif
+        STMDB   SP!, {R4-R11, LR}
+        B       PendSV_Restore
+
+PendSV_RestoreKernel:
+        LDMIA   SP!, {R4-R11, LR}
+#ifdef __ARMVFP__
+        TST     LR, #0x10
+        IT      EQ
+        VLDMIAEQ SP!, {S16-S31}
+#endif
+        CPSIE   I
+        BX      LR                      ; Return to Os_Scheduler on the main stack
+
+#endif
+
+        END
@@ -0,0 +1,273 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Timer.c
+ *
+ * Description: Source file for Os Scheduler - Software Timers.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "Os_Timer.h"
+
+#if (OS_TIMER_API == STD_ON)
+
+/* Index of the list of the timers expiring in the tick being processed */
+#define OS_TIMER_EXPIRED_LIST           (OS_TIMER_LEVELS * OS_TIMER_SLOTS)
+
+/* Number of the timer lists ... all the wheel slots and the expired list */
+#define OS_TIMER_LISTS_NUM              (OS_TIMER_EXPIRED_LIST + 1U)
+
+/* List index of a timer which is not running */
+#define OS_TIMER_NO_LIST                (0xFFFFU)
+
+/* Description: Timer object of the static pool */
+typedef struct
+{
+    Os_TimerCallbackType callback;  /* Function called on the expiry */
+    Os_TickType expires;            /* Tick of the next expiry */
+    Os_TickType period;             /* Reload in ticks, 0 for a one-shot timer */
+    Os_TimerIdType next;            /* Next timer in the same list or OS_TIMER_INVALID */
+    Os_TimerIdType prev;            /* Previous timer in the same list or OS_TIMER_INVALID */
+    uint16 list;                    /* Index of the list holding the timer, OS_TIMER_NO_LIST when not running */
+    boolean allocated;              /* The timer is taken from the pool */
+}Os_TimerType;
+
+/* Static pool of the timers */
+static Os_TimerType g_Timer[OS_TIMERS_NUM];
+
+/* First timer of every wheel slot and of the expired list */
+static Os_TimerIdType g_Timer_List[OS_TIMER_LISTS_NUM];
+
+/* First timer of the pool free list, linked by the next member */
+static Os_TimerIdType g_Timer_Free;
+
+/* Last tick processed by Os_TimerProcess ... the tick being processed during the expiry callbacks */
+static Os_TickType g_Timer_Now;
+
+/*********************************************************************************************/
+static void Os_TimerLink(Os_TimerIdType TimerId, uint16 List)
+{
+    Os_TimerType * timer = &g_Timer[TimerId];
+
+    timer->list = List;
+    timer->prev = OS_TIMER_INVALID;
+    timer->next = g_Timer_List[List];
+    if(timer->next != OS_TIMER_INVALID)
+    {
+        g_Timer[timer->next].prev = TimerId;
+    }
+    g_Timer_List[List] = TimerId;
+}
+
+/*********************************************************************************************/
+static void Os_TimerUnlink(Os_TimerIdType TimerId)
+{
+    Os_TimerType * timer = &g_Timer[TimerId];
+
+    if(timer->prev != OS_TIMER_INVALID)
+    {
+        g_Timer[timer->prev].next = timer->next;
+    }
+    else
+    {
+        g_Timer_List[timer->list] = timer->next;
+    }
+    if(timer->next != OS_TIMER_INVALID)
+    {
+        g_Timer[timer->next].prev = timer->prev;
+    }
+    timer->list = OS_TIMER_NO_LIST;
+}
+
+/*********************************************************************************************/
+static void Os_TimerInsert(Os_TimerIdType TimerId)
+{
+    Os_TickType expires = g_Timer[TimerId].expires;
+    Os_TickType delta = expires - g_Timer_Now;
+    uint8 level = 0;
+
+    /* Lowest level which range covers the timeout, the slot is selected by the bits of the expiry tick of that level */
+    while((level < (OS_TIMER_LEVELS - 1U)) && (delta >= (1UL << ((level + 1U) * OS_TIMER_SLOT_BITS))))
+    {
+        level++;
+    }
+
+    Os_TimerLink(TimerId, (uint16)((level * OS_TIMER_SLOTS) +
+                                   ((expires >> (level * OS_TIMER_SLOT_BITS)) & OS_TIMER_SLOT_MASK)));
+}
+
+/*********************************************************************************************/
+static void Os_TimerCascade(uint8 Level)
+{
+    uint8 index = (uint8)((g_Timer_Now >> (Level * OS_TIMER_SLOT_BITS)) & OS_TIMER_SLOT_MASK);
+    uint16 list = (uint16)((Level * OS_TIMER_SLOTS) + index);
+    Os_TimerIdType timer_id;
+
+    /* The ticks reached this slot ... move its timers to the lower levels */
+    while(g_Timer_List[list] != OS_TIMER_INVALID)
+    {
+        timer_id = g_Timer_List[list];
+        Os_TimerUnlink(timer_id);
+        Os_TimerInsert(timer_id);
+    }
+}
+
+/*********************************************************************************************/
+static Os_TickType Os_TimerMsToTicks(uint32 Time)
+{
+    uint32 ticks = (Time / OS_BASE_TIME) + (((Time % OS_BASE_TIME) != 0) ? 1U : 0U);
+
+    if(ticks > OS_TIMER_MAX_TICKS)
+    {
+        ticks = OS_TIMER_MAX_TICKS;
+    }
+    return ticks;
+}
+
+/*********************************************************************************************/
+void Os_TimerInit(void)
+{
+    Os_TimerIdType timer_id;
+    uint16 list;
+
+    for(list = 0; list < OS_TIMER_LISTS_NUM; list++)
+    {
+        g_Timer_List[list] = OS_TIMER_INVALID;
+    }
+
+    /* Link all the timers in the free list */
+    for(timer_id = 0; timer_id < OS_TIMERS_NUM; timer_id++)
+    {
+        g_Timer[timer_id].callback  = NULL_PTR;
+        g_Timer[timer_id].list      = OS_TIMER_NO_LIST;
+        g_Timer[timer_id].allocated = FALSE;
+        g_Timer[timer_id].next      = (Os_TimerIdType)(timer_id + 1U);
+    }
+    g_Timer[OS_TIMERS_NUM - 1U].next = OS_TIMER_INVALID;
+    g_Timer_Free = 0;
+    g_Timer_Now  = 0;
+}
+
+/*********************************************************************************************/
+void Os_TimerProcess(Os_TickType Now)
+{
+    Os_TimerIdType timer_id;
+    Os_TimerType * timer;
+    uint16 list;
+    uint8 level;
+
+    while(g_Timer_Now != Now)
+    {
+        g_Timer_Now++;
+
+        /* Every time a level wraps around, the next slot of the level above is due */
+        level = 0;
+        while((level < (OS_TIMER_LEVELS - 1U)) &&
+              (((g_Timer_Now >> (level * OS_TIMER_SLOT_BITS)) & OS_TIMER_SLOT_MASK) == 0))
+        {
+            level++;
+            Os_TimerCascade(level);
+        }
+
+        /* Move the due timers aside so the callbacks can start and stop any timer */
+        list = (uint16)(g_Timer_Now & OS_TIMER_SLOT_MASK);
+        while(g_Timer_List[list] != OS_TIMER_INVALID)
+        {
+            timer_id = g_Timer_List[list];
+            Os_TimerUnlink(timer_id);
+            Os_TimerLink(timer_id, OS_TIMER_EXPIRED_LIST);
+        }
+
+        while(g_Timer_List[OS_TIMER_EXPIRED_LIST] != OS_TIMER_INVALID)
+        {
+            timer_id = g_Timer_List[OS_TIMER_EXPIRED_LIST];
+            timer = &g_Timer[timer_id];
+            Os_TimerUnlink(timer_id);
+            if(timer->period != 0)
+            {
+                timer->expires = g_Timer_Now + timer->period;
+                Os_TimerInsert(timer_id);
+            }
+            timer->callback(timer_id);
+        }
+    }
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_TimerAlloc(Os_TimerCallbackType Callback, Os_TimerIdType * TimerId)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((NULL_PTR != Callback) && (NULL_PTR != TimerId) && (g_Timer_Free != OS_TIMER_INVALID))
+    {
+        *TimerId = g_Timer_Free;
+        g_Timer_Free = g_Timer[*TimerId].next;
+        g_Timer[*TimerId].callback  = Callback;
+        g_Timer[*TimerId].list      = OS_TIMER_NO_LIST;
+        g_Timer[*TimerId].allocated = TRUE;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_TimerFree(Os_TimerIdType TimerId)
+{
+    Std_ReturnType ret = Os_TimerStop(TimerId);
+
+    if(E_OK == ret)
+    {
+        g_Timer[TimerId].allocated = FALSE;
+        g_Timer[TimerId].next      = g_Timer_Free;
+        g_Timer_Free = TimerId;
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_TimerStart(Os_TimerIdType TimerId, uint32 Timeout, uint32 Period)
+{
+    Std_ReturnType ret = Os_TimerStop(TimerId);
+    Os_TickType ticks;
+
+    if(E_OK == ret)
+    {
+        /* Expire on the next tick at the earliest */
+        ticks = Os_TimerMsToTicks(Timeout);
+        if(ticks == 0)
+        {
+            ticks = 1;
+        }
+        g_Timer[TimerId].expires = g_Timer_Now + ticks;
+        g_Timer[TimerId].period  = Os_TimerMsToTicks(Period);
+        Os_TimerInsert(TimerId);
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_TimerStop(Os_TimerIdType TimerId)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((TimerId < OS_TIMERS_NUM) && (g_Timer[TimerId].allocated))
+    {
+        if(g_Timer[TimerId].list != OS_TIMER_NO_LIST)
+        {
+            Os_TimerUnlink(TimerId);
+        }
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+boolean Os_TimerIsActive(Os_TimerIdType TimerId)
+{
+    return (boolean)((TimerId < OS_TIMERS_NUM) && (g_Timer[TimerId].allocated) &&
+                     (g_Timer[TimerId].list != OS_TIMER_NO_LIST));
+}
+
+#endif /* (OS_TIMER_API == STD_ON) */
@@ -0,0 +1,82 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Timer.h
+ *
+ * Description: Header file for Os Scheduler - Software Timers.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef OS_TIMER_H_
+#define OS_TIMER_H_
+
+#include "Os.h"
+
+/*******************************************************************************
+ *                              Timing Wheel                                   *
+ *******************************************************************************/
+/*
+ * The active timers are kept in a hierarchical timing wheel of OS_TIMER_LEVELS levels,
+ * each one of OS_TIMER_SLOTS slots. Level n holds the timers expiring in less than
+ * 64^(n+1) ticks, a slot of level n is moved down to the lower levels once the ticks
+ * reach it, so starting, stopping and expiring a timer never scans the other timers.
+ */
+#define OS_TIMER_LEVELS                 (4U)
+#define OS_TIMER_SLOT_BITS              (6U)
+#define OS_TIMER_SLOTS                  (1U << OS_TIMER_SLOT_BITS)
+#define OS_TIMER_SLOT_MASK              (OS_TIMER_SLOTS - 1U)
+
+/* Longest timeout in ticks ... a longer one is reduced to it */
+#define OS_TIMER_MAX_TICKS              ((1UL << (OS_TIMER_LEVELS * OS_TIMER_SLOT_BITS)) - 1U)
+
+/* Timer index returned in case no timer is allocated, also the end of the timer lists */
+#define OS_TIMER_INVALID                (0xFFFFU)
+
+#if (OS_TIMERS_NUM >= OS_TIMER_INVALID)
+  #error "OS_TIMERS_NUM shall be less than 65535"
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Type definition for the identifier of a timer in the static pool */
+typedef uint16 Os_TimerIdType;
+
+/* Type definition for the function called in task context once a timer expires */
+typedef void (*Os_TimerCallbackType)(Os_TimerIdType TimerId);
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+#if (OS_TIMER_API == STD_ON)
+
+/* Description: Return all the timers to the pool, called by Os_start */
+void Os_TimerInit(void);
+
+/* Description: Expire the timers up to the tick Now, called by the scheduler for every dispatched tick */
+void Os_TimerProcess(Os_TickType Now);
+
+/* Description: Take a timer from the pool and set the function called on its expiry.
+ *              Return E_NOT_OK in case of NULL_PTR Callback or TimerId or an empty pool */
+Std_ReturnType Os_TimerAlloc(Os_TimerCallbackType Callback, Os_TimerIdType * TimerId);
+
+/* Description: Return a timer to the pool, it is stopped first.
+ *              Return E_NOT_OK in case of invalid TimerId */
+Std_ReturnType Os_TimerFree(Os_TimerIdType TimerId);
+
+/* Description: Start or restart a timer to expire after Timeout ms then every Period ms, 0 for a one-shot timer.
+ *              The times are rounded up to OS_BASE_TIME. Return E_NOT_OK in case of invalid TimerId */
+Std_ReturnType Os_TimerStart(Os_TimerIdType TimerId, uint32 Timeout, uint32 Period);
+
+/* Description: Stop a timer, nothing happens in case it is not running.
+ *              Return E_NOT_OK in case of invalid TimerId */
+Std_ReturnType Os_TimerStop(Os_TimerIdType TimerId);
+
+/* Description: Return TRUE in case the timer is running */
+boolean Os_TimerIsActive(Os_TimerIdType TimerId);
+
+#endif /* (OS_TIMER_API == STD_ON) */
+
+#endif /* OS_TIMER_H_ */
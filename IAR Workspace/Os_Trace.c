@@ -0,0 +1,83 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Trace.c
+ *
+ * Description: Source file for Os Scheduler - Binary Trace Recorder.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "Os_Trace.h"
+#include "Cpu.h"
+
+#if (OS_TRACE_API == STD_ON)
+
+/* Number of the events recorded by Os_TraceInit to measure the recording overhead */
+#define OS_TRACE_CALIBRATION_EVENTS     (16U)
+
+/* Index of the record number Head inside the ring buffer */
+#define OS_TRACE_INDEX(Head)            ((Head) & (OS_TRACE_BUFFER_SIZE - 1))
+
+/* Global trace ring buffer to be dumped from RAM */
+Os_TraceBufferType Os_TraceBuffer;
+
+/*********************************************************************************************/
+void Os_TraceInit(void)
+{
+    uint8 event;
+    uint32 start_time;
+
+    /* The dump is not valid until the buffer is initialized */
+    Os_TraceBuffer.magic     = 0;
+    Os_TraceBuffer.clock_hz  = CPU_CYCLE_COUNTER_FREQUENCY_HZ;
+    Os_TraceBuffer.size      = OS_TRACE_BUFFER_SIZE;
+    Os_TraceBuffer.head      = 0;
+    Os_TraceBuffer.last_time = Cpu_GetCycleCount();
+
+    /* Measure the average cost of one event as seen by the caller */
+    start_time = Cpu_GetCycleCount();
+    for(event = 0; event < OS_TRACE_CALIBRATION_EVENTS; event++)
+    {
+        Os_TraceEvent(OS_TRACE_EVENT_MARKER, event);
+    }
+    Os_TraceBuffer.overhead = (Cpu_GetCycleCount() - start_time) / OS_TRACE_CALIBRATION_EVENTS;
+
+    /* Drop the calibration records */
+    Os_TraceBuffer.head      = 0;
+    Os_TraceBuffer.last_time = Cpu_GetCycleCount();
+    Os_TraceBuffer.magic     = OS_TRACE_MAGIC;
+}
+
+/*********************************************************************************************/
+void Os_TraceEvent(uint8 Type, uint8 Id)
+{
+    Cpu_StateType state = Cpu_EnterCritical();
+    uint32 now   = Cpu_GetCycleCount();
+    uint32 delta = now - Os_TraceBuffer.last_time;
+
+    if(delta > OS_TRACE_DELTA_MASK)
+    {
+        /* The delta does not fit in one record ... store its upper bits in an overflow record first */
+        Os_TraceBuffer.records[OS_TRACE_INDEX(Os_TraceBuffer.head)] =
+            ((uint32)OS_TRACE_EVENT_OVERFLOW << OS_TRACE_TYPE_SHIFT) | (delta >> OS_TRACE_DELTA_BITS);
+        Os_TraceBuffer.head++;
+        delta &= OS_TRACE_DELTA_MASK;
+    }
+
+    Os_TraceBuffer.records[OS_TRACE_INDEX(Os_TraceBuffer.head)] =
+        ((uint32)Type << OS_TRACE_TYPE_SHIFT) | ((uint32)Id << OS_TRACE_ID_SHIFT) | delta;
+    Os_TraceBuffer.head++;
+    Os_TraceBuffer.last_time = now;
+
+    Cpu_ExitCritical(state);
+}
+
+/*********************************************************************************************/
+uint32 Os_TraceGetOverhead(void)
+{
+    return Os_TraceBuffer.overhead;
+}
+
+#endif /* (OS_TRACE_API == STD_ON) */
@@ -0,0 +1,97 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Trace.h
+ *
+ * Description: Header file for Os Scheduler - Binary Trace Recorder.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef OS_TRACE_H_
+#define OS_TRACE_H_
+
+#include "Os.h"
+
+/*******************************************************************************
+ *                              Record Format                                  *
+ *******************************************************************************/
+/*
+ * Every event is stored in one 32-bit record:
+ *  bits [31:28] --> event type
+ *  bits [27:20] --> event id (task id or marker id)
+ *  bits [19:0]  --> cycles elapsed since the previous record
+ * An OS_TRACE_EVENT_OVERFLOW record is inserted before a record whose delta does not
+ * fit in 20 bits, its delta field holds the upper bits of the delta (delta >> 20).
+ */
+#define OS_TRACE_TYPE_SHIFT             28
+#define OS_TRACE_ID_SHIFT               20
+#define OS_TRACE_ID_MASK                0xFF
+#define OS_TRACE_DELTA_BITS             20
+#define OS_TRACE_DELTA_MASK             0x000FFFFF
+
+/* Trace event types */
+#define OS_TRACE_EVENT_OVERFLOW         (0U)
+#define OS_TRACE_EVENT_TASK_START       (1U)
+#define OS_TRACE_EVENT_TASK_STOP        (2U)
+#define OS_TRACE_EVENT_TICK_ISR         (3U)
+#define OS_TRACE_EVENT_MARKER           (4U)
+
+/* Value of the magic member ... lets the host decoder find and validate a memory dump */
+#define OS_TRACE_MAGIC                  (0x4F535452U) /* "OSTR" */
+
+#if ((OS_TRACE_BUFFER_SIZE & (OS_TRACE_BUFFER_SIZE - 1)) != 0)
+  #error "OS_TRACE_BUFFER_SIZE shall be a power of 2"
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Description: Trace ring buffer ... dump Os_TraceBuffer from RAM and convert it by the host decoder */
+typedef struct
+{
+    uint32 magic;          /* OS_TRACE_MAGIC once the recorder is initialized */
+    uint32 clock_hz;       /* Frequency of the cycle counter used for the deltas */
+    uint32 size;           /* Number of records in the ring buffer */
+    uint32 head;           /* Number of records written so far, the next one goes to records[head % size] */
+    uint32 overhead;       /* Measured cost of recording one event in cycles */
+    uint32 last_time;      /* Cycle counter value of the last record */
+    uint32 records[OS_TRACE_BUFFER_SIZE];
+}Os_TraceBufferType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+#if (OS_TRACE_API == STD_ON)
+
+/* Description: Clear the trace buffer and measure the recording overhead */
+void Os_TraceInit(void);
+
+/* Description: Append one event to the trace ring buffer, it is safe to be called from tasks and ISRs */
+void Os_TraceEvent(uint8 Type, uint8 Id);
+
+/* Description: Return the measured cost of recording one event in cycles */
+uint32 Os_TraceGetOverhead(void);
+
+/* Trace ring buffer to be dumped from RAM */
+extern Os_TraceBufferType Os_TraceBuffer;
+
+/* Hooks used by the Os Scheduler */
+#define OS_TRACE_TASK_START(TaskId)     Os_TraceEvent(OS_TRACE_EVENT_TASK_START, (TaskId))
+#define OS_TRACE_TASK_STOP(TaskId)      Os_TraceEvent(OS_TRACE_EVENT_TASK_STOP, (TaskId))
+#define OS_TRACE_TICK_ISR()             Os_TraceEvent(OS_TRACE_EVENT_TICK_ISR, 0)
+
+/* Description: User marker ... record MarkerId with the current time */
+#define Os_TraceMarker(MarkerId)        Os_TraceEvent(OS_TRACE_EVENT_MARKER, (MarkerId))
+
+#else
+
+#define OS_TRACE_TASK_START(TaskId)
+#define OS_TRACE_TASK_STOP(TaskId)
+#define OS_TRACE_TICK_ISR()
+#define Os_TraceMarker(MarkerId)
+
+#endif /* (OS_TRACE_API == STD_ON) */
+
+#endif /* OS_TRACE_H_ */
@@ -0,0 +1,243 @@
+ /******************************************************************************
+ *
+ * Module: Port/Dio Benchmark
+ *
+ * File Name: PortDio_Bench.c
+ *
+ * Description: Microbenchmark of the Port and Dio Driver services. Each call is
+ *              measured alone with the interrupts disabled so the minimum, the
+ *              average and the maximum cycles are those of the service only.
+ *
+ *              The Set services are called with the configured direction and
+ *              mode so the pins keep their configuration. The JTAG pins PC0 to
+ *              PC3 are skipped like Port_Init skips them.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#include "PortDio_Bench.h"
+#include "Cpu.h"
+#include "Reg_Access.h"
+
+/* Number of the measurements of the cycle counter read, the smallest one is the overhead */
+#define PORTDIO_BENCH_CALIBRATIONS      (16U)
+
+PortDio_BenchTableType PortDio_BenchTable;
+
+/* Result being measured */
+static PortDio_BenchResultType * PortDio_Bench_Result;
+
+/* Measurements of the cycle counter read */
+static PortDio_BenchResultType PortDio_Bench_Calibration;
+
+/* Measure one call of a service ... the interrupts are disabled around it */
+#define PORTDIO_BENCH_MEASURE(CALL)                                         \
+    do                                                                      \
+    {                                                                       \
+        Cpu_StateType state = Cpu_EnterCritical();                          \
+        uint32 start = Cpu_GetCycleCount();                                 \
+        CALL;                                                               \
+        PortDio_Bench_Record(Cpu_GetCycleCount() - start);                  \
+        Cpu_ExitCritical(state);                                            \
+    } while(0)
+
+/*********************************************************************************************/
+/* Description: Add the cycles of one call to the result being measured */
+static void PortDio_Bench_Record(uint32 Cycles)
+{
+    PortDio_BenchResultType * result = PortDio_Bench_Result;
+
+    Cycles = (Cycles > PortDio_BenchTable.overhead_cycles) ? (Cycles - PortDio_BenchTable.overhead_cycles) : 0U;
+
+    if((result->calls == 0) || (Cycles < result->min_cycles))
+    {
+        result->min_cycles = Cycles;
+    }
+    if(Cycles > result->max_cycles)
+    {
+        result->max_cycles = Cycles;
+    }
+    result->total_cycles += Cycles;
+    result->calls++;
+}
+
+/*********************************************************************************************/
+/* Description: Start the next result of the table */
+static void PortDio_Bench_Begin(uint16 ModuleId, uint8 ApiId, uint8 Index)
+{
+    PortDio_BenchResultType * result = &PortDio_BenchTable.result[PortDio_BenchTable.count];
+
+    result->module_id    = ModuleId;
+    result->api_id       = ApiId;
+    result->index        = Index;
+    result->calls        = 0;
+    result->total_cycles = 0;
+    result->min_cycles   = 0;
+    result->max_cycles   = 0;
+    result->reads        = 0;
+    result->writes       = 0;
+
+#if (REG_ACCESS_STATS == STD_ON)
+    {
+        /* Keep the accesses counted before, PortDio_Bench_End stores the difference */
+        RegAccess_ApiStatsType stats;
+        RegAccess_GetApiStats(ModuleId, ApiId, &stats);
+        result->reads  = stats.reads;
+        result->writes = stats.writes;
+    }
+#endif
+
+    PortDio_Bench_Result = result;
+}
+
+/*********************************************************************************************/
+/* Description: Complete the result being measured */
+static void PortDio_Bench_End(void)
+{
+#if (REG_ACCESS_STATS == STD_ON)
+    RegAccess_ApiStatsType stats;
+    RegAccess_GetApiStats(PortDio_Bench_Result->module_id, PortDio_Bench_Result->api_id, &stats);
+    PortDio_Bench_Result->reads  = stats.reads - PortDio_Bench_Result->reads;
+    PortDio_Bench_Result->writes = stats.writes - PortDio_Bench_Result->writes;
+#endif
+
+    PortDio_BenchTable.count++;
+}
+
+/*********************************************************************************************/
+/* Description: Measure the smallest cost of reading the cycle counter, taken out of every call */
+static void PortDio_Bench_Calibrate(void)
+{
+    uint32 iteration;
+
+    PortDio_BenchTable.overhead_cycles = 0;
+    PortDio_Bench_Calibration.calls = 0;
+    PortDio_Bench_Calibration.total_cycles = 0;
+    PortDio_Bench_Calibration.max_cycles = 0;
+    PortDio_Bench_Result = &PortDio_Bench_Calibration;
+
+    for(iteration = 0; iteration < PORTDIO_BENCH_CALIBRATIONS; iteration++)
+    {
+        PORTDIO_BENCH_MEASURE((void)0);
+    }
+    PortDio_BenchTable.overhead_cycles = PortDio_Bench_Calibration.min_cycles;
+}
+
+#if ((PORT_SET_PIN_DIRECTION_API == STD_ON) || (PORT_SET_PIN_MODE_API == STD_ON))
+/*********************************************************************************************/
+/* Description: Return TRUE for the JTAG pins PC0 to PC3, which Port_Init does not configure */
+static boolean PortDio_Bench_IsJtagPin(Port_PinType Pin)
+{
+    return (boolean)((Port_Configuration.Pin[Pin].port_num == PORT_PORTC_ID)
+                  && (Port_Configuration.Pin[Pin].pin_num <= PORT_PIN3_ID));
+}
+#endif
+
+/*********************************************************************************************/
+void PortDio_Bench_Run(void)
+{
+    uint32 iteration;
+    uint8 index;
+    Dio_LevelType level;
+
+    PortDio_BenchTable.magic = 0;
+    PortDio_BenchTable.count = 0;
+    PortDio_BenchTable.frequency_hz = CPU_CYCLE_COUNTER_FREQUENCY_HZ;
+    PortDio_BenchTable.options = 0
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        | PORTDIO_BENCH_OPTION_PORT_DET
+#endif
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+        | PORTDIO_BENCH_OPTION_DIO_DET
+#endif
+#if (REG_ACCESS_STATS == STD_ON)
+        | PORTDIO_BENCH_OPTION_REG_STATS
+#endif
+#ifdef HOST_BUILD
+        | PORTDIO_BENCH_OPTION_HOST
+#endif
+        ;
+
+    PortDio_Bench_Calibrate();
+
+    /* Port_Init first, the other services need the initialized drivers */
+    PortDio_Bench_Begin(PORT_MODULE_ID, PORT_INIT_SID, PORTDIO_BENCH_NO_INDEX);
+    for(iteration = 0; iteration < PORTDIO_BENCH_ITERATIONS; iteration++)
+    {
+        PORTDIO_BENCH_MEASURE(Port_Init(&Port_Configuration));
+    }
+    PortDio_Bench_End();
+    Dio_Init(&Dio_Configuration);
+
+    PortDio_Bench_Begin(PORT_MODULE_ID, PORT_REFRESH_PORT_DIRECTION_SID, PORTDIO_BENCH_NO_INDEX);
+    for(iteration = 0; iteration < PORTDIO_BENCH_ITERATIONS; iteration++)
+    {
+        PORTDIO_BENCH_MEASURE(Port_RefreshPortDirection());
+    }
+    PortDio_Bench_End();
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+    for(index = 0; index < PORT_CONFIGURED_PINS; index++)
+    {
+        if(PortDio_Bench_IsJtagPin(index))
+        {
+            continue;
+        }
+        PortDio_Bench_Begin(PORT_MODULE_ID, PORT_SET_PIN_DIRECTION_SID, index);
+        for(iteration = 0; iteration < PORTDIO_BENCH_ITERATIONS; iteration++)
+        {
+            PORTDIO_BENCH_MEASURE(Port_SetPinDirection(index, Port_Configuration.Pin[index].direction));
+        }
+        PortDio_Bench_End();
+    }
+#endif
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+    for(index = 0; index < PORT_CONFIGURED_PINS; index++)
+    {
+        if(PortDio_Bench_IsJtagPin(index))
+        {
+            continue;
+        }
+        PortDio_Bench_Begin(PORT_MODULE_ID, PORT_SET_PIN_MODE_SID, index);
+        for(iteration = 0; iteration < PORTDIO_BENCH_ITERATIONS; iteration++)
+        {
+            PORTDIO_BENCH_MEASURE(Port_SetPinMode(index, Port_Configuration.Pin[index].mode));
+        }
+        PortDio_Bench_End();
+    }
+#endif
+
+    for(index = 0; index < DIO_CONFIGURED_CHANNLES; index++)
+    {
+        PortDio_Bench_Begin(DIO_MODULE_ID, DIO_READ_CHANNEL_SID, index);
+        for(iteration = 0; iteration < PORTDIO_BENCH_ITERATIONS; iteration++)
+        {
+            PORTDIO_BENCH_MEASURE((void)Dio_ReadChannel(index));
+        }
+        PortDio_Bench_End();
+
+        /* Both levels are written, the channel gets its level back at the end */
+        level = Dio_ReadChannel(index);
+        PortDio_Bench_Begin(DIO_MODULE_ID, DIO_WRITE_CHANNEL_SID, index);
+        for(iteration = 0; iteration < PORTDIO_BENCH_ITERATIONS; iteration++)
+        {
+            PORTDIO_BENCH_MEASURE(Dio_WriteChannel(index, (Dio_LevelType)(iteration & 1U)));
+        }
+        PortDio_Bench_End();
+        Dio_WriteChannel(index, level);
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+        PortDio_Bench_Begin(DIO_MODULE_ID, DIO_FLIP_CHANNEL_SID, index);
+        for(iteration = 0; iteration < PORTDIO_BENCH_ITERATIONS; iteration++)
+        {
+            PORTDIO_BENCH_MEASURE((void)Dio_FlipChannel(index));
+        }
+        PortDio_Bench_End();
+        Dio_WriteChannel(index, level);
+#endif
+    }
+
+    /* The results are complete ... the host tool rejects a dump without the magic */
+    PortDio_BenchTable.magic = PORTDIO_BENCH_MAGIC;
+}
@@ -0,0 +1,102 @@
+ /******************************************************************************
+ *
+ * Module: Port/Dio Benchmark
+ *
+ * File Name: PortDio_Bench.h
+ *
+ * Description: Header file for the microbenchmark of the Port and Dio Driver
+ *              services. Every service is called PORTDIO_BENCH_ITERATIONS times
+ *              for each configured pin or channel and its cycles are recorded
+ *              in PortDio_BenchTable, with its register accesses when
+ *              REG_ACCESS_STATS is STD_ON.
+ *
+ *              On the target the cycles are DWT cycles: run it at startup with
+ *              PORTDIO_BENCH_AT_STARTUP, then dump PortDio_BenchTable from RAM and
+ *              convert it by Host Tools/PortDio_BenchReport.c. On the host the
+ *              same tool runs it on the simulated registers, the cycles are ns.
+ *
+ * Author: Omar Anwar
+ ******************************************************************************/
+
+#ifndef PORTDIO_BENCH_H
+#define PORTDIO_BENCH_H
+
+#include "Port.h"
+#include "Dio.h"
+
+/* Pre-compile option to run the benchmark in main before the Os starts ... override it on the command line */
+#ifndef PORTDIO_BENCH_AT_STARTUP
+#define PORTDIO_BENCH_AT_STARTUP        (STD_OFF)
+#endif
+
+/* Number of the measured calls of every service for every pin or channel */
+#ifndef PORTDIO_BENCH_ITERATIONS
+#define PORTDIO_BENCH_ITERATIONS        (64U)
+#endif
+
+/* Value of PortDio_BenchTable.magic once the benchmark completed ... "PDBT" */
+#define PORTDIO_BENCH_MAGIC             (0x54424450U)
+
+/* Bits of PortDio_BenchTable.options, the options of the measured build */
+#define PORTDIO_BENCH_OPTION_PORT_DET   (0x01U)     /* PORT_DEV_ERROR_DETECT STD_ON */
+#define PORTDIO_BENCH_OPTION_DIO_DET    (0x02U)     /* DIO_DEV_ERROR_DETECT STD_ON */
+#define PORTDIO_BENCH_OPTION_REG_STATS  (0x04U)     /* REG_ACCESS_STATS STD_ON, the register accesses are counted */
+#define PORTDIO_BENCH_OPTION_HOST       (0x08U)     /* HOST_BUILD, the cycles are ns of the host */
+
+/* Index of the results of the services of the whole driver */
+#define PORTDIO_BENCH_NO_INDEX          (0xFFU)
+
+/* Number of the results ... Port_Init and Port_RefreshPortDirection, the Set services per pin, the Dio services per channel */
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+#define PORTDIO_BENCH_DIRECTION_RESULTS (PORT_CONFIGURED_PINS)
+#else
+#define PORTDIO_BENCH_DIRECTION_RESULTS (0U)
+#endif
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+#define PORTDIO_BENCH_MODE_RESULTS      (PORT_CONFIGURED_PINS)
+#else
+#define PORTDIO_BENCH_MODE_RESULTS      (0U)
+#endif
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+#define PORTDIO_BENCH_DIO_SERVICES      (3U)
+#else
+#define PORTDIO_BENCH_DIO_SERVICES      (2U)
+#endif
+
+#define PORTDIO_BENCH_RESULTS_NUM       (2U + PORTDIO_BENCH_DIRECTION_RESULTS + PORTDIO_BENCH_MODE_RESULTS \
+                                            + (PORTDIO_BENCH_DIO_SERVICES * DIO_CONFIGURED_CHANNLES))
+
+/* Description: Measurements of one service for one pin or channel */
+typedef struct
+{
+    uint16 module_id;
+    uint8 api_id;
+    uint8 index;            /* Pin or channel index, PORTDIO_BENCH_NO_INDEX for the whole driver */
+    uint32 calls;
+    uint32 total_cycles;    /* Without the overhead of reading the cycle counter */
+    uint32 min_cycles;
+    uint32 max_cycles;
+    uint32 reads;           /* Register accesses of all the calls, 0 without REG_ACCESS_STATS */
+    uint32 writes;
+}PortDio_BenchResultType;
+
+/* Description: Results of the benchmark ... dump it from RAM and convert it by the host tool */
+typedef struct
+{
+    uint32 magic;           /* PORTDIO_BENCH_MAGIC once the results are complete */
+    uint32 options;         /* PORTDIO_BENCH_OPTION_xxx */
+    uint32 frequency_hz;    /* Counts per second of the cycles */
+    uint32 overhead_cycles; /* Cost of reading the cycle counter, taken out of every call */
+    uint32 count;           /* Number of the valid results */
+    PortDio_BenchResultType result[PORTDIO_BENCH_RESULTS_NUM];
+}PortDio_BenchTableType;
+
+/* Description: Measure every service of the Port and Dio Drivers, the pins are left as Port_Configuration sets them.
+ *              The cycle counter shall run, see Cpu_InitCycleCounter */
+void PortDio_Bench_Run(void);
+
+extern PortDio_BenchTableType PortDio_BenchTable;
+
+#endif /* PORTDIO_BENCH_H */
@@ -65,7 +65,7 @@ const Port_ConfigType Port_Configuration = {
 		PORT_PORTC_ID , PORT_PIN3_ID, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PORT_PIN_MODE_DIO , PORT_CHANGEABLE, PORT_CHANGEABLE,
 		PORT_PORTC_ID , PORT_PIN4_ID, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PORT_PIN_MODE_DIO , PORT_CHANGEABLE, PORT_CHANGEABLE,
 		PORT_PORTC_ID , PORT_PIN5_ID, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PORT_PIN_MODE_DIO , PORT_CHANGEABLE, PORT_CHANGEABLE,
-		PORT_PORTC_ID , PORT_PIN6_ID, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PORT_PIN_MODE_DIO , PORT_CHANGEABLE, PORT_CHANGEABLE,
+		PORT_PORTC_ID , PORT_PIN6_ID, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PORT_PIN_MODE_ALT7, PORT_CHANGEABLE, PORT_CHANGEABLE,
 		PORT_PORTC_ID , PORT_PIN7_ID, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PORT_PIN_MODE_DIO , PORT_CHANGEABLE, PORT_CHANGEABLE,
 
 		PORT_PORTD_ID , PORT_PIN0_ID, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PORT_PIN_MODE_DIO , PORT_CHANGEABLE, PORT_CHANGEABLE,
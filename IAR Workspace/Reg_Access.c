@@ -0,0 +1,462 @@
+ /******************************************************************************
+ *
+ * Module: Common - Register Access
+ *
+ * File Name: Reg_Access.c
+ *
+ * Description: Statistics and capture of the register accesses of the Port,
+ *              Dio and Gpt Drivers, built with REG_ACCESS_STATS or
+ *              REG_ACCESS_CAPTURE STD_ON only.
+ *
+ *              Every access is counted for its register and for the service
+ *              which made it, in two hash tables like the Det counters, and
+ *              appended to the log when REG_ACCESS_LOG_SIZE is not 0. The tables
+ *              start free in the zero initialized RAM, no init call is needed.
+ *
+ *              The capture appends every write to RegAccess_Capture while it is
+ *              started, the words of a record are reserved by compare and
+ *              exchange so the writes of an ISR get records of their own.
+ *
+ * Author: Omar Anwar
+ *
+ *******************************************************************************/
+
+#include "Reg_Access.h"
+
+#if ((REG_ACCESS_STATS == STD_ON) || (REG_ACCESS_CAPTURE == STD_ON))
+#include "Cpu.h"
+#endif
+
+#if (REG_ACCESS_STATS == STD_ON)
+
+/* Key of a free slot ... no register is at address 0 and the service keys have bit 24 set */
+#define REG_ACCESS_FREE                 (0U)
+
+/* Key of the counters of a service */
+#define REG_ACCESS_API_KEY(ModuleId, ApiId) \
+    (0x01000000U | ((uint32)(ModuleId) << 8) | (uint32)(ApiId))
+
+/* Number of the slots of the tables */
+#define REG_ACCESS_REGISTERS_NUM        (1U << REG_ACCESS_REGISTERS_BITS)
+#define REG_ACCESS_APIS_NUM             (1U << REG_ACCESS_APIS_BITS)
+
+/* ISRs nested in each other, the deepest ones are counted for the ISR they interrupted */
+#define REG_ACCESS_ISR_NESTING          (8U)
+
+/* Description: Counters of one register or of one service */
+typedef struct
+{
+    volatile uint32 key;
+    volatile uint32 calls;  /* Services only */
+    volatile uint32 reads;
+    volatile uint32 writes;
+}RegAccess_SlotType;
+
+STATIC RegAccess_SlotType RegAccess_Registers[REG_ACCESS_REGISTERS_NUM];
+STATIC RegAccess_SlotType RegAccess_Apis[REG_ACCESS_APIS_NUM];
+STATIC volatile uint32 RegAccess_Dropped;
+
+/* Key of the service making the accesses, 0 before the first one, and the keys of the interrupted services */
+STATIC volatile uint32 RegAccess_Api;
+STATIC uint32 RegAccess_Interrupted[REG_ACCESS_ISR_NESTING];
+STATIC volatile uint32 RegAccess_IsrDepth;
+
+#if (REG_ACCESS_LOG_SIZE > 0U)
+
+/* Description: Logged access with the number it was logged as + 1, 0 while it is written */
+typedef struct
+{
+    volatile uint32 sequence;
+    RegAccess_LogEntryType entry;
+}RegAccess_LogSlotType;
+
+STATIC RegAccess_LogSlotType RegAccess_Log[REG_ACCESS_LOG_SIZE];
+STATIC volatile uint32 RegAccess_LogHead;
+
+#endif
+
+/*********************************************************************************************/
+/* Description: Return the counters of a key, claimed by compare and exchange at the first access.
+ *              NULL_PTR if the REG_ACCESS_MAX_PROBES slots tried belong to other keys */
+STATIC RegAccess_SlotType * RegAccess_FindSlot(RegAccess_SlotType * Table, uint32 Bits, uint32 Key)
+{
+    uint32 hash = (uint32)(Key * 2654435761U) >> (32U - Bits);
+    uint32 probe;
+    uint32 found;
+    RegAccess_SlotType * slot;
+
+    for(probe = 0; probe < REG_ACCESS_MAX_PROBES; probe++)
+    {
+        slot  = &Table[(hash + probe) & ((1U << Bits) - 1U)];
+        found = slot->key;
+        if(found == REG_ACCESS_FREE)
+        {
+            found = Cpu_AtomicCompareExchange(&slot->key, REG_ACCESS_FREE, Key);
+            if(found == REG_ACCESS_FREE)
+            {
+                found = Key; /* Claimed by this access */
+            }
+        }
+        if(found == Key)
+        {
+            return slot;
+        }
+    }
+    (void)Cpu_AtomicFetchIncrement(&RegAccess_Dropped);
+    return NULL_PTR;
+}
+
+/*********************************************************************************************/
+/* Description: Return the key of the service making the accesses */
+STATIC uint32 RegAccess_CurrentApi(void)
+{
+    uint32 api = RegAccess_Api;
+
+    return (api != 0U) ? api : REG_ACCESS_API_KEY(REG_ACCESS_NO_MODULE_ID, 0U);
+}
+
+/*********************************************************************************************/
+/* Description: Count one access for its register and its service and log it */
+STATIC void RegAccess_Count(uint32 Address, uint32 Value, uint8 Type)
+{
+    uint32 api = RegAccess_CurrentApi();
+    RegAccess_SlotType * slot;
+#if (REG_ACCESS_LOG_SIZE > 0U)
+    uint32 number;
+    RegAccess_LogSlotType * log;
+#endif
+
+    slot = RegAccess_FindSlot(RegAccess_Registers, REG_ACCESS_REGISTERS_BITS, Address);
+    if(slot != NULL_PTR)
+    {
+        (void)Cpu_AtomicFetchIncrement((Type == REG_ACCESS_READ) ? &slot->reads : &slot->writes);
+    }
+    slot = RegAccess_FindSlot(RegAccess_Apis, REG_ACCESS_APIS_BITS, api);
+    if(slot != NULL_PTR)
+    {
+        (void)Cpu_AtomicFetchIncrement((Type == REG_ACCESS_READ) ? &slot->reads : &slot->writes);
+    }
+
+#if (REG_ACCESS_LOG_SIZE > 0U)
+    /* Same ring buffer protocol as the Det log */
+    number = Cpu_AtomicFetchIncrement(&RegAccess_LogHead);
+    log    = &RegAccess_Log[number & (REG_ACCESS_LOG_SIZE - 1U)];
+    log->sequence = 0;
+    Cpu_DataMemoryBarrier();
+    log->entry.address   = Address;
+    log->entry.value     = Value;
+    log->entry.module_id = (uint16)(api >> 8);
+    log->entry.api_id    = (uint8)api;
+    log->entry.type      = Type;
+    Cpu_DataMemoryBarrier();
+    log->sequence = number + 1U;
+#else
+    (void)Value;
+#endif
+}
+
+/*********************************************************************************************/
+uint32 RegAccess_Read32(uint32 Address)
+{
+    uint32 value = REG_RAW_READ32(Address);
+
+    RegAccess_Count(Address, value, REG_ACCESS_READ);
+    return value;
+}
+
+/*********************************************************************************************/
+void RegAccess_EnterApi(uint16 ModuleId, uint8 ApiId)
+{
+    uint32 api = REG_ACCESS_API_KEY(ModuleId, ApiId);
+    RegAccess_SlotType * slot = RegAccess_FindSlot(RegAccess_Apis, REG_ACCESS_APIS_BITS, api);
+
+    if(slot != NULL_PTR)
+    {
+        (void)Cpu_AtomicFetchIncrement(&slot->calls);
+    }
+    RegAccess_Api = api;
+}
+
+/*********************************************************************************************/
+void RegAccess_EnterIsr(uint16 ModuleId)
+{
+    /* The ISRs nest like a stack, a preempting ISR restores the depth before this one continues */
+    uint32 depth = RegAccess_IsrDepth;
+
+    if(depth < REG_ACCESS_ISR_NESTING)
+    {
+        RegAccess_Interrupted[depth] = RegAccess_Api;
+        RegAccess_Api = REG_ACCESS_API_KEY(ModuleId, REG_ACCESS_ISR_API_ID);
+    }
+    RegAccess_IsrDepth = depth + 1U;
+}
+
+/*********************************************************************************************/
+void RegAccess_ExitIsr(void)
+{
+    uint32 depth = RegAccess_IsrDepth - 1U;
+
+    if(depth < REG_ACCESS_ISR_NESTING)
+    {
+        RegAccess_Api = RegAccess_Interrupted[depth];
+    }
+    RegAccess_IsrDepth = depth;
+}
+
+/*********************************************************************************************/
+void RegAccess_Reset(void)
+{
+    uint32 index;
+
+    for(index = 0; index < REG_ACCESS_REGISTERS_NUM; index++)
+    {
+        RegAccess_Registers[index].reads  = 0;
+        RegAccess_Registers[index].writes = 0;
+        RegAccess_Registers[index].key    = REG_ACCESS_FREE;
+    }
+    for(index = 0; index < REG_ACCESS_APIS_NUM; index++)
+    {
+        RegAccess_Apis[index].calls  = 0;
+        RegAccess_Apis[index].reads  = 0;
+        RegAccess_Apis[index].writes = 0;
+        RegAccess_Apis[index].key    = REG_ACCESS_FREE;
+    }
+    RegAccess_Dropped = 0;
+#if (REG_ACCESS_LOG_SIZE > 0U)
+    for(index = 0; index < REG_ACCESS_LOG_SIZE; index++)
+    {
+        RegAccess_Log[index].sequence = 0;
+    }
+    RegAccess_LogHead = 0;
+#endif
+}
+
+/*********************************************************************************************/
+Std_ReturnType RegAccess_GetNextRegister(uint32 * Iterator, RegAccess_RegisterStatsType * Stats)
+{
+    RegAccess_SlotType * slot;
+
+    if((Iterator == NULL_PTR) || (Stats == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+    for(; *Iterator < REG_ACCESS_REGISTERS_NUM; (*Iterator)++)
+    {
+        slot = &RegAccess_Registers[*Iterator];
+        if(slot->key != REG_ACCESS_FREE)
+        {
+            Stats->address = slot->key;
+            Stats->reads   = slot->reads;
+            Stats->writes  = slot->writes;
+            (*Iterator)++;
+            return E_OK;
+        }
+    }
+    return E_NOT_OK;
+}
+
+/*********************************************************************************************/
+Std_ReturnType RegAccess_GetNextApi(uint32 * Iterator, RegAccess_ApiStatsType * Stats)
+{
+    RegAccess_SlotType * slot;
+    uint32 key;
+
+    if((Iterator == NULL_PTR) || (Stats == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+    for(; *Iterator < REG_ACCESS_APIS_NUM; (*Iterator)++)
+    {
+        slot = &RegAccess_Apis[*Iterator];
+        key  = slot->key;
+        if(key != REG_ACCESS_FREE)
+        {
+            Stats->module_id = (uint16)(key >> 8);
+            Stats->api_id    = (uint8)key;
+            Stats->calls     = slot->calls;
+            Stats->reads     = slot->reads;
+            Stats->writes    = slot->writes;
+            (*Iterator)++;
+            return E_OK;
+        }
+    }
+    return E_NOT_OK;
+}
+
+/*********************************************************************************************/
+void RegAccess_GetApiStats(uint16 ModuleId, uint8 ApiId, RegAccess_ApiStatsType * Stats)
+{
+    uint32 key   = REG_ACCESS_API_KEY(ModuleId, ApiId);
+    uint32 index = (uint32)(key * 2654435761U) >> (32U - REG_ACCESS_APIS_BITS);
+    uint32 probe;
+    RegAccess_SlotType * slot;
+
+    if(Stats == NULL_PTR)
+    {
+        return;
+    }
+    Stats->module_id = ModuleId;
+    Stats->api_id    = ApiId;
+    Stats->calls     = 0;
+    Stats->reads     = 0;
+    Stats->writes    = 0;
+
+    /* Look up without claiming a slot */
+    for(probe = 0; probe < REG_ACCESS_MAX_PROBES; probe++)
+    {
+        slot = &RegAccess_Apis[(index + probe) & (REG_ACCESS_APIS_NUM - 1U)];
+        if(slot->key == key)
+        {
+            Stats->calls  = slot->calls;
+            Stats->reads  = slot->reads;
+            Stats->writes = slot->writes;
+            return;
+        }
+        if(slot->key == REG_ACCESS_FREE)
+        {
+            return;
+        }
+    }
+}
+
+/*********************************************************************************************/
+uint32 RegAccess_GetDroppedCount(void)
+{
+    return RegAccess_Dropped;
+}
+
+#if (REG_ACCESS_LOG_SIZE > 0U)
+/*********************************************************************************************/
+uint32 RegAccess_GetLogCount(void)
+{
+    return RegAccess_LogHead;
+}
+
+/*********************************************************************************************/
+Std_ReturnType RegAccess_ReadLog(uint32 Number, RegAccess_LogEntryType * Entry)
+{
+    RegAccess_LogSlotType * log = &RegAccess_Log[Number & (REG_ACCESS_LOG_SIZE - 1U)];
+
+    if((Entry == NULL_PTR) || (log->sequence != (Number + 1U)))
+    {
+        return E_NOT_OK;
+    }
+    Cpu_DataMemoryBarrier();
+    *Entry = log->entry;
+    Cpu_DataMemoryBarrier();
+    return (log->sequence == (Number + 1U)) ? E_OK : E_NOT_OK;
+}
+#endif
+
+#endif /* REG_ACCESS_STATS == STD_ON */
+
+#if (REG_ACCESS_CAPTURE == STD_ON)
+
+RegAccess_CaptureType RegAccess_Capture;
+
+/* TRUE between RegAccess_CaptureStart and RegAccess_CaptureStop */
+STATIC volatile boolean RegAccess_Capturing = FALSE;
+
+/*********************************************************************************************/
+/* Description: Append a write to the capture while it is started */
+STATIC void RegAccess_CaptureWrite(uint32 Address, uint32 Value, uint8 Type)
+{
+    uint32 record;
+    uint32 words;
+    uint32 used;
+
+    if(RegAccess_Capturing == FALSE)
+    {
+        return;
+    }
+
+    if((Address - REG_ACCESS_CAPTURE_PERIPH_BASE) <= REG_ACCESS_CAPTURE_OFFSET_MASK)
+    {
+        record = Address - REG_ACCESS_CAPTURE_PERIPH_BASE;
+    }
+    else if((Address - REG_ACCESS_CAPTURE_SCS_BASE) <= REG_ACCESS_CAPTURE_OFFSET_MASK)
+    {
+        record = REG_ACCESS_CAPTURE_SCS | (Address - REG_ACCESS_CAPTURE_SCS_BASE);
+    }
+    else
+    {
+        (void)Cpu_AtomicFetchIncrement(&RegAccess_Capture.dropped);
+        return;
+    }
+
+    if(Type == REG_ACCESS_WRITE8)
+    {
+        record |= REG_ACCESS_CAPTURE_BYTE | ((Value & REG_ACCESS_CAPTURE_VALUE_MASK) << REG_ACCESS_CAPTURE_VALUE_SHIFT);
+        words = 1U;
+    }
+    else
+    {
+        words = 2U;
+    }
+
+    /* Reserve the words of the record ... an ISR reserving in between makes this one try again */
+    do
+    {
+        used = RegAccess_Capture.used;
+        if((used + words) > REG_ACCESS_CAPTURE_WORDS)
+        {
+            (void)Cpu_AtomicFetchIncrement(&RegAccess_Capture.dropped);
+            return;
+        }
+    } while(Cpu_AtomicCompareExchange(&RegAccess_Capture.used, used, used + words) != used);
+
+    RegAccess_Capture.word[used] = record;
+    if(words == 2U)
+    {
+        RegAccess_Capture.word[used + 1U] = Value;
+    }
+    (void)Cpu_AtomicFetchIncrement(&RegAccess_Capture.writes);
+}
+
+/*********************************************************************************************/
+void RegAccess_CaptureStart(void)
+{
+    RegAccess_Capturing = FALSE;
+    RegAccess_Capture.magic   = 0;
+    RegAccess_Capture.used    = 0;
+    RegAccess_Capture.writes  = 0;
+    RegAccess_Capture.dropped = 0;
+    Cpu_DataMemoryBarrier();
+    RegAccess_Capturing = TRUE;
+}
+
+/*********************************************************************************************/
+void RegAccess_CaptureStop(void)
+{
+    RegAccess_Capturing = FALSE;
+    Cpu_DataMemoryBarrier();
+    RegAccess_Capture.magic = REG_ACCESS_CAPTURE_MAGIC;
+}
+
+#endif /* REG_ACCESS_CAPTURE == STD_ON */
+
+#if ((REG_ACCESS_STATS == STD_ON) || (REG_ACCESS_CAPTURE == STD_ON))
+/*********************************************************************************************/
+void RegAccess_Write32(uint32 Address, uint32 Value)
+{
+#if (REG_ACCESS_STATS == STD_ON)
+    RegAccess_Count(Address, Value, REG_ACCESS_WRITE);
+#endif
+#if (REG_ACCESS_CAPTURE == STD_ON)
+    RegAccess_CaptureWrite(Address, Value, REG_ACCESS_WRITE);
+#endif
+    REG_RAW_WRITE32(Address, Value);
+}
+
+/*********************************************************************************************/
+void RegAccess_Write8(uint32 Address, uint8 Value)
+{
+#if (REG_ACCESS_STATS == STD_ON)
+    RegAccess_Count(Address, Value, REG_ACCESS_WRITE8);
+#endif
+#if (REG_ACCESS_CAPTURE == STD_ON)
+    RegAccess_CaptureWrite(Address, Value, REG_ACCESS_WRITE8);
+#endif
+    REG_RAW_WRITE8(Address, Value);
+}
+#endif
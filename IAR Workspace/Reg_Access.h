@@ -0,0 +1,249 @@
+ /******************************************************************************
+ *
+ * Module: Common - Register Access
+ *
+ * File Name: Reg_Access.h
+ *
+ * Description: Access to the memory mapped peripheral registers by their absolute
+ *              address, used by the Port, Dio and Gpt Drivers.
+ *
+ *              Target builds dereference the address as a volatile pointer, the
+ *              same code as the *_REG macros of tm4c123gh6pm_registers.h.
+ *              Host builds (HOST_BUILD defined) call the register file of
+ *              Host Simulation/RegSim.c instead, which models the side effects of
+ *              the GPIO, SYSCTL, timer, SysTick and NVIC registers so the drivers
+ *              run unmodified on a PC.
+ *
+ *              With REG_ACCESS_STATS STD_ON, on the host or on the target, every
+ *              access goes through Reg_Access.c which counts the reads and writes
+ *              per register and per service of the drivers, and logs the last
+ *              REG_ACCESS_LOG_SIZE accesses. With STD_OFF (the default) the
+ *              macros are the plain accesses and the services marks are empty.
+ *
+ *              With REG_ACCESS_CAPTURE STD_ON the writes between
+ *              REG_ACCESS_CAPTURE_START and REG_ACCESS_CAPTURE_STOP are recorded
+ *              in order in RegAccess_Capture, a compact binary log to dump from
+ *              RAM and replay by Host Tools/RegAccess_CaptureReplay.c.
+ *
+ * Author: Omar Anwar
+ *
+ *******************************************************************************/
+
+#ifndef REG_ACCESS_H
+#define REG_ACCESS_H
+
+#include "Std_Types.h"
+
+/* Pre-compile option for the access statistics ... STD_OFF costs nothing, override it on the command line */
+#ifndef REG_ACCESS_STATS
+#define REG_ACCESS_STATS                (STD_OFF)
+#endif
+
+/* Number of the last accesses kept in the log with REG_ACCESS_STATS, a power of two or 0 for no log */
+#ifndef REG_ACCESS_LOG_SIZE
+#define REG_ACCESS_LOG_SIZE             (0U)
+#endif
+
+/* Pre-compile option for the capture of the register writes ... STD_OFF costs nothing, override it on the command line */
+#ifndef REG_ACCESS_CAPTURE
+#define REG_ACCESS_CAPTURE              (STD_OFF)
+#endif
+
+/* Words of the capture buffer with REG_ACCESS_CAPTURE, a 32-bit write takes 2 words and an 8-bit write 1 */
+#ifndef REG_ACCESS_CAPTURE_WORDS
+#define REG_ACCESS_CAPTURE_WORDS        (1024U)
+#endif
+
+#ifdef HOST_BUILD
+
+/* Description: Read and write a register of the simulated register file */
+uint32 RegSim_Read32(uint32 Address);
+void RegSim_Write32(uint32 Address, uint32 Value);
+void RegSim_Write8(uint32 Address, uint8 Value);
+
+#define REG_RAW_READ32(ADDRESS)         RegSim_Read32((uint32)(ADDRESS))
+#define REG_RAW_WRITE32(ADDRESS, VALUE) RegSim_Write32((uint32)(ADDRESS), (uint32)(VALUE))
+#define REG_RAW_WRITE8(ADDRESS, VALUE)  RegSim_Write8((uint32)(ADDRESS), (uint8)(VALUE))
+
+#else
+
+#define REG_RAW_READ32(ADDRESS)         (*(volatile uint32 *)(ADDRESS))
+#define REG_RAW_WRITE32(ADDRESS, VALUE) (*(volatile uint32 *)(ADDRESS) = (uint32)(VALUE))
+#define REG_RAW_WRITE8(ADDRESS, VALUE)  (*(volatile uint8 *)(ADDRESS) = (uint8)(VALUE))
+
+#endif
+
+/* Types of the logged and captured accesses */
+#define REG_ACCESS_READ                 (0U)
+#define REG_ACCESS_WRITE                (1U)
+#define REG_ACCESS_WRITE8               (2U)
+
+#if (REG_ACCESS_STATS == STD_ON)
+
+#if ((REG_ACCESS_LOG_SIZE & (REG_ACCESS_LOG_SIZE - 1)) != 0)
+  #error "REG_ACCESS_LOG_SIZE shall be a power of 2"
+#endif
+
+/* Counters of the registers and of the services as powers of two, and the slots tried before an access is dropped */
+#define REG_ACCESS_REGISTERS_BITS       (7U)
+#define REG_ACCESS_APIS_BITS            (6U)
+#define REG_ACCESS_MAX_PROBES           (8U)
+
+/* Service Id of the accesses of the ISRs of a module */
+#define REG_ACCESS_ISR_API_ID           (0xFFU)
+
+/* Module Id of the accesses before the first marked service */
+#define REG_ACCESS_NO_MODULE_ID         (0U)
+
+/* Description: Accesses of one register, returned by RegAccess_GetNextRegister */
+typedef struct
+{
+    uint32 address;
+    uint32 reads;
+    uint32 writes;
+}RegAccess_RegisterStatsType;
+
+/* Description: Accesses of one service, returned by RegAccess_GetNextApi and RegAccess_GetApiStats */
+typedef struct
+{
+    uint16 module_id;
+    uint8 api_id;          /* REG_ACCESS_ISR_API_ID for the ISRs of the module */
+    uint32 calls;
+    uint32 reads;
+    uint32 writes;
+}RegAccess_ApiStatsType;
+
+/* Description: One logged access */
+typedef struct
+{
+    uint32 address;
+    uint32 value;          /* Value read or written */
+    uint16 module_id;      /* Service the access was made by */
+    uint8 api_id;
+    uint8 type;            /* REG_ACCESS_READ, REG_ACCESS_WRITE or REG_ACCESS_WRITE8 */
+}RegAccess_LogEntryType;
+
+/* Description: Count and log an access, then make it */
+uint32 RegAccess_Read32(uint32 Address);
+void RegAccess_Write32(uint32 Address, uint32 Value);
+void RegAccess_Write8(uint32 Address, uint8 Value);
+
+/* Description: Count a call of a service, its accesses are counted for it until the next marked service */
+void RegAccess_EnterApi(uint16 ModuleId, uint8 ApiId);
+
+/* Description: Count the accesses of an ISR for its module and give them back to the interrupted service at the exit */
+void RegAccess_EnterIsr(uint16 ModuleId);
+void RegAccess_ExitIsr(void);
+
+/* Description: Clear the counters and the log */
+void RegAccess_Reset(void);
+
+/* Description: Enumerate the accessed registers or the called services, set Iterator to 0 before the first call.
+ *              Return E_NOT_OK when there are no more */
+Std_ReturnType RegAccess_GetNextRegister(uint32 * Iterator, RegAccess_RegisterStatsType * Stats);
+Std_ReturnType RegAccess_GetNextApi(uint32 * Iterator, RegAccess_ApiStatsType * Stats);
+
+/* Description: Return the accesses of one service, all 0 if it was not called */
+void RegAccess_GetApiStats(uint16 ModuleId, uint8 ApiId, RegAccess_ApiStatsType * Stats);
+
+/* Description: Return the number of the registers or services not counted because their table was full */
+uint32 RegAccess_GetDroppedCount(void);
+
+#if (REG_ACCESS_LOG_SIZE > 0U)
+/* Description: Return the number of the accesses logged since the reset, the log keeps the last REG_ACCESS_LOG_SIZE */
+uint32 RegAccess_GetLogCount(void);
+
+/* Description: Copy the logged access Number, from 0 for the first one. Return E_NOT_OK if it was overwritten */
+Std_ReturnType RegAccess_ReadLog(uint32 Number, RegAccess_LogEntryType * Entry);
+#endif
+
+/* Marks at the entry of the services and around the ISRs of the drivers */
+#define REG_ACCESS_API(MODULE_ID, API_ID)   RegAccess_EnterApi((MODULE_ID), (API_ID))
+#define REG_ACCESS_ISR_ENTER(MODULE_ID)     RegAccess_EnterIsr(MODULE_ID)
+#define REG_ACCESS_ISR_EXIT()               RegAccess_ExitIsr()
+
+#else
+
+#define REG_ACCESS_API(MODULE_ID, API_ID)   ((void)0)
+#define REG_ACCESS_ISR_ENTER(MODULE_ID)     ((void)0)
+#define REG_ACCESS_ISR_EXIT()               ((void)0)
+
+#endif
+
+#if (REG_ACCESS_CAPTURE == STD_ON)
+
+/*
+ * Capture record format, one word followed by the value word for a 32-bit write:
+ *  bit  [31]    --> 1 in the System Control Space at 0xE000E000, 0 in the peripherals at 0x40000000
+ *  bit  [30]    --> 1 for an 8-bit write, its value is in bits [27:20] and no value word follows
+ *  bits [19:0]  --> offset of the register from the base of its space
+ */
+#define REG_ACCESS_CAPTURE_SCS          (0x80000000U)
+#define REG_ACCESS_CAPTURE_BYTE         (0x40000000U)
+#define REG_ACCESS_CAPTURE_VALUE_SHIFT  20
+#define REG_ACCESS_CAPTURE_VALUE_MASK   (0xFFU)
+#define REG_ACCESS_CAPTURE_OFFSET_MASK  (0x000FFFFFU)
+#define REG_ACCESS_CAPTURE_PERIPH_BASE  (0x40000000U)
+#define REG_ACCESS_CAPTURE_SCS_BASE     (0xE000E000U)
+
+/* Value of RegAccess_Capture.magic once REG_ACCESS_CAPTURE_STOP completed the capture ... "RCAP" */
+#define REG_ACCESS_CAPTURE_MAGIC        (0x50414352U)
+
+/* Description: Captured writes ... dump it from RAM, the header and the first used words are enough */
+typedef struct
+{
+    volatile uint32 magic;      /* REG_ACCESS_CAPTURE_MAGIC when the capture is complete */
+    volatile uint32 used;       /* Words of the records */
+    volatile uint32 writes;     /* Captured writes */
+    volatile uint32 dropped;    /* Writes not captured, the buffer was full or the address is outside both spaces */
+    uint32 word[REG_ACCESS_CAPTURE_WORDS];
+}RegAccess_CaptureType;
+
+/* Description: Clear the capture and record the writes from now on */
+void RegAccess_CaptureStart(void);
+
+/* Description: Stop recording the writes and mark the capture complete */
+void RegAccess_CaptureStop(void);
+
+extern RegAccess_CaptureType RegAccess_Capture;
+
+#define REG_ACCESS_CAPTURE_START()      RegAccess_CaptureStart()
+#define REG_ACCESS_CAPTURE_STOP()       RegAccess_CaptureStop()
+
+#else
+
+#define REG_ACCESS_CAPTURE_START()      ((void)0)
+#define REG_ACCESS_CAPTURE_STOP()       ((void)0)
+
+#endif
+
+/* The reads go through Reg_Access.c to be counted, the writes to be counted or captured */
+#if (REG_ACCESS_STATS == STD_ON)
+#define REG_READ32(ADDRESS)             RegAccess_Read32((uint32)(ADDRESS))
+#else
+#define REG_READ32(ADDRESS)             REG_RAW_READ32(ADDRESS)
+#endif
+
+#if ((REG_ACCESS_STATS == STD_ON) || (REG_ACCESS_CAPTURE == STD_ON))
+#if (REG_ACCESS_STATS == STD_OFF)
+/* Description: Capture a write, then make it */
+void RegAccess_Write32(uint32 Address, uint32 Value);
+void RegAccess_Write8(uint32 Address, uint8 Value);
+#endif
+#define REG_WRITE32(ADDRESS, VALUE)     RegAccess_Write32((uint32)(ADDRESS), (uint32)(VALUE))
+#define REG_WRITE8(ADDRESS, VALUE)      RegAccess_Write8((uint32)(ADDRESS), (uint8)(VALUE))
+#else
+#define REG_WRITE32(ADDRESS, VALUE)     REG_RAW_WRITE32((ADDRESS), (VALUE))
+#define REG_WRITE8(ADDRESS, VALUE)      REG_RAW_WRITE8((ADDRESS), (VALUE))
+#endif
+
+/* Read-modify-write of the bits of MASK ... one read and one write like the |= and &= operators */
+#define REG_SET_MASK32(ADDRESS, MASK)   REG_WRITE32((ADDRESS), REG_READ32(ADDRESS) | (uint32)(MASK))
+#define REG_CLEAR_MASK32(ADDRESS, MASK) REG_WRITE32((ADDRESS), REG_READ32(ADDRESS) & ~(uint32)(MASK))
+
+/* Set, clear and test one bit of a register */
+#define REG_SET_BIT32(ADDRESS, BIT)     REG_SET_MASK32((ADDRESS), (1UL << (BIT)))
+#define REG_CLEAR_BIT32(ADDRESS, BIT)   REG_CLEAR_MASK32((ADDRESS), (1UL << (BIT)))
+#define REG_BIT_IS_SET32(ADDRESS, BIT)  (REG_READ32(ADDRESS) & (1UL << (BIT)))
+
+#endif /* REG_ACCESS_H */
@@ -23,6 +23,18 @@ extern void SVC_Handler( void );
 extern void DebugMon_Handler( void );
 extern void PendSV_Handler( void );
 extern void SysTick_Handler( void );
+extern void Timer0A_Handler( void );
+extern void Timer1A_Handler( void );
+extern void Timer2A_Handler( void );
+extern void Timer3A_Handler( void );
+extern void Timer4A_Handler( void );
+extern void Timer5A_Handler( void );
+extern void WideTimer0A_Handler( void );
+extern void WideTimer1A_Handler( void );
+extern void WideTimer2A_Handler( void );
+extern void WideTimer3A_Handler( void );
+extern void WideTimer4A_Handler( void );
+extern void WideTimer5A_Handler( void );
 
 typedef void( *intfunc )( void );
 typedef union { intfunc __fun; void * __ptr; } intvec_elem;
@@ -56,7 +68,114 @@ const intvec_elem __vector_table[] =
   DebugMon_Handler,
   0,
   PendSV_Handler,
-  SysTick_Handler
+  SysTick_Handler,
+
+  // External interrupts, 0 for the interrupts without a handler
+  0,  // IRQ 0
+  0,  // IRQ 1
+  0,  // IRQ 2
+  0,  // IRQ 3
+  0,  // IRQ 4
+  0,  // IRQ 5
+  0,  // IRQ 6
+  0,  // IRQ 7
+  0,  // IRQ 8
+  0,  // IRQ 9
+  0,  // IRQ 10
+  0,  // IRQ 11
+  0,  // IRQ 12
+  0,  // IRQ 13
+  0,  // IRQ 14
+  0,  // IRQ 15
+  0,  // IRQ 16
+  0,  // IRQ 17
+  0,  // IRQ 18
+  Timer0A_Handler,  // IRQ 19
+  0,  // IRQ 20
+  Timer1A_Handler,  // IRQ 21
+  0,  // IRQ 22
+  Timer2A_Handler,  // IRQ 23
+  0,  // IRQ 24
+  0,  // IRQ 25
+  0,  // IRQ 26
+  0,  // IRQ 27
+  0,  // IRQ 28
+  0,  // IRQ 29
+  0,  // IRQ 30
+  0,  // IRQ 31
+  0,  // IRQ 32
+  0,  // IRQ 33
+  0,  // IRQ 34
+  Timer3A_Handler,  // IRQ 35
+  0,  // IRQ 36
+  0,  // IRQ 37
+  0,  // IRQ 38
+  0,  // IRQ 39
+  0,  // IRQ 40
+  0,  // IRQ 41
+  0,  // IRQ 42
+  0,  // IRQ 43
+  0,  // IRQ 44
+  0,  // IRQ 45
+  0,  // IRQ 46
+  0,  // IRQ 47
+  0,  // IRQ 48
+  0,  // IRQ 49
+  0,  // IRQ 50
+  0,  // IRQ 51
+  0,  // IRQ 52
+  0,  // IRQ 53
+  0,  // IRQ 54
+  0,  // IRQ 55
+  0,  // IRQ 56
+  0,  // IRQ 57
+  0,  // IRQ 58
+  0,  // IRQ 59
+  0,  // IRQ 60
+  0,  // IRQ 61
+  0,  // IRQ 62
+  0,  // IRQ 63
+  0,  // IRQ 64
+  0,  // IRQ 65
+  0,  // IRQ 66
+  0,  // IRQ 67
+  0,  // IRQ 68
+  0,  // IRQ 69
+  Timer4A_Handler,  // IRQ 70
+  0,  // IRQ 71
+  0,  // IRQ 72
+  0,  // IRQ 73
+  0,  // IRQ 74
+  0,  // IRQ 75
+  0,  // IRQ 76
+  0,  // IRQ 77
+  0,  // IRQ 78
+  0,  // IRQ 79
+  0,  // IRQ 80
+  0,  // IRQ 81
+  0,  // IRQ 82
+  0,  // IRQ 83
+  0,  // IRQ 84
+  0,  // IRQ 85
+  0,  // IRQ 86
+  0,  // IRQ 87
+  0,  // IRQ 88
+  0,  // IRQ 89
+  0,  // IRQ 90
+  0,  // IRQ 91
+  Timer5A_Handler,  // IRQ 92
+  0,  // IRQ 93
+  WideTimer0A_Handler,  // IRQ 94
+  0,  // IRQ 95
+  WideTimer1A_Handler,  // IRQ 96
+  0,  // IRQ 97
+  WideTimer2A_Handler,  // IRQ 98
+  0,  // IRQ 99
+  WideTimer3A_Handler,  // IRQ 100
+  0,  // IRQ 101
+  WideTimer4A_Handler,  // IRQ 102
+  0,  // IRQ 103
+  WideTimer5A_Handler   // IRQ 104
 
 };
 
@@ -78,6 +197,30 @@ __weak void DebugMon_Handler( void ) { while (1) {} }
 __weak void PendSV_Handler( void ) { while (1) {} }
 #pragma call_graph_root = "interrupt"
 __weak void SysTick_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void Timer0A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void Timer1A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void Timer2A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void Timer3A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void Timer4A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void Timer5A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void WideTimer0A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void WideTimer1A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void WideTimer2A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void WideTimer3A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void WideTimer4A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void WideTimer5A_Handler( void ) { while (1) {} }
 
 
 void __cmain( void );
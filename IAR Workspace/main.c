@@ -1,7 +1,43 @@
 #include "Os.h"
+#include "Mcu.h"
+#include "Det.h"
+#include "Cpu.h"
+#include "PortDio_Bench.h"
 
 int main(void)
 {
+    uint32 pll_polls = MCU_PLL_LOCK_TIMEOUT;
+
+    /* Keep the errors logged before a warm reset ... the drivers may report errors from now on */
+    Det_Init();
+
+    /* Run the core from the PLL ... the Os timer and the cycle counter depend on this clock */
+    Mcu_Init(&Mcu_Configuration);
+    if(E_OK == Mcu_InitClock(McuConf_CORE_CLOCK_SETTING))
+    {
+        while((Mcu_GetPllStatus() == MCU_PLL_UNLOCKED) && (pll_polls > 0U))
+        {
+            pll_polls--;
+        }
+        Mcu_DistributePllClock(); /* Reports MCU_E_PLL_NOT_LOCKED to the Det after the timeout */
+    }
+
+    /* The cycle counter, the timestamp, the Icu and the Os load convert times at the compile time
+     * McuConf_CORE_CLOCK_FREQUENCY ... at another clock they are all wrong, so stop here with the
+     * clock errors in the Det log, which survives the warm reset of a debugger */
+    if(Mcu_GetSysClockFrequency() != McuConf_CORE_CLOCK_FREQUENCY)
+    {
+        while(1)
+        {
+        }
+    }
+
+#if (PORTDIO_BENCH_AT_STARTUP == STD_ON)
+    /* Measure the Port and Dio services into PortDio_BenchTable ... dump it by the debugger */
+    Cpu_InitCycleCounter();
+    PortDio_Bench_Run();
+#endif
+
     /* Start the Os */
     Os_start();
 }
@@ -136,6 +136,15 @@ GPIO registers (PORTF)
 #define GPIO_PORTF_ICR_REG        (*((volatile uint32 *)0x4002541C))
 
 #define SYSCTL_REGCGC2_REG        (*((volatile uint32 *)0x400FE108))
+#define SYSCTL_PRGPIO_REG         (*((volatile uint32 *)0x400FEA08))
+
+/*****************************************************************************
+General-Purpose Timers Clock Gating Registers
+*****************************************************************************/
+#define SYSCTL_RCGCTIMER_REG      (*((volatile uint32 *)0x400FE604))
+#define SYSCTL_RCGCWTIMER_REG     (*((volatile uint32 *)0x400FE65C))
+#define SYSCTL_PRTIMER_REG        (*((volatile uint32 *)0x400FEA04))
+#define SYSCTL_PRWTIMER_REG       (*((volatile uint32 *)0x400FEA5C))
 
 
 /*****************************************************************************
@@ -149,6 +158,7 @@ Systick Timer Registers
 PLL Registers
 *****************************************************************************/
 #define SYSCTL_RIS_REG            (*((volatile uint32 *)0x400FE050))
+#define SYSCTL_MISC_REG           (*((volatile uint32 *)0x400FE058))
 #define SYSCTL_RCC_REG            (*((volatile uint32 *)0x400FE060))
 #define SYSCTL_RCC2_REG           (*((volatile uint32 *)0x400FE070))
 
@@ -202,9 +212,17 @@ NVIC Registers
 #define NVIC_DIS3_REG             (*((volatile uint32 *)0xE000E18C))
 #define NVIC_DIS4_REG             (*((volatile uint32 *)0xE000E190))
 
+#define NVIC_INT_CTRL_REG         (*((volatile uint32 *)0xE000ED04))
 #define NVIC_SYSTEM_PRI1_REG      (*((volatile uint32 *)0xE000ED18))
 #define NVIC_SYSTEM_PRI2_REG      (*((volatile uint32 *)0xE000ED1C))
 #define NVIC_SYSTEM_PRI3_REG      (*((volatile uint32 *)0xE000ED20))
 #define NVIC_SYSTEM_SYSHNDCTRL    (*((volatile uint32 *)0xE000ED24))
 
+/*****************************************************************************
+Data Watchpoint and Trace (DWT) Registers
+*****************************************************************************/
+#define CORE_DEMCR_REG            (*((volatile uint32 *)0xE000EDFC))
+#define DWT_CTRL_REG              (*((volatile uint32 *)0xE0001000))
+#define DWT_CYCCNT_REG            (*((volatile uint32 *)0xE0001004))
+
 #endif
@@ -11,7 +11,7 @@
 
 #include "Port.h"
 #include "Port_Regs.h"
-#include "tm4c123gh6pm_registers.h"
+#include "Reg_Access.h"
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
@@ -25,6 +25,9 @@
 
 #endif
 
+/* Value of the PMCx bits of the GPIOPCTL register for the alternative function modes PORT_PIN_MODE_ALT1..9 */
+#define PORT_PMC_VALUE(MODE)    ((uint32)((MODE) - PORT_PIN_MODE_ALT1 + 1) & 0x0000000F)
+
 STATIC const Port_ConfigPin * Port_configPtr = NULL_PTR;
 STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
 /************************************************************************************
@@ -43,8 +46,9 @@ STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
  ************************************************************************************/
 void Port_Init(const Port_ConfigType* ConfigPtr)
 {
+	REG_ACCESS_API(PORT_MODULE_ID, PORT_INIT_SID);
 
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
+#if PORT_DEV_ERROR_CHECK(PORT_DEV_ERROR_INIT, PORT_DEV_ERROR_POINTER_CHECK)
 	/* check if the input configuration pointer is not a NULL_PTR */
 	if (NULL_PTR == ConfigPtr)
 	{
@@ -64,9 +68,8 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
 	}
 
 	/* point to the required Port Registers base address */
-	volatile uint32 * PortGpio_Ptr = NULL_PTR;
+	uint32 PortGpio_Base = 0;
 
-	volatile uint32 delay = 0;
 	volatile Port_PinType pinIndex = PORT_PIN0_ID;
 
 	for (pinIndex = PORT_PIN0_ID; pinIndex < PORT_CONFIGURED_PINS; ++pinIndex)
@@ -74,38 +77,38 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
 		switch (Port_configPtr[pinIndex].port_num)
 		{
 		case PORT_PORTA_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTB_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTB_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTC_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTC_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTD_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTD_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTE_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTE_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTF_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTF_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		default:
 			break;
 		}
-		/* Enable clock for PORT and allow time for clock to start*/
-		SYSCTL_REGCGC2_REG |= (1<<ConfigPtr->Pin[pinIndex].port_num);
-		delay = SYSCTL_REGCGC2_REG;
+		/* Enable clock for PORT and wait until the PORT is ready */
+		REG_SET_BIT32(SYSCTL_RCGC2_ADDRESS, ConfigPtr->Pin[pinIndex].port_num);
+		while(!REG_BIT_IS_SET32(SYSCTL_PRGPIO_ADDRESS, ConfigPtr->Pin[pinIndex].port_num));
 
 		if( ((Port_configPtr[pinIndex].port_num == PORT_PORTD_ID) && (Port_configPtr[pinIndex].pin_num == PORT_PIN7_ID)) /* PD7 */
 				|| ((Port_configPtr[pinIndex].port_num == PORT_PORTF_ID) && (Port_configPtr[pinIndex].pin_num == PORT_PIN0_ID)) ) /* PF0 */
 		{
 			/* Unlock the GPIOCR register */
-			*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
+			REG_WRITE32(PortGpio_Base + PORT_LOCK_REG_OFFSET, PORT_UNLOCK_VALUE);
 
 			/* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+			REG_SET_BIT32(PortGpio_Base + PORT_COMMIT_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 		}
 		else if( (Port_configPtr[pinIndex].port_num == PORT_PORTC_ID) && (Port_configPtr[pinIndex].pin_num <= PORT_PIN3_ID)) /* PC0 to PC3 */
 		{
@@ -127,16 +130,16 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
 			 */
 
 			/* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+			REG_CLEAR_BIT32(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 
 			/* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+			REG_CLEAR_BIT32(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 
 			/* Clear the PMCx bits for this pin */
-			*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));
+			REG_CLEAR_MASK32(PortGpio_Base + PORT_CTL_REG_OFFSET, 0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));
 
 			/* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+			REG_SET_BIT32(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 		}
 		else if (Port_configPtr[pinIndex].mode == PORT_PIN_MODE_ADC)
 		{
@@ -148,16 +151,16 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
 			 */
 
 			/* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+			REG_CLEAR_BIT32(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 
 			/* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+			REG_CLEAR_BIT32(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 
 			/* Clear the PMCx bits for this pin */
-			*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));
+			REG_CLEAR_MASK32(PortGpio_Base + PORT_CTL_REG_OFFSET, 0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));
 
 			/* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+			REG_SET_BIT32(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 		}
 		else /* Another mode */
 		{
@@ -169,56 +172,57 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
 			 */
 
 			/* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+			REG_CLEAR_BIT32(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 
 			/* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+			REG_SET_BIT32(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 
-			/* Write alternative function ID in the PMCx bits for this pin */
-			*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (Port_configPtr[pinIndex].mode & 0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));
+			/* Write alternative function ID in the PMCx bits for this pin ... PORT_PIN_MODE_ALTx selects the function x */
+			REG_CLEAR_MASK32(PortGpio_Base + PORT_CTL_REG_OFFSET, 0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));
+			REG_SET_MASK32(PortGpio_Base + PORT_CTL_REG_OFFSET, PORT_PMC_VALUE(Port_configPtr[pinIndex].mode) << (Port_configPtr[pinIndex].pin_num * 4));
 
 			/* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+			REG_SET_BIT32(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 		}
 
 		if(Port_configPtr[pinIndex].direction == PORT_PIN_OUT)
 		{
 			/* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+			REG_SET_BIT32(PortGpio_Base + PORT_DIR_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 
 			if(Port_configPtr[pinIndex].initial_value == PORT_PIN_LEVEL_LOW)
 			{
 				/* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+				REG_CLEAR_BIT32(PortGpio_Base + PORT_DATA_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 			}
 			else
 			{
 				/* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+				REG_SET_BIT32(PortGpio_Base + PORT_DATA_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 			}
 		}
 		else if(Port_configPtr[pinIndex].direction == PORT_PIN_IN)
 		{
 			/* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+			REG_CLEAR_BIT32(PortGpio_Base + PORT_DIR_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 
 			if(Port_configPtr[pinIndex].resistor == PULL_UP)
 			{
 				/* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+				REG_SET_BIT32(PortGpio_Base + PORT_PULL_UP_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 			}
 			else if(Port_configPtr[pinIndex].resistor == PULL_DOWN)
 			{
 				/* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+				REG_SET_BIT32(PortGpio_Base + PORT_PULL_DOWN_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 			}
 			else
 			{
 				/* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+				REG_CLEAR_BIT32(PortGpio_Base + PORT_PULL_UP_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 
 				/* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+				REG_CLEAR_BIT32(PortGpio_Base + PORT_PULL_DOWN_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 			}
 		}
 		else
@@ -246,43 +250,48 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction){
 	uint8 error = FALSE;
 
 	/* point to the required Port Registers base address */
-	volatile uint32 * PortGpio_Ptr = NULL_PTR;
+	uint32 PortGpio_Base = 0;
 
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	REG_ACCESS_API(PORT_MODULE_ID, PORT_SET_PIN_DIRECTION_SID);
 
-	/* check if the pin ID valid or not */
-	if ( Pin >= PORT_CONFIGURED_PINS)
-	{
+#if PORT_DEV_ERROR_CHECK(PORT_DEV_ERROR_SET_PIN_DIRECTION, PORT_DEV_ERROR_UNINIT_CHECK)
+	/* check if the port initialized or not */
+	if (Port_Status == PORT_NOT_INITIALIZED) {
 		Det_ReportError(PORT_MODULE_ID,
 				PORT_INSTANCE_ID,
 				PORT_SET_PIN_DIRECTION_SID,
-				PORT_E_PARAM_PIN);
+				PORT_E_UNINIT);
 		error = TRUE;
 	}
 	else
 	{
 		/* Do Nothing */
 	}
+#endif
 
-	/* check if the pin direction is changeable or not */
-	if (Port_configPtr[Pin].pinDirection_changeable == PORT_NOT_CHANGEABLE) {
+#if PORT_DEV_ERROR_CHECK(PORT_DEV_ERROR_SET_PIN_DIRECTION, PORT_DEV_ERROR_RANGE_CHECK)
+	/* check if the pin ID valid or not */
+	if ( Pin >= PORT_CONFIGURED_PINS)
+	{
 		Det_ReportError(PORT_MODULE_ID,
 				PORT_INSTANCE_ID,
 				PORT_SET_PIN_DIRECTION_SID,
-				PORT_E_DIRECTION_UNCHANGEABLE);
+				PORT_E_PARAM_PIN);
 		error = TRUE;
 	}
 	else
 	{
 		/* Do Nothing */
 	}
+#endif
 
-	/* check if the port initialized or not */
-	if (Port_Status == PORT_NOT_INITIALIZED) {
+#if PORT_DEV_ERROR_CHECK(PORT_DEV_ERROR_SET_PIN_DIRECTION, PORT_DEV_ERROR_CHANGEABLE_CHECK)
+	/* check if the pin direction is changeable or not ... the configuration is read only for a valid pin of an initialized driver */
+	if ((FALSE == error) && (Port_configPtr[Pin].pinDirection_changeable == PORT_NOT_CHANGEABLE)) {
 		Det_ReportError(PORT_MODULE_ID,
 				PORT_INSTANCE_ID,
 				PORT_SET_PIN_DIRECTION_SID,
-				PORT_E_UNINIT);
+				PORT_E_DIRECTION_UNCHANGEABLE);
 		error = TRUE;
 	}
 	else
@@ -296,22 +305,22 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction){
 		switch (Port_configPtr[Pin].port_num)
 		{
 		case PORT_PORTA_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTB_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTB_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTC_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTC_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTD_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTD_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTE_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTE_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTF_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTF_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		default:
 			break;
@@ -320,13 +329,13 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction){
 		if(PORT_PIN_OUT == Direction)
 		{
 			/* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+			REG_SET_BIT32(PortGpio_Base + PORT_DIR_REG_OFFSET, Port_configPtr[Pin].pin_num);
 
 		}
 		else if(PORT_PIN_IN == Direction)
 		{
 			/* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+			REG_CLEAR_BIT32(PortGpio_Base + PORT_DIR_REG_OFFSET, Port_configPtr[Pin].pin_num);
 
 		}
 		else
@@ -353,12 +362,13 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction){
 void Port_RefreshPortDirection(void){
 
 	uint8 error = FALSE;
-	volatile uint32 * PortGpio_Ptr = NULL_PTR;
+	uint32 PortGpio_Base = 0;
 	volatile Port_PinType pinIndex = PORT_PIN0_ID;
 
+	REG_ACCESS_API(PORT_MODULE_ID, PORT_REFRESH_PORT_DIRECTION_SID);
 
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
 
+#if PORT_DEV_ERROR_CHECK(PORT_DEV_ERROR_REFRESH_PORT_DIRECTION, PORT_DEV_ERROR_UNINIT_CHECK)
 	/* check if the port initialized or not */
 	if (Port_Status == PORT_NOT_INITIALIZED)
 	{
@@ -382,22 +392,22 @@ void Port_RefreshPortDirection(void){
 			switch (Port_configPtr[pinIndex].port_num)
 			{
 			case PORT_PORTA_ID:
-				PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
+				PortGpio_Base = GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
 				break;
 			case PORT_PORTB_ID:
-				PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTA Base Address */
+				PortGpio_Base = GPIO_PORTB_BASE_ADDRESS; /* PORTA Base Address */
 				break;
 			case PORT_PORTC_ID:
-				PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTA Base Address */
+				PortGpio_Base = GPIO_PORTC_BASE_ADDRESS; /* PORTA Base Address */
 				break;
 			case PORT_PORTD_ID:
-				PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTA Base Address */
+				PortGpio_Base = GPIO_PORTD_BASE_ADDRESS; /* PORTA Base Address */
 				break;
 			case PORT_PORTE_ID:
-				PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTA Base Address */
+				PortGpio_Base = GPIO_PORTE_BASE_ADDRESS; /* PORTA Base Address */
 				break;
 			case PORT_PORTF_ID:
-				PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTA Base Address */
+				PortGpio_Base = GPIO_PORTF_BASE_ADDRESS; /* PORTA Base Address */
 				break;
 			default:
 				break;
@@ -408,13 +418,13 @@ void Port_RefreshPortDirection(void){
 				if(PORT_PIN_OUT == Port_configPtr[pinIndex].direction)
 				{
 					/* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-					SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+					REG_SET_BIT32(PortGpio_Base + PORT_DIR_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 
 				}
 				else if(PORT_PIN_IN == Port_configPtr[pinIndex].direction)
 				{
 					/* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-					CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+					REG_CLEAR_BIT32(PortGpio_Base + PORT_DIR_REG_OFFSET, Port_configPtr[pinIndex].pin_num);
 
 				}
 				else
@@ -445,7 +455,7 @@ void Port_RefreshPortDirection(void){
  ************************************************************************************/
 #if (PORT_VERSION_INFO_API == STD_ON)
 void Port_GetVersionInfo(Std_VersionInfoType* versioninfo){
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
+#if PORT_DEV_ERROR_CHECK(PORT_DEV_ERROR_VERSION_INFO, PORT_DEV_ERROR_POINTER_CHECK)
 	/* Check if input pointer is not Null pointer */
 	if(NULL_PTR == versioninfo)
 	{
@@ -454,7 +464,7 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo){
 				PORT_GET_VERSION_INFO_SID, PORT_E_PARAM_POINTER);
 	}
 	else
-#endif /* (PORT_DEV_ERROR_DETECT == STD_ON) */
+#endif
 	{
 		/* Copy the vendor Id */
 		versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
@@ -488,43 +498,48 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode){
 	uint8 error = FALSE;
 
 	/* point to the required Port Registers base address */
-	volatile uint32 * PortGpio_Ptr = NULL_PTR;
+	uint32 PortGpio_Base = 0;
 
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	REG_ACCESS_API(PORT_MODULE_ID, PORT_SET_PIN_MODE_SID);
 
-	/* check if the pin ID valid or not */
-	if ( Pin >= PORT_CONFIGURED_PINS)
-	{
+#if PORT_DEV_ERROR_CHECK(PORT_DEV_ERROR_SET_PIN_MODE, PORT_DEV_ERROR_UNINIT_CHECK)
+	/* check if the port initialized or not */
+	if (Port_Status == PORT_NOT_INITIALIZED) {
 		Det_ReportError(PORT_MODULE_ID,
 				PORT_INSTANCE_ID,
 				PORT_SET_PIN_MODE_SID,
-				PORT_E_PARAM_PIN);
+				PORT_E_UNINIT);
 		error = TRUE;
 	}
 	else
 	{
 		/* Do Nothing */
 	}
+#endif
 
-	/* check if the pin Mode is changeable or not */
-	if (Port_configPtr[Pin].pinMode_changeable == PORT_NOT_CHANGEABLE) {
+#if PORT_DEV_ERROR_CHECK(PORT_DEV_ERROR_SET_PIN_MODE, PORT_DEV_ERROR_RANGE_CHECK)
+	/* check if the pin ID valid or not */
+	if ( Pin >= PORT_CONFIGURED_PINS)
+	{
 		Det_ReportError(PORT_MODULE_ID,
 				PORT_INSTANCE_ID,
 				PORT_SET_PIN_MODE_SID,
-				PORT_E_MODE_UNCHANGEABLE);
+				PORT_E_PARAM_PIN);
 		error = TRUE;
 	}
 	else
 	{
 		/* Do Nothing */
 	}
+#endif
 
-	/* check if the port initialized or not */
-	if (Port_Status == PORT_NOT_INITIALIZED) {
+#if PORT_DEV_ERROR_CHECK(PORT_DEV_ERROR_SET_PIN_MODE, PORT_DEV_ERROR_CHANGEABLE_CHECK)
+	/* check if the pin Mode is changeable or not ... the configuration is read only for a valid pin of an initialized driver */
+	if ((FALSE == error) && (Port_configPtr[Pin].pinMode_changeable == PORT_NOT_CHANGEABLE)) {
 		Det_ReportError(PORT_MODULE_ID,
 				PORT_INSTANCE_ID,
 				PORT_SET_PIN_MODE_SID,
-				PORT_E_UNINIT);
+				PORT_E_MODE_UNCHANGEABLE);
 		error = TRUE;
 	}
 	else
@@ -538,22 +553,22 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode){
 		switch (Port_configPtr[Pin].port_num)
 		{
 		case PORT_PORTA_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTB_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTB_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTC_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTC_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTD_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTD_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTE_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTE_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		case PORT_PORTF_ID:
-			PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTA Base Address */
+			PortGpio_Base = GPIO_PORTF_BASE_ADDRESS; /* PORTA Base Address */
 			break;
 		default:
 			break;
@@ -569,16 +584,16 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode){
 			 */
 
 			/* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+			REG_CLEAR_BIT32(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET, Port_configPtr[Pin].pin_num);
 
 			/* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+			REG_CLEAR_BIT32(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET, Port_configPtr[Pin].pin_num);
 
 			/* Clear the PMCx bits for this pin */
-			*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[Pin].pin_num * 4));
+			REG_CLEAR_MASK32(PortGpio_Base + PORT_CTL_REG_OFFSET, 0x0000000F << (Port_configPtr[Pin].pin_num * 4));
 
 			/* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+			REG_SET_BIT32(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET, Port_configPtr[Pin].pin_num);
 		}
 		else if (PORT_PIN_MODE_ADC == Mode)
 		{
@@ -590,16 +605,16 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode){
 			 */
 
 			/* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+			REG_CLEAR_BIT32(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET, Port_configPtr[Pin].pin_num);
 
 			/* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+			REG_CLEAR_BIT32(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET, Port_configPtr[Pin].pin_num);
 
 			/* Clear the PMCx bits for this pin */
-			*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[Pin].pin_num * 4));
+			REG_CLEAR_MASK32(PortGpio_Base + PORT_CTL_REG_OFFSET, 0x0000000F << (Port_configPtr[Pin].pin_num * 4));
 
 			/* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+			REG_SET_BIT32(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET, Port_configPtr[Pin].pin_num);
 		}
 		else /* Another mode */
 		{
@@ -611,16 +626,17 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode){
 			 */
 
 			/* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+			REG_CLEAR_BIT32(PortGpio_Base + PORT_ANALOG_MODE_SEL_REG_OFFSET, Port_configPtr[Pin].pin_num);
 
 			/* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+			REG_SET_BIT32(PortGpio_Base + PORT_ALT_FUNC_REG_OFFSET, Port_configPtr[Pin].pin_num);
 
-			/* Write alternative function ID in the PMCx bits for this pin */
-			*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (Port_configPtr[Pin].mode & 0x0000000F << (Port_configPtr[Pin].pin_num * 4));
+			/* Write alternative function ID in the PMCx bits for this pin ... PORT_PIN_MODE_ALTx selects the function x */
+			REG_CLEAR_MASK32(PortGpio_Base + PORT_CTL_REG_OFFSET, 0x0000000F << (Port_configPtr[Pin].pin_num * 4));
+			REG_SET_MASK32(PortGpio_Base + PORT_CTL_REG_OFFSET, PORT_PMC_VALUE(Mode) << (Port_configPtr[Pin].pin_num * 4));
 
 			/* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+			REG_SET_BIT32(PortGpio_Base + PORT_DIGITAL_ENABLE_REG_OFFSET, Port_configPtr[Pin].pin_num);
 		}
 	}
 
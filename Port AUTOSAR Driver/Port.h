@@ -42,6 +42,13 @@
 #define PORT_INITIALIZED                (1U)
 #define PORT_NOT_INITIALIZED            (0U)
 
+/*
+ * Macros for the Development Error Detect profiles of PORT_DEV_ERROR_PROFILE
+ */
+#define PORT_DEV_ERROR_PROFILE_ALL      (0U)
+#define PORT_DEV_ERROR_PROFILE_CONFIG   (1U)
+#define PORT_DEV_ERROR_PROFILE_CUSTOM   (2U)
+
 /* Standard AUTOSAR types */
 #include "Std_Types.h"
 
@@ -119,6 +126,33 @@
 /* APIs called with a Null Pointer */
 #define PORT_E_PARAM_POINTER 				((uint8)(0x10))
 
+/* APIs which check their development errors in the selected PORT_DEV_ERROR_PROFILE */
+#if (PORT_DEV_ERROR_PROFILE == PORT_DEV_ERROR_PROFILE_ALL)
+#define PORT_DEV_ERROR_INIT                     (STD_ON)
+#define PORT_DEV_ERROR_SET_PIN_DIRECTION        (STD_ON)
+#define PORT_DEV_ERROR_REFRESH_PORT_DIRECTION   (STD_ON)
+#define PORT_DEV_ERROR_VERSION_INFO             (STD_ON)
+#define PORT_DEV_ERROR_SET_PIN_MODE             (STD_ON)
+#elif (PORT_DEV_ERROR_PROFILE == PORT_DEV_ERROR_PROFILE_CONFIG)
+#define PORT_DEV_ERROR_INIT                     (STD_ON)
+#define PORT_DEV_ERROR_SET_PIN_DIRECTION        (STD_ON)
+#define PORT_DEV_ERROR_REFRESH_PORT_DIRECTION   (STD_OFF)
+#define PORT_DEV_ERROR_VERSION_INFO             (STD_ON)
+#define PORT_DEV_ERROR_SET_PIN_MODE             (STD_ON)
+#elif (PORT_DEV_ERROR_PROFILE == PORT_DEV_ERROR_PROFILE_CUSTOM)
+#define PORT_DEV_ERROR_INIT                     (PORT_DEV_ERROR_CUSTOM_INIT)
+#define PORT_DEV_ERROR_SET_PIN_DIRECTION        (PORT_DEV_ERROR_CUSTOM_SET_PIN_DIRECTION)
+#define PORT_DEV_ERROR_REFRESH_PORT_DIRECTION   (PORT_DEV_ERROR_CUSTOM_REFRESH_PORT_DIRECTION)
+#define PORT_DEV_ERROR_VERSION_INFO             (PORT_DEV_ERROR_CUSTOM_VERSION_INFO)
+#define PORT_DEV_ERROR_SET_PIN_MODE             (PORT_DEV_ERROR_CUSTOM_SET_PIN_MODE)
+#else
+  #error "PORT_DEV_ERROR_PROFILE shall be one of the PORT_DEV_ERROR_PROFILE_xxx values"
+#endif
+
+/* STD_ON if the API checks the class of errors ... to be evaluated by #if */
+#define PORT_DEV_ERROR_CHECK(API, CLASS) \
+    ((PORT_DEV_ERROR_DETECT == STD_ON) && ((API) == STD_ON) && ((CLASS) == STD_ON))
+
 
 /*******************************************************************************
  *                              Module Data Types                              *
@@ -26,8 +26,32 @@
 #define PORT_CFG_AR_RELEASE_MINOR_VERSION               (0U)
 #define PORT_CFG_AR_RELEASE_PATCH_VERSION               (3U)
 
-/* Pre-compile option for Development Error Detect */
+/* Pre-compile option for Development Error Detect ... STD_OFF removes all the checks below, override it on the command line */
+#ifndef PORT_DEV_ERROR_DETECT
 #define PORT_DEV_ERROR_DETECT                           (STD_ON)
+#endif
+
+/*
+ * Pre-compile option for the APIs which check their development errors:
+ * PORT_DEV_ERROR_PROFILE_ALL    - every API
+ * PORT_DEV_ERROR_PROFILE_CONFIG - Port_Init, the Set APIs and Port_GetVersionInfo, Port_RefreshPortDirection
+ *                                 called periodically runs unchecked
+ * PORT_DEV_ERROR_PROFILE_CUSTOM - the APIs selected by the PORT_DEV_ERROR_CUSTOM_xxx options
+ */
+#define PORT_DEV_ERROR_PROFILE                          (PORT_DEV_ERROR_PROFILE_ALL)
+
+/* Pre-compile options for the APIs checked by PORT_DEV_ERROR_PROFILE_CUSTOM */
+#define PORT_DEV_ERROR_CUSTOM_INIT                      (STD_ON)
+#define PORT_DEV_ERROR_CUSTOM_SET_PIN_DIRECTION         (STD_ON)
+#define PORT_DEV_ERROR_CUSTOM_REFRESH_PORT_DIRECTION    (STD_OFF)
+#define PORT_DEV_ERROR_CUSTOM_VERSION_INFO              (STD_ON)
+#define PORT_DEV_ERROR_CUSTOM_SET_PIN_MODE              (STD_ON)
+
+/* Pre-compile options for the classes of errors checked by the selected APIs */
+#define PORT_DEV_ERROR_UNINIT_CHECK                     (STD_ON)   /* PORT_E_UNINIT */
+#define PORT_DEV_ERROR_RANGE_CHECK                      (STD_ON)   /* PORT_E_PARAM_PIN */
+#define PORT_DEV_ERROR_CHANGEABLE_CHECK                 (STD_ON)   /* PORT_E_DIRECTION_UNCHANGEABLE, PORT_E_MODE_UNCHANGEABLE */
+#define PORT_DEV_ERROR_POINTER_CHECK                    (STD_ON)   /* PORT_E_PARAM_CONFIG, PORT_E_PARAM_POINTER */
 
 /* Pre-compile option for Version Info API */
 #define PORT_VERSION_INFO_API                           (STD_OFF)
@@ -40,5 +40,12 @@
 #define PORT_ANALOG_MODE_SEL_REG_OFFSET   0x528
 #define PORT_CTL_REG_OFFSET               0x52C
 
+/* Value written to the GPIOLOCK register to unlock the GPIOCR register */
+#define PORT_UNLOCK_VALUE                 0x4C4F434B
+
+/* GPIO clock gating registers addresses in the System Control */
+#define SYSCTL_RCGC2_ADDRESS              0x400FE108
+#define SYSCTL_PRGPIO_ADDRESS             0x400FEA08
+
 
 #endif /* PORT_REGS_H_ */